@@ -17,6 +17,7 @@
 *       - Clipping support for all rendering modes
 *       - Texture features supported:
 *           - All uncompressed texture formats supported by raylib
+*           - DXT1/DXT3/DXT5 and ETC1/ETC2/EAC compressed textures, decoded on sampling
 *           - Texture Minification/Magnification checks
 *           - Point and Bilinear filtering
 *           - Texture Wrap Modes with separate checks for S/T coordinates
@@ -25,6 +26,7 @@
 *       - Other GL misc features:
 *           - GL-style getter functions
 *           - Framebuffer resizing
+*           - Frames output ring (headless rendering), optionally on shared memory
 *           - Perspective correction
 *           - Scissor clipping
 *           - Depth testing
@@ -48,6 +50,19 @@
 *           recommended under specific situations and only if the developers know
 *           what are they doing; this flag is not defined by default
 *
+*       #define RLSW_USE_RASTER_THREADS
+*           Enable deferred rasterization on multiple threads: primitives are transformed,
+*           clipped and binned into screen tiles, tiles are rasterized in parallel by a pool
+*           of worker threads when rendering is flushed: swClear(), swReadPixels(),
+*           swBlitPixels(), swGetColorBuffer(), framebuffer/texture changes or swFinish()
+*           Rendering output is identical to immediate rasterization; this flag is not
+*           defined by default, it requires linking with pthreads on non-Windows platforms
+*
+*       #define RLSW_USE_SHARED_FRAME_RING
+*           Enable frames output rings on POSIX shared memory objects (swCreateSharedFrameRing()),
+*           so frames published by swPresentFrame() can be read by other processes with no copies;
+*           this flag is not defined by default, it requires linking with rt on older glibc versions
+*
 *       rlsw capabilities could be customized defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -58,6 +73,15 @@
 *           #define SW_MAX_MODELVIEW_STACK_SIZE     8
 *           #define SW_MAX_TEXTURE_STACK_SIZE       2
 *           #define SW_MAX_TEXTURES                 128
+*           #define SW_RASTER_THREADS               0       // 0: processors count, requires RLSW_USE_RASTER_THREADS
+*           #define SW_RASTER_TILE_SIZE             64
+*           #define SW_MAX_BINNED_PRIMITIVES        16384
+*           #define SW_VERTEX_BATCH_SIZE            1024
+*           #define SW_MAX_FRAME_RING_FRAMES        16
+*           #define SW_USE_FIXED_PIPELINE           true    // Fixed-point fragment pipeline, when possible, colors differ from float pipeline by rounding only
+*           #define SW_USE_DEPTH_TILES              true    // Coarse depth buffer, occluded primitives rejection
+*           #define SW_USE_TILED_TEXTURES           true    // Textures texels stored by 4x4 tiles
+*           #define SW_BLOCK_CACHE_SIZE             1024    // Compressed blocks decoded cached per thread
 *
 *
 *   LICENSE: MIT
@@ -90,7 +114,9 @@
 #define RLSW_VERSION  "1.5"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>         // Required for: memcpy() [Used in swCopyFrameRingFrame()]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -153,6 +179,32 @@
     #define SW_MAX_TEXTURES                 128
 #endif
 
+// Deferred rasterization configuration, requires RLSW_USE_RASTER_THREADS
+#ifndef SW_RASTER_THREADS
+    #define SW_RASTER_THREADS               0           // Threads rasterizing tiles, calling thread included (0: processors count)
+#endif
+
+#ifndef SW_MAX_RASTER_THREADS
+    #define SW_MAX_RASTER_THREADS           32
+#endif
+
+#ifndef SW_RASTER_TILE_SIZE
+    #define SW_RASTER_TILE_SIZE             64          // Screen tiles size in pixels
+#endif
+
+#ifndef SW_MAX_BINNED_PRIMITIVES
+    #define SW_MAX_BINNED_PRIMITIVES        16384       // Primitives binned before rendering is flushed
+#endif
+
+#ifndef SW_VERTEX_BATCH_SIZE
+    #define SW_VERTEX_BATCH_SIZE            1024        // Vertices transformed per batch on swDrawArrays()
+#endif
+
+// Frames output ring configuration, frames published by swPresentFrame()
+#ifndef SW_MAX_FRAME_RING_FRAMES
+    #define SW_MAX_FRAME_RING_FRAMES        16          // Maximum frames in a frames output ring
+#endif
+
 // Enables the use of a lookup table for uint8_t to float conversion
 // Requires an additional 1KB of global memory
 // Disabled when SIMD intrinsics are enabled
@@ -164,6 +216,36 @@
     #endif
 #endif
 
+// Enables the 8-bit fixed-point fragment pipeline, used instead of the float pipeline
+// for R8G8B8A8 framebuffers when no depth test is required, textures are sampled with
+// nearest filtering and blending is disabled or a common mode (alpha, additive, premultiplied)
+// NOTE: Accuracy contract: same pixels covered and same texels selected as the float pipeline,
+// color channels differ by rounding only, up to 1 (no blending) or 2 (blending) per primitive,
+// differences can add up on overlapping blended primitives; define as false for float output
+#ifndef SW_USE_FIXED_PIPELINE
+    #define SW_USE_FIXED_PIPELINE           true
+#endif
+
+// Enables the coarse depth buffer, depth buffers keep the maximum depth of every screen tile
+// so depth tested triangles, quads and spans blocks fully occluded are rejected before their
+// colors and texture coordinates are interpolated; requires 4 bytes per 16 pixels
+#ifndef SW_USE_DEPTH_TILES
+    #define SW_USE_DEPTH_TILES              true
+#endif
+
+// Enables the tiled textures layout, color textures texels are stored by 4x4 tiles so
+// texels sampled together (bilinear quads, rotated or minified spans) share cache lines;
+// textures are converted back to a linear layout when used as framebuffer color attachment
+#ifndef SW_USE_TILED_TEXTURES
+    #define SW_USE_TILED_TEXTURES           true
+#endif
+
+// Compressed textures 4x4 blocks decoded kept per thread, must be a power of two;
+// requires 72 bytes per block, enough blocks to keep a few rows of blocks decoded
+#ifndef SW_BLOCK_CACHE_SIZE
+    #define SW_BLOCK_CACHE_SIZE             1024
+#endif
+
 //----------------------------------------------------------------------------------
 // OpenGL Compatibility Types
 //----------------------------------------------------------------------------------
@@ -277,6 +359,10 @@ typedef double              GLclampd;
 
 #define GL_NEAREST                          0x2600
 #define GL_LINEAR                           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST           0x2700
+#define GL_LINEAR_MIPMAP_NEAREST            0x2701
+#define GL_NEAREST_MIPMAP_LINEAR            0x2702
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
 
 #define GL_REPEAT                           0x2901
 #define GL_CLAMP                            0x2900
@@ -361,6 +447,15 @@ typedef double              GLclampd;
 #define GL_RGB32F                           0x8815
 #define GL_RGBA32F                          0x8814
 
+// OpenGL compressed internal formats extension
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT    0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT    0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT    0x83F3
+#define GL_ETC1_RGB8_OES                    0x8D64
+#define GL_COMPRESSED_RGB8_ETC2             0x9274
+#define GL_COMPRESSED_RGBA8_ETC2_EAC        0x9278
+
 // OpenGL GL_EXT_framebuffer_object
 #define GL_DRAW_FRAMEBUFFER_BINDING                     0x8CA6
 #define GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE           0x8CD0
@@ -461,9 +556,13 @@ typedef double              GLclampd;
 #define glGenTextures(c, v)                         swGenTextures((c), (v))
 #define glDeleteTextures(c, v)                      swDeleteTextures((c), (v))
 #define glBindTexture(tr, id)                       swBindTexture((id))
-#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2D((w), (h), (f), (t), (p))
+#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2DLevel((l), (w), (h), (f), (t), (p))
 #define glTexSubImage2D(tr, l, x, y, w, h, f, t, p) swTexSubImage2D((x), (y), (w), (h), (f), (t), (p));
+#define glCompressedTexImage2D(tr, l, if, w, h, b, s, p) swCompressedTexImage2D((l), (w), (h), (if), (s), (p))
 #define glTexParameteri(tr, pname, param)           swTexParameteri((pname), (param))
+#define glGenerateMipmap(tr)                        swGenerateMipmap()
+#define glFinish()                                  swFinish()
+#define glFlush()                                   swFinish()
 
 // OpenGL GL_EXT_framebuffer_object
 #define glGenFramebuffers(c, v)                             swGenFramebuffers((c), (v))
@@ -613,12 +712,23 @@ typedef enum {
     SW_DEPTH_COMPONENT24 = GL_DEPTH_COMPONENT24,
     SW_DEPTH_COMPONENT32 = GL_DEPTH_COMPONENT32,
     SW_DEPTH_COMPONENT32F = GL_DEPTH_COMPONENT32F,
+    SW_COMPRESSED_RGB_S3TC_DXT1 = GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+    SW_COMPRESSED_RGBA_S3TC_DXT1 = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+    SW_COMPRESSED_RGBA_S3TC_DXT3 = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,
+    SW_COMPRESSED_RGBA_S3TC_DXT5 = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+    SW_ETC1_RGB8 = GL_ETC1_RGB8_OES,
+    SW_COMPRESSED_RGB8_ETC2 = GL_COMPRESSED_RGB8_ETC2,
+    SW_COMPRESSED_RGBA8_ETC2_EAC = GL_COMPRESSED_RGBA8_ETC2_EAC,
     //SW_R5_G6_B5, // Not defined by OpenGL
 } SWinternalformat;
 
 typedef enum {
     SW_NEAREST = GL_NEAREST,
-    SW_LINEAR  = GL_LINEAR
+    SW_LINEAR  = GL_LINEAR,
+    SW_NEAREST_MIPMAP_NEAREST = GL_NEAREST_MIPMAP_NEAREST,
+    SW_LINEAR_MIPMAP_NEAREST = GL_LINEAR_MIPMAP_NEAREST,
+    SW_NEAREST_MIPMAP_LINEAR = GL_NEAREST_MIPMAP_LINEAR,
+    SW_LINEAR_MIPMAP_LINEAR = GL_LINEAR_MIPMAP_LINEAR
 } SWfilter;
 
 typedef enum {
@@ -660,6 +770,71 @@ typedef enum {
     SW_OUT_OF_MEMORY = GL_OUT_OF_MEMORY,
 } SWerrcode;
 
+// Frames output ring, header placed at the beginning of ring memory, followed by frames data
+// NOTE: Frames are stored in output layout, same as swReadPixels() for the framebuffer format:
+// rows from top to bottom, red and blue channels swapped when bgra is set (SW_FRAMEBUFFER_OUTPUT_BGRA)
+// Frames are published by swPresentFrame(), consumers must follow this protocol (seqlock reader):
+//   1. Load sequence (acquire), if it has not changed there is no new frame
+//   2. Load frameSequence[(sequence - 1)%frameCount] (acquire), if it is not sequence the frame was already overwritten
+//   3. Read frame data at SW_FRAME_RING_FRAME(ring, sequence)
+//   4. Acquire fence, orders frame data loads before the next load
+//   5. Reload frameSequence[(sequence - 1)%frameCount], if it is not sequence anymore
+//      the frame was overwritten while being read and the data read must be discarded
+// swCopyFrameRingFrame() implements steps 2 to 5, copying frame data
+// Consumers can hold a frame during (frameCount - 1) swPresentFrame() calls before it is overwritten
+typedef struct SWframering {
+    uint32_t magic;                     // Frames ring identifier (SW_FRAME_RING_MAGIC)
+    uint32_t headerSize;                // Header size, offset of first frame data (bytes)
+    uint32_t width;                     // Frames width (pixels)
+    uint32_t height;                    // Frames height (pixels)
+    uint32_t format;                    // Frames pixel format (SWformat)
+    uint32_t type;                      // Frames pixel type (SWtype)
+    uint32_t bgra;                      // Frames red and blue channels swapped
+    uint32_t pixelSize;                 // Frames pixel size (bytes)
+    uint32_t pitch;                     // Frames row size (bytes)
+    uint32_t frameSize;                 // Frames size, including alignment padding (bytes)
+    uint32_t frameCount;                // Frames in ring
+    volatile uint32_t sequence;         // Last frame published (0: none), frames sequences start at 1
+    volatile uint32_t frameSequence[SW_MAX_FRAME_RING_FRAMES]; // Frame published on every slot (0: none or being written)
+} SWframering;
+
+#define SW_FRAME_RING_MAGIC         0x474e4952  // "RING"
+
+// Get frame data for a published frame sequence
+#define SW_FRAME_RING_FRAME(ring, seq) \
+    ((const void *)((const unsigned char *)(ring) + (ring)->headerSize + (size_t)(((seq) - 1)%(ring)->frameCount)*(ring)->frameSize))
+
+// Frames ring consumers acquire fence, loads before the fence are ordered before loads after it
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>             // Required for: _ReadWriteBarrier(), __dmb()
+    #if defined(_M_ARM64) || defined(_M_ARM)
+        #define SW_FRAME_RING_ACQUIRE_FENCE()   __dmb(0x9)              // DMB ISHLD
+    #else
+        #define SW_FRAME_RING_ACQUIRE_FENCE()   _ReadWriteBarrier()     // x86 does not reorder loads with other loads
+    #endif
+#else
+    #define SW_FRAME_RING_ACQUIRE_FENCE()       __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
+// Copy published frame data (pitch*height bytes), returns false if frame is not available or it was overwritten while copied
+// NOTE: Sequence is loaded by consumer from ring->sequence (step 1 of frames ring protocol), pixels content is undefined on failure
+static inline bool swCopyFrameRingFrame(const SWframering *ring, uint32_t sequence, void *pixels)
+{
+    if ((ring == NULL) || (ring->magic != SW_FRAME_RING_MAGIC) || (sequence == 0) || (ring->frameCount == 0)) return false;
+    SW_FRAME_RING_ACQUIRE_FENCE();
+
+    const volatile uint32_t *frameSequence = &ring->frameSequence[(sequence - 1)%ring->frameCount];
+
+    if (*frameSequence != sequence) return false;
+    SW_FRAME_RING_ACQUIRE_FENCE();          // Frame data loads after frame sequence check
+
+    memcpy(pixels, SW_FRAME_RING_FRAME(ring, sequence), (size_t)ring->pitch*ring->height);
+
+    SW_FRAME_RING_ACQUIRE_FENCE();          // Frame data loads before frame sequence reload
+
+    return (*frameSequence == sequence);
+}
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Public API
 //------------------------------------------------------------------------------------
@@ -671,6 +846,15 @@ SWAPI void swReadPixels(int x, int y, int w, int h, SWformat format, SWtype type
 SWAPI void swBlitPixels(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels);
 SWAPI void *swGetColorBuffer(int *width, int *height); // Restored for ESP-IDF compatibility
 
+SWAPI void swFinish(void);                      // Rasterize all binned primitives (deferred rasterization)
+SWAPI void swSetRasterThreads(int count);       // Set threads used on deferred rasterization (0: processors count, 1: immediate)
+
+SWAPI size_t swGetFrameRingSize(int width, int height, int frameCount); // Get memory required by a frames output ring (bytes)
+SWAPI bool swAttachFrameRing(void *memory, size_t size, int frameCount); // Attach frames output ring for framebuffer size (NULL: detach)
+SWAPI bool swCreateSharedFrameRing(const char *name, int frameCount);    // Create and attach frames output ring on shared memory, requires RLSW_USE_SHARED_FRAME_RING
+SWAPI const SWframering *swGetFrameRing(void);  // Get frames output ring attached
+SWAPI uint32_t swPresentFrame(void);            // Publish framebuffer into next frames output ring frame, returns frame sequence (0: failed)
+
 SWAPI void swEnable(SWstate state);
 SWAPI void swDisable(SWstate state);
 
@@ -736,8 +920,11 @@ SWAPI void swGenTextures(int count, uint32_t *textures);
 SWAPI void swDeleteTextures(int count, uint32_t *textures);
 SWAPI void swBindTexture(uint32_t id);
 SWAPI void swTexImage2D(int width, int height, SWformat format, SWtype type, const void *data);
+SWAPI void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, const void *data);
 SWAPI void swTexSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+SWAPI void swCompressedTexImage2D(int level, int width, int height, SWinternalformat format, int imageSize, const void *data); // DXT/ETC blocks, kept compressed
 SWAPI void swTexParameteri(int param, int value);
+SWAPI void swGenerateMipmap(void);
 
 SWAPI void swGenFramebuffers(int count, uint32_t *framebuffers);
 SWAPI void swDeleteFramebuffers(int count, uint32_t *framebuffers);
@@ -759,7 +946,7 @@ SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWatta
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stddef.h>         // Required for: NULL, size_t, uint8_t, uint16_t, uint32_t...
-#include <math.h>           // Required for: sinf(), cosf(), floorf(), fabsf(), sqrtf(), roundf()
+#include <math.h>           // Required for: sinf(), cosf(), floorf(), fabsf(), sqrtf(), roundf(), log2f()
 
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
@@ -771,6 +958,44 @@ SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWatta
     #define SW_LOG(...)
 #endif
 
+#if defined(RLSW_USE_RASTER_THREADS)
+    #if defined(_WIN32)
+        #include <process.h>        // Required for: _beginthreadex()
+
+        // NOTE: Win32 threading functions are declared here, windows.h is not included to avoid conflicts with raylib.h,
+        // declarations use the exact windows.h types (HANDLE: void *, DWORD/ULONG: unsigned long, BOOL: int, WORD: unsigned short,
+        // SRWLOCK and CONDITION_VARIABLE by struct tag) so windows.h can also be included before or after this file
+        #if !defined(_WINDOWS_)
+            struct _RTL_SRWLOCK;
+            struct _RTL_CONDITION_VARIABLE;
+
+            __declspec(dllimport) void __stdcall InitializeSRWLock(struct _RTL_SRWLOCK *SRWLock);
+            __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(struct _RTL_SRWLOCK *SRWLock);
+            __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(struct _RTL_SRWLOCK *SRWLock);
+            __declspec(dllimport) int __stdcall SleepConditionVariableSRW(struct _RTL_CONDITION_VARIABLE *ConditionVariable, struct _RTL_SRWLOCK *SRWLock, unsigned long dwMilliseconds, unsigned long Flags);
+            __declspec(dllimport) void __stdcall WakeConditionVariable(struct _RTL_CONDITION_VARIABLE *ConditionVariable);
+            __declspec(dllimport) void __stdcall WakeAllConditionVariable(struct _RTL_CONDITION_VARIABLE *ConditionVariable);
+            __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+            __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+            __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+        #endif
+    #else
+        #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_lock()
+        #include <unistd.h>         // Required for: sysconf()
+    #endif
+#endif
+
+#if defined(RLSW_USE_SHARED_FRAME_RING) && !defined(_WIN32)
+    #include <sys/mman.h>           // Required for: shm_open(), shm_unlink(), mmap(), munmap()
+    #include <fcntl.h>              // Required for: O_CREAT, O_EXCL, O_RDWR
+    #include <unistd.h>             // Required for: ftruncate(), close()
+    #define SW_SHARED_FRAME_RING_SUPPORTED
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>             // Required for: _InterlockedExchange()
+#endif
+
 #if defined(_MSC_VER)
     #define SW_ALIGN(x) __declspec(align(x))
 #elif defined(__GNUC__) || defined(__clang__)
@@ -842,6 +1067,20 @@ SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWatta
         #define SW_HAS_RVV
         #include <riscv_vector.h>
     #endif
+
+    // Instruction sets available, including the ones implied by higher levels
+    #if defined(SW_HAS_FMA_AVX2) || defined(SW_HAS_AVX2)
+        #define SW_SIMD_AVX2
+    #endif
+    #if defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+        #define SW_SIMD_SSSE3
+    #endif
+    #if defined(SW_SIMD_SSSE3) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSE2)
+        #define SW_SIMD_SSE2
+    #endif
+    #if defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+        #define SW_SIMD_NEON
+    #endif
 #endif
 
 #ifdef __cplusplus
@@ -863,6 +1102,10 @@ SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWatta
 // the frustum (6 planes) then the scissor rectangle (4 planes):
 // 4 + 6 + 4 = 14 vertices maximum.
 #define SW_MAX_CLIPPED_POLYGON_VERTICES 14
+#define SW_MAX_MIPMAP_LEVELS            16      // Up to 32768x32768 textures
+#define SW_FIXED_SPAN_PIXELS            16      // Pixels processed per pass on fixed-point pipeline
+#define SW_DEPTH_TILE_SIZE              16      // Coarse depth tiles size, same as rasterized spans blocks
+#define SW_DEPTH_TILE_EPSILON           1e-5f   // Coarse depth margin, covers interpolated depths rounding
 #define SW_CLIP_EPSILON                 1e-4f
 
 #define SW_HANDLE_NULL          0u
@@ -894,6 +1137,21 @@ SWAPI void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWatta
 #define SW_BLEND_FLAG_NOOP          (1 << 0)
 #define SW_BLEND_FLAG_NEEDS_ALPHA   (1 << 1)
 
+#if defined(RLSW_USE_RASTER_THREADS)
+    #if defined(_WIN32)
+        #define SW_THREAD_PROC(name)    static unsigned int __stdcall name(void *arg)
+    #else
+        #define SW_THREAD_PROC(name)    static void *name(void *arg)
+    #endif
+    #if defined(_MSC_VER)
+        #define SW_THREAD_LOCAL         __declspec(thread)
+    #else
+        #define SW_THREAD_LOCAL         __thread
+    #endif
+#else
+    #define SW_THREAD_LOCAL
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -918,6 +1176,12 @@ typedef enum {
     SW_PIXELFORMAT_COLOR_R16,               // 16 bpp (1 channel - half float)
     SW_PIXELFORMAT_COLOR_R16G16B16,         // 16*3 bpp (3 channels - half float)
     SW_PIXELFORMAT_COLOR_R16G16B16A16,      // 16*4 bpp (4 channels - half float)
+    SW_PIXELFORMAT_COMPRESSED_DXT1_RGB,     // 4 bpp (no alpha)
+    SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA,    // 4 bpp (1 bit alpha)
+    SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA,    // 8 bpp
+    SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA,    // 8 bpp
+    SW_PIXELFORMAT_COMPRESSED_ETC2_RGB,     // 4 bpp (ETC1 included)
+    SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, // 8 bpp
     SW_PIXELFORMAT_DEPTH_D8,                // 1 bpp
     SW_PIXELFORMAT_DEPTH_D16,               // 2 bpp
     SW_PIXELFORMAT_DEPTH_D32,               // 4 bpp
@@ -930,8 +1194,18 @@ typedef enum {
     SW_PIXEL_ALPHA_YES,         // Contains transparency
 } sw_pixel_alpha_t;
 
+// Fixed-point fragment pipeline modes
+typedef enum {
+    SW_FIXED_DISABLED = 0,      // Float pipeline required
+    SW_FIXED_REPLACE,           // No blending
+    SW_FIXED_ALPHA,             // Blending: SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA
+    SW_FIXED_ADDITIVE,          // Blending: SW_SRC_ALPHA, SW_ONE
+    SW_FIXED_PREMULTIPLIED,     // Blending: SW_ONE, SW_ONE_MINUS_SRC_ALPHA
+} sw_fixed_mode_t;
+
 // Forward declarations
 typedef struct sw_vertex sw_vertex_t;
+typedef struct sw_raster sw_raster_t;
 
 // Pixel getter functions
 typedef void (*sw_pixel_read_color8_f)(uint8_t *SW_RESTRICT, const void *SW_RESTRICT, uint32_t);
@@ -945,10 +1219,10 @@ typedef void (*sw_pixel_write_color_f)(void *SW_RESTRICT, const float *SW_RESTRI
 typedef void (*sw_blend_f)(float *SW_RESTRICT, const float *SW_RESTRICT);
 
 // Rasterizer functions
-typedef void (*sw_raster_triangle_f)(const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
-typedef void (*sw_raster_quad_f)(const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
-typedef void (*sw_raster_line_f)(const sw_vertex_t*, const sw_vertex_t*);
-typedef void (*sw_raster_point_f)(const sw_vertex_t*);
+typedef void (*sw_raster_triangle_f)(const sw_raster_t*, const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
+typedef void (*sw_raster_quad_f)(const sw_raster_t*, const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
+typedef void (*sw_raster_line_f)(const sw_raster_t*, const sw_vertex_t*, const sw_vertex_t*);
+typedef void (*sw_raster_point_f)(const sw_raster_t*, const sw_vertex_t*);
 
 typedef float sw_matrix_t[4*4];
 
@@ -959,11 +1233,20 @@ typedef struct sw_vertex {
 } sw_vertex_t;
 
 typedef struct {
-    void *pixels;                       // Texture pixels
+    uint32_t offset;                    // Level first pixel offset (in pixels)
+    int width, height;                  // Level dimensions
+    int wMinus1, hMinus1;               // Level dimensions minus one
+    int tilesX;                         // Level tiles per row, tiled layout only
+} sw_texture_level_t;
+
+typedef struct {
+    void *pixels;                       // Texture pixels, mipmap levels stored after the base level
     sw_pixel_read_color8_f readColor8;  // Texel read RGBA8
     sw_pixel_read_color_f readColor;    // Texel read RGBA32F
     sw_pixelformat_t format;            // Texture format
     sw_pixel_alpha_t alpha;             // Texture alpha mode
+    bool tiled;                         // Texels stored by 4x4 tiles (see sw_texture_get_offset())
+    bool isPOT;                         // Power-of-two dimensions, mipmap levels included
     int width, height;                  // Dimensions of the texture
     int wMinus1, hMinus1;               // Dimensions minus one
     int allocSz;                        // Allocated size
@@ -973,8 +1256,33 @@ typedef struct {
     SWwrap tWrap;                       // Wrap mode for texcoord.y
     float tx;                           // Texel width
     float ty;                           // Texel height
+    sw_texture_level_t levels[SW_MAX_MIPMAP_LEVELS]; // Mipmap levels, base level included
+    int levelCount;                     // Mipmap levels defined, minification filters clamp to last level
+    float *depthTiles;                  // Coarse depth tiles, depth formats only (see sw_depth_tiles_get())
+    int depthTilesX;                    // Coarse depth tiles per row
+    int depthTilesSz;                   // Coarse depth tiles allocated size (floats)
 } sw_texture_t;
 
+// Compressed blocks decoded, direct-mapped on blocks addresses
+// NOTE: Every thread sampling textures uses its own cache (see sw_block_cache_get())
+typedef struct {
+    const uint8_t *blocks[SW_BLOCK_CACHE_SIZE];     // Compressed blocks cached (NULL: empty entry)
+    uint8_t texels[SW_BLOCK_CACHE_SIZE][16*4];      // Blocks texels decoded, RGBA8 in row-major order
+    uint32_t epoch;                                 // Compressed textures uploads counter on last cache clear
+} sw_block_cache_t;
+
+// Rasterizer state, captured for every primitive
+// NOTE: Pixels are only written inside the clip rectangle (framebuffer or screen tile)
+typedef struct sw_raster {
+    const sw_texture_t *texture;        // Texture sampled
+    sw_blend_f blendFunc;               // Color blending function
+    sw_fixed_mode_t fixedMode;          // Fixed-point fragment pipeline mode, triangles and quads only
+    float pointRadius;                  // Rasterized point radius
+    float lineWidth;                    // Rasterized line width
+    int clipMin[2];                     // Clip rectangle minimum point (inclusive)
+    int clipMax[2];                     // Clip rectangle maximum point (exclusive)
+} sw_raster_t;
+
 typedef struct {
     sw_texture_t color;         // Default framebuffer color texture
     sw_texture_t depth;         // Default framebuffer depth texture
@@ -985,6 +1293,47 @@ typedef struct {
     sw_handle_t depthAttachment; // Framebuffer depth attachment id
 } sw_framebuffer_t;
 
+#if defined(RLSW_USE_RASTER_THREADS)
+#if defined(_WIN32)
+typedef struct { void *lock; } sw_mutex_t;      // Win32 SRWLOCK
+typedef struct { void *cond; } sw_cond_t;       // Win32 CONDITION_VARIABLE
+typedef void *sw_thread_t;                      // Win32 thread HANDLE
+typedef unsigned int (__stdcall *sw_thread_proc_f)(void *arg);
+#else
+typedef pthread_mutex_t sw_mutex_t;
+typedef pthread_cond_t sw_cond_t;
+typedef pthread_t sw_thread_t;
+typedef void *(*sw_thread_proc_f)(void *arg);
+#endif
+
+typedef enum {
+    SW_RASTER_CMD_TRIANGLE = 0,
+    SW_RASTER_CMD_QUAD,
+    SW_RASTER_CMD_LINE,
+    SW_RASTER_CMD_POINT
+} sw_raster_cmd_type_t;
+
+// Binned primitive, rasterized on every tile it overlaps
+typedef struct {
+    sw_raster_cmd_type_t type;          // Primitive type
+    union {
+        sw_raster_triangle_f triangle;
+        sw_raster_quad_f quad;
+        sw_raster_line_f line;
+        sw_raster_point_f point;
+    } func;                             // Rasterizer variant
+    sw_raster_t raster;                 // Rasterizer state on submission
+    sw_vertex_t vertices[4];            // Screen space vertices
+} sw_raster_cmd_t;
+
+// Tile bin, primitives overlapping the tile in submission order
+typedef struct {
+    uint32_t *cmds;                     // Binned primitives indices
+    int count;
+    int capacity;
+} sw_tile_bin_t;
+#endif
+
 typedef struct {
     void *data;             // Flat storage [capacity*stride] bytes
     uint8_t *gen;           // Generation per slot [capacity]
@@ -1024,6 +1373,11 @@ typedef struct {
         uint8_t *colors;
     } array;
 
+    struct {
+        sw_vertex_t *vertices;                                  // Vertex arrays elements transformed to clip space
+        int capacity;                                           // Vertices allocated
+    } vertexCache;
+
     SWdraw drawMode;                                            // Current primitive mode (e.g., lines, triangles)
     SWpoly polyMode;                                            // Current polygon filling mode (e.g., lines, triangles)
     float pointRadius;                                          // Rasterized point radius
@@ -1052,12 +1406,43 @@ typedef struct {
     SWfactor dstFactor;                                         // Destination bleending factor
     uint32_t blendFlags;                                        // Flags about the current blend mode
     sw_blend_f blendFunc;                                       // Source blend function
+    sw_fixed_mode_t blendFixedMode;                             // Fixed-point pipeline mode for current blend factors
 
     SWface cullFace;                                            // Faces to cull
     SWerrcode errCode;                                          // Last error code
 
     uint32_t userState;                                         // User-defined pipeline state
     uint32_t rasterState;                                       // Cleaned pipeline state for the rasterizer
+
+    struct {
+        SWframering *header;                                    // Frames output ring attached (NULL: none)
+        size_t size;                                            // Frames output ring memory size (bytes)
+        uint32_t sequence;                                      // Last frame sequence published
+        bool shared;                                            // Ring memory is a shared memory object created by rlsw
+        char name[256];                                         // Shared memory object name
+    } frameRing;
+
+#if defined(RLSW_USE_RASTER_THREADS)
+    struct {
+        sw_raster_cmd_t *cmds;                                  // Binned primitives, in submission order
+        int cmdCount;                                           // Binned primitives count
+        int cmdCapacity;                                        // Binned primitives allocated
+        sw_tile_bin_t *bins;                                    // Tiles bins, row-major
+        int binCapacity;                                        // Tiles bins allocated
+        int tilesX, tilesY;                                     // Tiles grid dimensions
+        int tileCount;                                          // Tiles to rasterize on current flush
+        int nextTile;                                           // Next tile to rasterize on current flush
+        int tilesDone;                                          // Tiles rasterized on current flush
+        uint32_t generation;                                    // Flushes counter, worker threads wait for a new one
+        sw_mutex_t lock;                                        // Tiles scheduling lock
+        sw_cond_t wake;                                         // Signaled on flush start and on stop
+        sw_cond_t done;                                         // Signaled once all tiles are rasterized
+        sw_thread_t threads[SW_MAX_RASTER_THREADS];             // Worker threads
+        int threadCount;                                        // Worker threads running, calling thread not included
+        bool quit;                                              // Worker threads stop request
+        bool ready;                                             // Threading objects initialized
+    } tiler;
+#endif
 } sw_context_t;
 
 //----------------------------------------------------------------------------------
@@ -1065,6 +1450,11 @@ typedef struct {
 //----------------------------------------------------------------------------------
 static sw_context_t RLSW = { 0 };
 
+// Compressed textures uploads counter, decoded blocks cached before an upload are discarded
+// NOTE: Not part of the context, caches must not match blocks again after swClose()/swInit()
+static uint32_t RLSW_BLOCK_CACHE_EPOCH = 0;
+static SW_THREAD_LOCAL sw_block_cache_t RLSW_BLOCK_CACHE = { 0 };
+
 #if SW_USE_COLOR_LUT
 static float SW_LUT_UINT8_TO_FLOAT[256] = { 0 };
 #endif
@@ -1075,23 +1465,29 @@ static float SW_LUT_UINT8_TO_FLOAT[256] = { 0 };
 // Pixel formats that has an alpha channel
 static const sw_pixel_alpha_t SW_PIXELFORMAT_ALPHA[SW_PIXELFORMAT_COUNT] =
 {
-    [SW_PIXELFORMAT_COLOR_GRAYSCALE]    = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_GRAYALPHA]    = SW_PIXEL_ALPHA_YES,
-    [SW_PIXELFORMAT_COLOR_R3G3B2]       = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R5G6B5]       = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R8G8B8]       = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R5G5B5A1]     = SW_PIXEL_ALPHA_BIN,
-    [SW_PIXELFORMAT_COLOR_R4G4B4A4]     = SW_PIXEL_ALPHA_YES,
-    [SW_PIXELFORMAT_COLOR_R8G8B8A8]     = SW_PIXEL_ALPHA_YES,
-    [SW_PIXELFORMAT_COLOR_R32]          = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R32G32B32]    = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R32G32B32A32] = SW_PIXEL_ALPHA_YES,
-    [SW_PIXELFORMAT_COLOR_R16]          = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R16G16B16]    = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_COLOR_R16G16B16A16] = SW_PIXEL_ALPHA_YES,
-    [SW_PIXELFORMAT_DEPTH_D8]           = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_DEPTH_D16]          = SW_PIXEL_ALPHA_NONE,
-    [SW_PIXELFORMAT_DEPTH_D32]          = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_GRAYSCALE]            = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_GRAYALPHA]            = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COLOR_R3G3B2]               = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R5G6B5]               = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R8G8B8]               = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R5G5B5A1]             = SW_PIXEL_ALPHA_BIN,
+    [SW_PIXELFORMAT_COLOR_R4G4B4A4]             = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COLOR_R8G8B8A8]             = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COLOR_R32]                  = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R32G32B32]            = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R32G32B32A32]         = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COLOR_R16]                  = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R16G16B16]            = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COLOR_R16G16B16A16]         = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COMPRESSED_DXT1_RGB]        = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA]       = SW_PIXEL_ALPHA_BIN,
+    [SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA]       = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA]       = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_COMPRESSED_ETC2_RGB]        = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA]   = SW_PIXEL_ALPHA_YES,
+    [SW_PIXELFORMAT_DEPTH_D8]                   = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_DEPTH_D16]                  = SW_PIXEL_ALPHA_NONE,
+    [SW_PIXELFORMAT_DEPTH_D32]                  = SW_PIXEL_ALPHA_NONE,
 };
 
 // Pixel formats sizes in bytes
@@ -1116,6 +1512,40 @@ static const int SW_PIXELFORMAT_SIZE[SW_PIXELFORMAT_COUNT] =
     [SW_PIXELFORMAT_DEPTH_D32]          = 4,
 };
 
+// Compressed pixel formats 4x4 blocks sizes in bytes, zero for uncompressed formats
+static const int SW_PIXELFORMAT_BLOCK_SIZE[SW_PIXELFORMAT_COUNT] =
+{
+    [SW_PIXELFORMAT_COMPRESSED_DXT1_RGB]        = 8,
+    [SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA]       = 8,
+    [SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA]       = 16,
+    [SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA]       = 16,
+    [SW_PIXELFORMAT_COMPRESSED_ETC2_RGB]        = 8,
+    [SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA]   = 16,
+};
+
+// ETC1/ETC2 intensity modifiers tables, ordered by pixel index (a, b, -a, -b)
+static const int SW_ETC_MODIFIERS[8][4] =
+{
+    { 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+    { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+// ETC2 T and H modes distances
+static const int SW_ETC_DISTANCES[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// EAC alpha modifiers tables
+static const int SW_EAC_MODIFIERS[16][8] =
+{
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
 static const int SW_PRIMITIVE_VERTEX_COUNT[] =
 {
     // Remember that this is acceptable; these are small indices
@@ -1412,14 +1842,14 @@ static inline uint32_t sw_compress_8to6(uint8_t v) { return v >> 2; }
 
 static inline void sw_color8_to_color(float *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src)
 {
-#if defined(SW_HAS_NEON)
+#if defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
     uint8x8_t bytes = vreinterpret_u8_u32(vld1_dup_u32((const uint32_t *)src));
     uint16x8_t words = vmovl_u8(bytes);
     uint32x4_t dwords = vmovl_u16(vget_low_u16(words));
     float32x4_t fvals = vmulq_f32(vcvtq_f32_u32(dwords), vdupq_n_f32(SW_INV_255));
     vst1q_f32(dst, fvals);
 
-#elif defined(SW_HAS_SSE41)
+#elif defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
     __m128i bytes = _mm_loadu_si32(src);
     __m128 fvals = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(bytes)), _mm_set1_ps(SW_INV_255));
     _mm_storeu_ps(dst, fvals);
@@ -1457,21 +1887,21 @@ static inline void sw_color8_to_color(float *SW_RESTRICT dst, const uint8_t *SW_
 
 static inline void sw_color_to_color8(uint8_t *SW_RESTRICT dst, const float *SW_RESTRICT src)
 {
-#if defined(SW_HAS_NEON)
+#if defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
     float32x4_t fvals = vmulq_f32(vld1q_f32(src), vdupq_n_f32(255.0f));
     uint32x4_t i32 = vcvtq_u32_f32(fvals);
-    uint16x4_t i16 = vmovn_u32(i32);
-    uint8x8_t i8 = vmovn_u16(vcombine_u16(i16, i16));
+    uint16x4_t i16 = vqmovn_u32(i32);
+    uint8x8_t i8 = vqmovn_u16(vcombine_u16(i16, i16));
     vst1_lane_u32((uint32_t *)dst, vreinterpret_u32_u8(i8), 0);
 
-#elif defined(SW_HAS_SSE41)
+#elif defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
     __m128 fvals = _mm_mul_ps(_mm_loadu_ps(src), _mm_set1_ps(255.0f));
     __m128i i32 = _mm_cvttps_epi32(fvals);
     __m128i i16 = _mm_packus_epi32(i32, i32);
     __m128i i8 = _mm_packus_epi16(i16, i16);
     _mm_storeu_si32(dst, i8);
 
-#elif defined(SW_HAS_SSE2)
+#elif defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3)
     __m128 fvals = _mm_mul_ps(_mm_loadu_ps(src), _mm_set1_ps(255.0f));
     __m128i i32 = _mm_cvttps_epi32(fvals);
     __m128i i16 = _mm_packs_epi32(i32, i32);
@@ -1497,10 +1927,10 @@ static inline void sw_color_to_color8(uint8_t *SW_RESTRICT dst, const float *SW_
     __riscv_vse8_v_u8m1(dst, vu8, vl); // Store result
 
 #else
-    dst[0] = (uint8_t)(src[0]*255.0f);
-    dst[1] = (uint8_t)(src[1]*255.0f);
-    dst[2] = (uint8_t)(src[2]*255.0f);
-    dst[3] = (uint8_t)(src[3]*255.0f);
+    dst[0] = (uint8_t)(sw_saturate(src[0])*255.0f);
+    dst[1] = (uint8_t)(sw_saturate(src[1])*255.0f);
+    dst[2] = (uint8_t)(sw_saturate(src[2])*255.0f);
+    dst[3] = (uint8_t)(sw_saturate(src[3])*255.0f);
 #endif
 }
 //-------------------------------------------------------------------------------------------
@@ -1603,6 +2033,13 @@ static inline bool sw_is_texture_filter_valid(int filter)
     return ((filter == SW_NEAREST) || (filter == SW_LINEAR));
 }
 
+static inline bool sw_is_texture_min_filter_valid(int filter)
+{
+    return ((filter == SW_NEAREST) || (filter == SW_LINEAR) ||
+            (filter == SW_NEAREST_MIPMAP_NEAREST) || (filter == SW_LINEAR_MIPMAP_NEAREST) ||
+            (filter == SW_NEAREST_MIPMAP_LINEAR) || (filter == SW_LINEAR_MIPMAP_LINEAR));
+}
+
 static inline bool sw_is_texture_wrap_valid(int wrap)
 {
     return ((wrap == SW_REPEAT) || (wrap == SW_CLAMP));
@@ -1650,6 +2087,304 @@ static inline bool sw_is_ready_to_render(void)
 }
 //-------------------------------------------------------------------------------------------
 
+// Compressed blocks functionality
+//-------------------------------------------------------------------------------------------
+// NOTE: Compressed textures are kept compressed, 4x4 texels blocks are decoded when sampled
+// into RGBA8 texels in row-major order, decoded blocks are cached per thread
+
+static inline uint8_t sw_block_clamp8(int value)
+{
+    return (value < 0)? 0 : ((value > 255)? 255 : (uint8_t)value);
+}
+
+static inline void sw_block_unpack_565(uint8_t *SW_RESTRICT color, uint16_t value)
+{
+    uint8_t r = (value >> 11) & 0x1F;
+    uint8_t g = (value >> 5) & 0x3F;
+    uint8_t b = value & 0x1F;
+
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+    color[3] = 255;
+}
+
+// Decode DXT color block (8 bytes), DXT3/DXT5 color blocks always use the four colors mode
+// NOTE: On three colors mode the fourth color is black, transparent for DXT1 with alpha
+static void sw_block_decode_dxt_color(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block, bool fourColors, bool punchAlpha)
+{
+    uint16_t c0 = block[0] | (block[1] << 8);
+    uint16_t c1 = block[2] | (block[3] << 8);
+    uint32_t indices = block[4] | (block[5] << 8) | (block[6] << 16) | ((uint32_t)block[7] << 24);
+
+    uint8_t palette[4][4];
+    sw_block_unpack_565(palette[0], c0);
+    sw_block_unpack_565(palette[1], c1);
+
+    if (fourColors || (c0 > c1))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            palette[2][i] = (2*palette[0][i] + palette[1][i] + 1)/3;
+            palette[3][i] = (palette[0][i] + 2*palette[1][i] + 1)/3;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    }
+    else
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            palette[2][i] = (palette[0][i] + palette[1][i] + 1)/2;
+            palette[3][i] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = punchAlpha? 0 : 255;
+    }
+
+    for (int i = 0; i < 16; i++, indices >>= 2)
+    {
+        const uint8_t *color = palette[indices & 3];
+        texels[i*4 + 0] = color[0];
+        texels[i*4 + 1] = color[1];
+        texels[i*4 + 2] = color[2];
+        texels[i*4 + 3] = color[3];
+    }
+}
+
+// Decode DXT3 explicit alpha block (8 bytes), 4 bits per texel
+static void sw_block_decode_dxt3_alpha(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        uint8_t alpha = (block[i/2] >> ((i & 1)*4)) & 0xF;
+        texels[i*4 + 3] = alpha*17;
+    }
+}
+
+// Decode DXT5 interpolated alpha block (8 bytes), 3 bits indices per texel
+static void sw_block_decode_dxt5_alpha(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block)
+{
+    int palette[8];
+    palette[0] = block[0];
+    palette[1] = block[1];
+
+    if (palette[0] > palette[1])
+    {
+        for (int i = 1; i < 7; i++) palette[i + 1] = ((7 - i)*palette[0] + i*palette[1] + 3)/7;
+    }
+    else
+    {
+        for (int i = 1; i < 5; i++) palette[i + 1] = ((5 - i)*palette[0] + i*palette[1] + 2)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; i++) indices |= (uint64_t)block[2 + i] << (8*i);
+
+    for (int i = 0; i < 16; i++, indices >>= 3) texels[i*4 + 3] = (uint8_t)palette[indices & 7];
+}
+
+// Write ETC texels from four paint colors, pixel indices stored in column-major order
+static void sw_block_write_etc_paint(uint8_t *SW_RESTRICT texels, const int (*paint)[3], uint32_t indices)
+{
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (((indices >> (i + 16)) & 1) << 1) | ((indices >> i) & 1);
+        uint8_t *texel = &texels[((i & 3)*4 + (i >> 2))*4];
+        texel[0] = sw_block_clamp8(paint[index][0]);
+        texel[1] = sw_block_clamp8(paint[index][1]);
+        texel[2] = sw_block_clamp8(paint[index][2]);
+        texel[3] = 255;
+    }
+}
+
+// Decode ETC2 color block (8 bytes), ETC1 blocks included
+// NOTE: ETC2 modes (T, H and planar) are encoded as differential mode overflows
+static void sw_block_decode_etc2_color(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block)
+{
+    uint32_t indices = ((uint32_t)block[4] << 24) | (block[5] << 16) | (block[6] << 8) | block[7];
+    int base[2][3];
+
+    if ((block[3] & 2) == 0)
+    {
+        // Individual mode, two 4 bit base colors
+        for (int i = 0; i < 3; i++)
+        {
+            base[0][i] = (block[i] >> 4)*17;
+            base[1][i] = (block[i] & 0xF)*17;
+        }
+    }
+    else
+    {
+        // Differential mode, 5 bit base color and 3 bit signed difference
+        int c[3], d[3];
+        for (int i = 0; i < 3; i++)
+        {
+            c[i] = block[i] >> 3;
+            d[i] = ((block[i] & 7) ^ 4) - 4;
+        }
+
+        if ((c[0] + d[0] < 0) || (c[0] + d[0] > 31))
+        {
+            // T mode, two 4 bit colors and a distance
+            int c0[3] = { ((block[0] >> 1) & 0xC) | (block[0] & 3), block[1] >> 4, block[1] & 0xF };
+            int c1[3] = { block[2] >> 4, block[2] & 0xF, block[3] >> 4 };
+            int dist = SW_ETC_DISTANCES[((block[3] >> 1) & 6) | (block[3] & 1)];
+
+            int paint[4][3];
+            for (int i = 0; i < 3; i++)
+            {
+                paint[0][i] = c0[i]*17;
+                paint[1][i] = c1[i]*17 + dist;
+                paint[2][i] = c1[i]*17;
+                paint[3][i] = c1[i]*17 - dist;
+            }
+            sw_block_write_etc_paint(texels, (const int (*)[3])paint, indices);
+            return;
+        }
+
+        if ((c[1] + d[1] < 0) || (c[1] + d[1] > 31))
+        {
+            // H mode, two 4 bit colors and a distance
+            int c0[3] = { (block[0] >> 3) & 0xF, ((block[0] & 7) << 1) | ((block[1] >> 4) & 1),
+                          (block[1] & 8) | ((block[1] & 3) << 1) | (block[2] >> 7) };
+            int c1[3] = { (block[2] >> 3) & 0xF, ((block[2] & 7) << 1) | (block[3] >> 7), (block[3] >> 3) & 0xF };
+            int v0 = (c0[0] << 8) | (c0[1] << 4) | c0[2];
+            int v1 = (c1[0] << 8) | (c1[1] << 4) | c1[2];
+            int dist = SW_ETC_DISTANCES[(block[3] & 4) | ((block[3] & 1) << 1) | (v0 >= v1)];
+
+            int paint[4][3];
+            for (int i = 0; i < 3; i++)
+            {
+                paint[0][i] = c0[i]*17 + dist;
+                paint[1][i] = c0[i]*17 - dist;
+                paint[2][i] = c1[i]*17 + dist;
+                paint[3][i] = c1[i]*17 - dist;
+            }
+            sw_block_write_etc_paint(texels, (const int (*)[3])paint, indices);
+            return;
+        }
+
+        if ((c[2] + d[2] < 0) || (c[2] + d[2] > 31))
+        {
+            // Planar mode, origin, horizontal and vertical colors (6:7:6 bits)
+            int o[3] = { (block[0] >> 1) & 0x3F, ((block[0] & 1) << 6) | ((block[1] >> 1) & 0x3F),
+                         ((block[1] & 1) << 5) | (block[2] & 0x18) | ((block[2] & 3) << 1) | (block[3] >> 7) };
+            int h[3] = { (((block[3] >> 2) & 0x1F) << 1) | (block[3] & 1), block[4] >> 1, ((block[4] & 1) << 5) | (block[5] >> 3) };
+            int v[3] = { ((block[5] & 7) << 3) | (block[6] >> 5), ((block[6] & 0x1F) << 2) | (block[7] >> 6), block[7] & 0x3F };
+
+            o[0] = (o[0] << 2) | (o[0] >> 4); o[1] = (o[1] << 1) | (o[1] >> 6); o[2] = (o[2] << 2) | (o[2] >> 4);
+            h[0] = (h[0] << 2) | (h[0] >> 4); h[1] = (h[1] << 1) | (h[1] >> 6); h[2] = (h[2] << 2) | (h[2] >> 4);
+            v[0] = (v[0] << 2) | (v[0] >> 4); v[1] = (v[1] << 1) | (v[1] >> 6); v[2] = (v[2] << 2) | (v[2] >> 4);
+
+            for (int y = 0; y < 4; y++)
+            {
+                for (int x = 0; x < 4; x++)
+                {
+                    uint8_t *texel = &texels[(y*4 + x)*4];
+                    for (int i = 0; i < 3; i++) texel[i] = sw_block_clamp8((x*(h[i] - o[i]) + y*(v[i] - o[i]) + 4*o[i] + 2) >> 2);
+                    texel[3] = 255;
+                }
+            }
+            return;
+        }
+
+        for (int i = 0; i < 3; i++)
+        {
+            base[0][i] = (c[i] << 3) | (c[i] >> 2);
+            base[1][i] = ((c[i] + d[i]) << 3) | ((c[i] + d[i]) >> 2);
+        }
+    }
+
+    // Individual and differential modes: two sub-blocks (2x4 or 4x2 when flipped) with a modifiers table each
+    const int *tables[2] = { SW_ETC_MODIFIERS[(block[3] >> 5) & 7], SW_ETC_MODIFIERS[(block[3] >> 2) & 7] };
+    bool flip = (block[3] & 1) != 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int x = i >> 2, y = i & 3;
+        int sub = flip? (y >> 1) : (x >> 1);
+        int index = (((indices >> (i + 16)) & 1) << 1) | ((indices >> i) & 1);
+        int modifier = tables[sub][index];
+
+        uint8_t *texel = &texels[(y*4 + x)*4];
+        texel[0] = sw_block_clamp8(base[sub][0] + modifier);
+        texel[1] = sw_block_clamp8(base[sub][1] + modifier);
+        texel[2] = sw_block_clamp8(base[sub][2] + modifier);
+        texel[3] = 255;
+    }
+}
+
+// Decode EAC alpha block (8 bytes), 3 bits indices per texel in column-major order
+static void sw_block_decode_eac_alpha(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block)
+{
+    int base = block[0];
+    int multiplier = block[1] >> 4;
+    const int *modifiers = SW_EAC_MODIFIERS[block[1] & 0xF];
+
+    uint64_t indices = 0;
+    for (int i = 2; i < 8; i++) indices = (indices << 8) | block[i];
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (int)(indices >> (45 - 3*i)) & 7;
+        texels[((i & 3)*4 + (i >> 2))*4 + 3] = sw_block_clamp8(base + modifiers[index]*multiplier);
+    }
+}
+
+static void sw_block_decode(uint8_t *SW_RESTRICT texels, const uint8_t *SW_RESTRICT block, sw_pixelformat_t format)
+{
+    switch (format)
+    {
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGB: sw_block_decode_dxt_color(texels, block, false, false); break;
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA: sw_block_decode_dxt_color(texels, block, false, true); break;
+        case SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        {
+            sw_block_decode_dxt_color(texels, block + 8, true, false);
+            sw_block_decode_dxt3_alpha(texels, block);
+        } break;
+        case SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        {
+            sw_block_decode_dxt_color(texels, block + 8, true, false);
+            sw_block_decode_dxt5_alpha(texels, block);
+        } break;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_RGB: sw_block_decode_etc2_color(texels, block); break;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        {
+            sw_block_decode_etc2_color(texels, block + 8);
+            sw_block_decode_eac_alpha(texels, block);
+        } break;
+        default: break;
+    }
+}
+
+// Get the decoded texels of a compressed block, decoded on cache miss
+// NOTE: Blocks are identified by address, caches are cleared after compressed textures uploads
+static inline const uint8_t *sw_block_cache_get(const uint8_t *block, sw_pixelformat_t format)
+{
+    sw_block_cache_t *cache = &RLSW_BLOCK_CACHE;
+
+    if (cache->epoch != RLSW_BLOCK_CACHE_EPOCH)
+    {
+        for (int i = 0; i < SW_BLOCK_CACHE_SIZE; i++) cache->blocks[i] = NULL;
+        cache->epoch = RLSW_BLOCK_CACHE_EPOCH;
+    }
+
+    // Blocks are 8 bytes aligned at least, Fibonacci hashing spreads texture rows of blocks
+    uint32_t index = ((((uint32_t)((uintptr_t)block >> 3))*2654435761u) >> 16) & (SW_BLOCK_CACHE_SIZE - 1);
+
+    if (cache->blocks[index] != block)
+    {
+        sw_block_decode(cache->texels[index], block, format);
+        cache->blocks[index] = block;
+    }
+
+    return cache->texels[index];
+}
+//-------------------------------------------------------------------------------------------
+
 // Pixel management functions
 //-------------------------------------------------------------------------------------------
 static inline int sw_pixel_get_format(SWformat format, SWtype type)
@@ -1743,6 +2478,18 @@ static inline bool sw_pixel_is_depth_format(sw_pixelformat_t format)
     return false;
 }
 
+static inline bool sw_pixel_is_compressed_format(sw_pixelformat_t format)
+{
+    return (SW_PIXELFORMAT_BLOCK_SIZE[format] > 0);
+}
+
+// Get the size in bytes of pixels data, count must be a multiple of 16 (4x4 blocks) for compressed formats
+static inline int sw_pixel_get_data_size(sw_pixelformat_t format, int count)
+{
+    if (sw_pixel_is_compressed_format(format)) return (count/16)*SW_PIXELFORMAT_BLOCK_SIZE[format];
+    return count*SW_PIXELFORMAT_SIZE[format];
+}
+
 static inline void sw_pixel_read_color8_GRAYSCALE(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
 {
     uint8_t gray = ((const uint8_t *)pixels)[offset];
@@ -1869,6 +2616,48 @@ static inline void sw_pixel_read_color8_R16G16B16A16(uint8_t *SW_RESTRICT color,
     color[3] = (uint8_t)(sw_half_to_float(src[3])*255.0f);
 }
 
+// Read a compressed format texel, offset is the texel offset in a tiled layout (see sw_texture_get_offset())
+// NOTE: Blocks are stored in tiles order, a tile of 16 texels is one block
+static inline void sw_pixel_read_color8_compressed(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset, sw_pixelformat_t format)
+{
+    const uint8_t *block = (const uint8_t *)pixels + (offset >> 4)*SW_PIXELFORMAT_BLOCK_SIZE[format];
+    const uint8_t *texel = sw_block_cache_get(block, format) + (offset & 15)*4;
+    color[0] = texel[0];
+    color[1] = texel[1];
+    color[2] = texel[2];
+    color[3] = texel[3];
+}
+
+static inline void sw_pixel_read_color8_DXT1_RGB(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_DXT1_RGB);
+}
+
+static inline void sw_pixel_read_color8_DXT1_RGBA(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA);
+}
+
+static inline void sw_pixel_read_color8_DXT3_RGBA(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA);
+}
+
+static inline void sw_pixel_read_color8_DXT5_RGBA(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA);
+}
+
+static inline void sw_pixel_read_color8_ETC2_RGB(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_ETC2_RGB);
+}
+
+static inline void sw_pixel_read_color8_ETC2_EAC_RGBA(uint8_t *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    sw_pixel_read_color8_compressed(color, pixels, offset, SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA);
+}
+
 static inline sw_pixel_read_color8_f sw_pixel_get_read_color8_func(sw_pixelformat_t format)
 {
     switch (format)
@@ -1887,6 +2676,12 @@ static inline sw_pixel_read_color8_f sw_pixel_get_read_color8_func(sw_pixelforma
         case SW_PIXELFORMAT_COLOR_R16: return sw_pixel_read_color8_R16;
         case SW_PIXELFORMAT_COLOR_R16G16B16: return sw_pixel_read_color8_R16G16B16;
         case SW_PIXELFORMAT_COLOR_R16G16B16A16: return sw_pixel_read_color8_R16G16B16A16;
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGB: return sw_pixel_read_color8_DXT1_RGB;
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return sw_pixel_read_color8_DXT1_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return sw_pixel_read_color8_DXT3_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return sw_pixel_read_color8_DXT5_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_RGB: return sw_pixel_read_color8_ETC2_RGB;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return sw_pixel_read_color8_ETC2_EAC_RGBA;
 
         case SW_PIXELFORMAT_UNKNOWN:
         case SW_PIXELFORMAT_DEPTH_D8:
@@ -2025,6 +2820,12 @@ static inline sw_pixel_write_color8_f sw_pixel_get_write_color8_func(sw_pixelfor
         case SW_PIXELFORMAT_COLOR_R16G16B16: return sw_pixel_write_color8_R16G16B16;
         case SW_PIXELFORMAT_COLOR_R16G16B16A16: return sw_pixel_write_color8_R16G16B16A16;
 
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
         case SW_PIXELFORMAT_UNKNOWN:
         case SW_PIXELFORMAT_DEPTH_D8:
         case SW_PIXELFORMAT_DEPTH_D16:
@@ -2149,24 +2950,72 @@ static inline void sw_pixel_read_color_R16G16B16A16(float *SW_RESTRICT color, co
     color[3] = sw_half_to_float(src[3]);
 }
 
-static inline sw_pixel_read_color_f sw_pixel_get_read_color_func(sw_pixelformat_t format)
+static inline void sw_pixel_read_color_DXT1_RGB(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
 {
-    switch (format)
-    {
-        case SW_PIXELFORMAT_COLOR_GRAYSCALE: return sw_pixel_read_color_GRAYSCALE;
-        case SW_PIXELFORMAT_COLOR_GRAYALPHA: return sw_pixel_read_color_GRAYALPHA;
-        case SW_PIXELFORMAT_COLOR_R3G3B2: return sw_pixel_read_color_R3G3B2;
-        case SW_PIXELFORMAT_COLOR_R5G6B5: return sw_pixel_read_color_R5G6B5;
-        case SW_PIXELFORMAT_COLOR_R8G8B8: return sw_pixel_read_color_R8G8B8;
-        case SW_PIXELFORMAT_COLOR_R5G5B5A1: return sw_pixel_read_color_R5G5B5A1;
-        case SW_PIXELFORMAT_COLOR_R4G4B4A4: return sw_pixel_read_color_R4G4B4A4;
-        case SW_PIXELFORMAT_COLOR_R8G8B8A8: return sw_pixel_read_color_R8G8B8A8;
-        case SW_PIXELFORMAT_COLOR_R32: return sw_pixel_read_color_R32;
+    uint8_t unpack[4];
+    sw_pixel_read_color8_DXT1_RGB(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline void sw_pixel_read_color_DXT1_RGBA(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    uint8_t unpack[4];
+    sw_pixel_read_color8_DXT1_RGBA(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline void sw_pixel_read_color_DXT3_RGBA(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    uint8_t unpack[4];
+    sw_pixel_read_color8_DXT3_RGBA(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline void sw_pixel_read_color_DXT5_RGBA(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    uint8_t unpack[4];
+    sw_pixel_read_color8_DXT5_RGBA(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline void sw_pixel_read_color_ETC2_RGB(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    uint8_t unpack[4];
+    sw_pixel_read_color8_ETC2_RGB(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline void sw_pixel_read_color_ETC2_EAC_RGBA(float *SW_RESTRICT color, const void *SW_RESTRICT pixels, uint32_t offset)
+{
+    uint8_t unpack[4];
+    sw_pixel_read_color8_ETC2_EAC_RGBA(unpack, pixels, offset);
+    sw_color8_to_color(color, unpack);
+}
+
+static inline sw_pixel_read_color_f sw_pixel_get_read_color_func(sw_pixelformat_t format)
+{
+    switch (format)
+    {
+        case SW_PIXELFORMAT_COLOR_GRAYSCALE: return sw_pixel_read_color_GRAYSCALE;
+        case SW_PIXELFORMAT_COLOR_GRAYALPHA: return sw_pixel_read_color_GRAYALPHA;
+        case SW_PIXELFORMAT_COLOR_R3G3B2: return sw_pixel_read_color_R3G3B2;
+        case SW_PIXELFORMAT_COLOR_R5G6B5: return sw_pixel_read_color_R5G6B5;
+        case SW_PIXELFORMAT_COLOR_R8G8B8: return sw_pixel_read_color_R8G8B8;
+        case SW_PIXELFORMAT_COLOR_R5G5B5A1: return sw_pixel_read_color_R5G5B5A1;
+        case SW_PIXELFORMAT_COLOR_R4G4B4A4: return sw_pixel_read_color_R4G4B4A4;
+        case SW_PIXELFORMAT_COLOR_R8G8B8A8: return sw_pixel_read_color_R8G8B8A8;
+        case SW_PIXELFORMAT_COLOR_R32: return sw_pixel_read_color_R32;
         case SW_PIXELFORMAT_COLOR_R32G32B32: return sw_pixel_read_color_R32G32B32;
         case SW_PIXELFORMAT_COLOR_R32G32B32A32: return sw_pixel_read_color_R32G32B32A32;
         case SW_PIXELFORMAT_COLOR_R16: return sw_pixel_read_color_R16;
         case SW_PIXELFORMAT_COLOR_R16G16B16: return sw_pixel_read_color_R16G16B16;
         case SW_PIXELFORMAT_COLOR_R16G16B16A16: return sw_pixel_read_color_R16G16B16A16;
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGB: return sw_pixel_read_color_DXT1_RGB;
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA: return sw_pixel_read_color_DXT1_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA: return sw_pixel_read_color_DXT3_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA: return sw_pixel_read_color_DXT5_RGBA;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_RGB: return sw_pixel_read_color_ETC2_RGB;
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return sw_pixel_read_color_ETC2_EAC_RGBA;
 
         case SW_PIXELFORMAT_UNKNOWN:
         case SW_PIXELFORMAT_DEPTH_D8:
@@ -2294,6 +3143,12 @@ static inline sw_pixel_write_color_f sw_pixel_get_write_color_func(sw_pixelforma
         case SW_PIXELFORMAT_COLOR_R16G16B16: return sw_pixel_write_color_R16G16B16;
         case SW_PIXELFORMAT_COLOR_R16G16B16A16: return sw_pixel_write_color_R16G16B16A16;
 
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
         case SW_PIXELFORMAT_UNKNOWN:
         case SW_PIXELFORMAT_DEPTH_D8:
         case SW_PIXELFORMAT_DEPTH_D16:
@@ -2336,13 +3191,274 @@ static inline void sw_pixel_write_depth_D32(void *pixels, float depth, uint32_t
 }
 //-------------------------------------------------------------------------------------------
 
+// Coarse depth buffer functionality
+//-------------------------------------------------------------------------------------------
+// NOTE: Depth buffers keep the maximum depth of every SW_DEPTH_TILE_SIZE square tile and of
+// every tile row, fragments further than the maximum fail the depth test, so primitives and
+// spans blocks are rejected before being interpolated. Depth test only lowers stored depths,
+// so maximums remain conservative (never lower than the depths) when they are not updated
+// on write: tiles maximums are lowered when tested, lines and points do not report writes
+#if SW_USE_DEPTH_TILES
+
+#if defined(RLSW_USE_RASTER_THREADS) && ((SW_RASTER_TILE_SIZE % SW_DEPTH_TILE_SIZE) != 0)
+    #error "SW_RASTER_TILE_SIZE must be a multiple of SW_DEPTH_TILE_SIZE, coarse depth tiles are updated by a single thread"
+#endif
+
+// Get the coarse depth tile containing a pixel: tile maximum depth, then every row maximum depth
+static inline float *sw_depth_tiles_get(const sw_texture_t *depth, int x, int y)
+{
+    int tile = (y/SW_DEPTH_TILE_SIZE)*depth->depthTilesX + x/SW_DEPTH_TILE_SIZE;
+    return depth->depthTiles + tile*(SW_DEPTH_TILE_SIZE + 1);
+}
+
+// Get the tile maximum depth from its rows maximum depths
+static inline void sw_depth_tiles_update_tile(float *tile, int rowCount)
+{
+    float tileMax = tile[1];
+    for (int i = 2; i <= rowCount; i++) if (tile[i] > tileMax) tileMax = tile[i];
+    tile[0] = tileMax;
+}
+
+// Allocate the coarse depth tiles of a depth buffer, all tiles set to a depth
+static bool sw_depth_tiles_alloc(sw_texture_t *depth, int w, int h, float value)
+{
+    int tilesX = (w + SW_DEPTH_TILE_SIZE - 1)/SW_DEPTH_TILE_SIZE;
+    int tilesY = (h + SW_DEPTH_TILE_SIZE - 1)/SW_DEPTH_TILE_SIZE;
+    int newSize = tilesX*tilesY*(SW_DEPTH_TILE_SIZE + 1);
+
+    if (newSize > depth->depthTilesSz)
+    {
+        float *ptr = SW_REALLOC(depth->depthTiles, newSize*sizeof(float));
+        if (!ptr) { RLSW.errCode = SW_OUT_OF_MEMORY; return false; }
+        depth->depthTilesSz = newSize;
+        depth->depthTiles = ptr;
+    }
+
+    for (int i = 0; i < newSize; i++) depth->depthTiles[i] = value;
+    depth->depthTilesX = tilesX;
+
+    return true;
+}
+
+// Update the coarse depth tiles after the pixels of a rectangle are set to a depth
+// NOTE: Rectangle bounds are inclusive, rows partially covered keep the highest depth
+static void sw_depth_tiles_fill(sw_texture_t *depth, float value, int xMin, int yMin, int xMax, int yMax)
+{
+    for (int ty = yMin/SW_DEPTH_TILE_SIZE; ty <= yMax/SW_DEPTH_TILE_SIZE; ty++)
+    {
+        int y0 = ty*SW_DEPTH_TILE_SIZE;
+        int rowCount = depth->height - y0;
+        if (rowCount > SW_DEPTH_TILE_SIZE) rowCount = SW_DEPTH_TILE_SIZE;
+
+        int rowStart = ((yMin > y0)? yMin : y0) - y0;
+        int rowEnd = ((yMax < y0 + rowCount - 1)? yMax : y0 + rowCount - 1) - y0;
+
+        for (int tx = xMin/SW_DEPTH_TILE_SIZE; tx <= xMax/SW_DEPTH_TILE_SIZE; tx++)
+        {
+            int x0 = tx*SW_DEPTH_TILE_SIZE;
+            int x1 = ((x0 + SW_DEPTH_TILE_SIZE < depth->width)? x0 + SW_DEPTH_TILE_SIZE : depth->width) - 1;
+            bool fullRows = ((xMin <= x0) && (xMax >= x1));
+
+            float *tile = sw_depth_tiles_get(depth, x0, y0);
+            for (int i = rowStart; i <= rowEnd; i++)
+            {
+                if (fullRows || (value > tile[1 + i])) tile[1 + i] = value;
+            }
+
+            sw_depth_tiles_update_tile(tile, rowCount);
+        }
+    }
+}
+
+// Update the coarse depth tile row containing a pixel, after depths were written on the row
+// NOTE: Tile maximum is not lowered here but when tested, most updates do not require it
+static inline void sw_depth_tiles_update(sw_texture_t *depth, int x, int y)
+{
+    int xStart = (x/SW_DEPTH_TILE_SIZE)*SW_DEPTH_TILE_SIZE;
+    int xEnd = (xStart + SW_DEPTH_TILE_SIZE < depth->width)? xStart + SW_DEPTH_TILE_SIZE : depth->width;
+    const uint8_t *row = (const uint8_t *)depth->pixels + y*depth->width*SW_FRAMEBUFFER_DEPTH_SIZE;
+
+    float rowMax = SW_FRAMEBUFFER_DEPTH_GET(row, xStart);
+    for (int i = xStart + 1; i < xEnd; i++)
+    {
+        float d = SW_FRAMEBUFFER_DEPTH_GET(row, i);
+        if (d > rowMax) rowMax = d;
+    }
+
+    float *tileRow = sw_depth_tiles_get(depth, x, y) + 1 + y%SW_DEPTH_TILE_SIZE;
+    if (rowMax < *tileRow) *tileRow = rowMax;
+}
+
+// Check if fragments with a depth higher than zMin fail the depth test on a tile row
+static inline bool sw_depth_tiles_row_occluded(const sw_texture_t *depth, int x, int y, float zMin)
+{
+    const float *tile = sw_depth_tiles_get(depth, x, y);
+    return (zMin > tile[1 + y%SW_DEPTH_TILE_SIZE] + SW_DEPTH_TILE_EPSILON);
+}
+
+// Check if fragments with a depth higher than zMin fail the depth test on a rectangle
+// NOTE: Rectangle maximum bounds are exclusive, rectangle must not be empty
+static inline bool sw_depth_tiles_rect_occluded(sw_texture_t *depth, int xMin, int yMin, int xMax, int yMax, float zMin)
+{
+    zMin -= SW_DEPTH_TILE_EPSILON;
+
+    for (int ty = yMin/SW_DEPTH_TILE_SIZE; ty <= (yMax - 1)/SW_DEPTH_TILE_SIZE; ty++)
+    {
+        int rowCount = depth->height - ty*SW_DEPTH_TILE_SIZE;
+        if (rowCount > SW_DEPTH_TILE_SIZE) rowCount = SW_DEPTH_TILE_SIZE;
+
+        float *tile = sw_depth_tiles_get(depth, xMin, ty*SW_DEPTH_TILE_SIZE);
+        for (int tx = xMin/SW_DEPTH_TILE_SIZE; tx <= (xMax - 1)/SW_DEPTH_TILE_SIZE; tx++, tile += SW_DEPTH_TILE_SIZE + 1)
+        {
+            if (zMin > tile[0]) continue;
+
+            // Tile maximum is lowered from the rows maximums before giving up
+            sw_depth_tiles_update_tile(tile, rowCount);
+            if (!(zMin > tile[0])) return false;
+        }
+    }
+
+    return true;
+}
+
+#endif // SW_USE_DEPTH_TILES
+//-------------------------------------------------------------------------------------------
+
 // Texture functionality
 //-------------------------------------------------------------------------------------------
+// NOTE: Tiled textures levels are stored by 4x4 texels tiles, tiles in row-major order and texels
+// in row-major order inside a tile, levels dimensions are padded to complete tiles
+
+// Get the offset (in pixels) of a texture level row, relative to the level first pixel
+static inline uint32_t sw_texture_get_row_offset(const sw_texture_t *tex, const sw_texture_level_t *level, int y)
+{
+    if (tex->tiled) return (uint32_t)((((y >> 2)*level->tilesX) << 4) + ((y & 3) << 2));
+    return (uint32_t)(y*level->width);
+}
+
+// Get the offset (in pixels) of a texture level column, relative to the row offset
+static inline uint32_t sw_texture_get_column_offset(const sw_texture_t *tex, int x)
+{
+    if (tex->tiled) return (uint32_t)(((x >> 2) << 4) + (x & 3));
+    return (uint32_t)x;
+}
+
+// Get the offset (in pixels) of a texture level texel
+static inline uint32_t sw_texture_get_offset(const sw_texture_t *tex, const sw_texture_level_t *level, int x, int y)
+{
+    return level->offset + sw_texture_get_row_offset(tex, level, y) + sw_texture_get_column_offset(tex, x);
+}
+
+// Get the texels count stored for a texture level, padding of tiled levels included
+static inline uint32_t sw_texture_get_level_size(const sw_texture_t *tex, const sw_texture_level_t *level)
+{
+    if (tex->tiled) return (uint32_t)(level->tilesX*((level->height + 3) >> 2)) << 4;
+    return (uint32_t)(level->width*level->height);
+}
+
+// Define the texture mipmap levels [1, levelCount), stored one after another after the base level
+static inline void sw_texture_init_levels(sw_texture_t *texture, int levelCount)
+{
+    for (int i = 1; i < levelCount; i++)
+    {
+        const sw_texture_level_t *prev = &texture->levels[i - 1];
+        sw_texture_level_t *level = &texture->levels[i];
+
+        level->offset = prev->offset + sw_texture_get_level_size(texture, prev);
+        level->width = (prev->width > 1)? prev->width/2 : 1;
+        level->height = (prev->height > 1)? prev->height/2 : 1;
+        level->wMinus1 = level->width - 1;
+        level->hMinus1 = level->height - 1;
+        level->tilesX = (level->width + 3)/4;
+    }
+}
+
+// Copy rows of texels, stored linearly, into a texture level rectangle
+// NOTE: Texels are copied by runs of contiguous texels, up to a tile row for tiled textures
+static void sw_texture_write_rows(sw_texture_t *texture, const sw_texture_level_t *level,
+                                  int x, int y, int w, int h, const uint8_t *src, int srcStride)
+{
+    int bpp = SW_PIXELFORMAT_SIZE[texture->format];
+    uint8_t *pixels = (uint8_t *)texture->pixels;
+
+    for (int j = 0; j < h; j++, src += srcStride)
+    {
+        for (int i = 0; i < w; )
+        {
+            int run = texture->tiled? 4 - ((x + i) & 3) : w;
+            if (run > w - i) run = w - i;
+
+            uint8_t *dst = pixels + sw_texture_get_offset(texture, level, x + i, y + j)*bpp;
+            const uint8_t *srcRun = src + i*bpp;
+            for (int k = 0; k < run*bpp; k++) dst[k] = srcRun[k];
+
+            i += run;
+        }
+    }
+}
+
+// Store the texture texels linearly, rendered textures must be linear
+// NOTE: Mipmap levels defined are preserved, levels allocated after them are dropped
+static bool sw_texture_untile(sw_texture_t *texture)
+{
+    // Compressed textures blocks are tiles, they can't be rendered anyway
+    if (!texture->tiled || sw_pixel_is_compressed_format(texture->format)) return true;
+
+    int bpp = SW_PIXELFORMAT_SIZE[texture->format];
+    sw_texture_t tiled = *texture;
+
+    texture->tiled = false;
+    sw_texture_init_levels(texture, texture->levelCount);
+
+    const sw_texture_level_t *last = &texture->levels[texture->levelCount - 1];
+    int newSize = (last->offset + sw_texture_get_level_size(texture, last))*bpp;
+
+    uint8_t *pixels = SW_MALLOC(newSize);
+    if (!pixels)
+    {
+        *texture = tiled;
+        RLSW.errCode = SW_OUT_OF_MEMORY;
+        return false;
+    }
+
+    const uint8_t *src = (const uint8_t *)tiled.pixels;
+
+    for (int i = 0; i < texture->levelCount; i++)
+    {
+        const sw_texture_level_t *srcLevel = &tiled.levels[i];
+        uint8_t *dst = pixels + texture->levels[i].offset*bpp;
+
+        for (int y = 0; y < srcLevel->height; y++)
+        {
+            for (int x = 0; x < srcLevel->width; x++)
+            {
+                const uint8_t *texel = src + sw_texture_get_offset(&tiled, srcLevel, x, y)*bpp;
+                for (int k = 0; k < bpp; k++) dst[k] = texel[k];
+                dst += bpp;
+            }
+        }
+    }
+
+    SW_FREE(tiled.pixels);
+    texture->pixels = pixels;
+    texture->allocSz = newSize;
+
+    return true;
+}
+
 static inline bool sw_texture_alloc(sw_texture_t *texture, const void *data, int w, int h, sw_pixelformat_t format)
 {
     bool isDepth = sw_pixel_is_depth_format(format);
+    bool isCompressed = sw_pixel_is_compressed_format(format);
     int bpp = SW_PIXELFORMAT_SIZE[format];
-    int newSize = w*h*bpp;
+
+    // Framebuffers color buffers are rendered, they are kept linear
+    // NOTE: Compressed textures are always tiled, a tile is a compressed block
+    bool tiled = isCompressed || (SW_USE_TILED_TEXTURES && !isDepth &&
+                 (texture != &RLSW.framebuffer.color) && (texture != RLSW.colorBuffer));
+
+    int tilesX = (w + 3)/4;
+    int newSize = sw_pixel_get_data_size(format, tiled? (tilesX*((h + 3)/4)*16) : (w*h));
 
     if (newSize > texture->allocSz)
     {
@@ -2352,9 +3468,6 @@ static inline bool sw_texture_alloc(sw_texture_t *texture, const void *data, int
         texture->pixels = ptr;
     }
 
-    uint8_t *dst = texture->pixels;
-    const uint8_t *src = data;
-
     sw_pixel_read_color8_f readColor8 = NULL;
     sw_pixel_read_color_f readColor = NULL;
     if (!isDepth)
@@ -2363,16 +3476,52 @@ static inline bool sw_texture_alloc(sw_texture_t *texture, const void *data, int
         readColor = sw_pixel_get_read_color_func(format);
     }
 
+    texture->readColor8 = readColor8;
+    texture->readColor = readColor;
+    texture->format = format;
+    texture->tiled = tiled;
+    texture->isPOT = ((w & (w - 1)) == 0) && ((h & (h - 1)) == 0);
+    texture->width = w;
+    texture->height = h;
+    texture->wMinus1 = w - 1;
+    texture->hMinus1 = h - 1;
+    texture->tx = 1.0f/w;
+    texture->ty = 1.0f/h;
+
+    // Mipmap levels must be defined again for the new base level
+    texture->levels[0].offset = 0;
+    texture->levels[0].width = w;
+    texture->levels[0].height = h;
+    texture->levels[0].wMinus1 = w - 1;
+    texture->levels[0].hMinus1 = h - 1;
+    texture->levels[0].tilesX = tilesX;
+    texture->levelCount = 1;
+
+    uint8_t *dst = texture->pixels;
+    const uint8_t *src = data;
+
     sw_pixel_alpha_t pixelAlpha = SW_PIXELFORMAT_ALPHA[format];
     bool alphaFound = !data; // No data: assume transparency
 
-    if (data && !isDepth)
+    if (data && isCompressed)
     {
+        // Blocks are stored as provided, alpha is not looked for in blocks
         for (int i = 0; i < newSize; i++) dst[i] = src[i];
+        alphaFound = true;
+    }
+    else if (data && !isDepth)
+    {
+        if (tiled)
+        {
+            // Padding texels are never sampled, cleared to keep the texture contents defined
+            if (((w | h) & 3) != 0) for (int i = 0; i < newSize; i++) dst[i] = 0;
+            sw_texture_write_rows(texture, &texture->levels[0], 0, 0, w, h, src, w*bpp);
+        }
+        else for (int i = 0; i < w*h*bpp; i++) dst[i] = src[i];
 
         if (pixelAlpha != SW_PIXEL_ALPHA_NONE)
         {
-            for (int i = 0; i < newSize; i += bpp)
+            for (int i = 0; i < w*h*bpp; i += bpp)
             {
                 uint8_t color[4] = { 0 };
                 readColor8(color, &src[i], 0);
@@ -2385,16 +3534,112 @@ static inline bool sw_texture_alloc(sw_texture_t *texture, const void *data, int
         for (int i = 0; i < newSize; i++) dst[i] = 0;
     }
 
-    texture->readColor8 = readColor8;
-    texture->readColor = readColor;
-    texture->format = format;
     texture->alpha = alphaFound? pixelAlpha : SW_PIXEL_ALPHA_NONE;
-    texture->width = w;
-    texture->height = h;
-    texture->wMinus1 = w - 1;
-    texture->hMinus1 = h - 1;
-    texture->tx = 1.0f/w;
-    texture->ty = 1.0f/h;
+
+    // Blocks decoded from the previous pixels may be cached at the same address
+    if (isCompressed) RLSW_BLOCK_CACHE_EPOCH++;
+
+#if SW_USE_DEPTH_TILES
+    // Depth pixels are cleared to zero, coarse depth tiles as well
+    if (isDepth) return sw_depth_tiles_alloc(texture, w, h, 0.0f);
+#endif
+
+    return true;
+}
+
+// Get the mipmap levels count of a full mipmap chain, base level included
+static inline int sw_texture_get_max_levels(int w, int h)
+{
+    int count = 1;
+    for (int size = (w > h)? w : h; (size > 1) && (count < SW_MAX_MIPMAP_LEVELS); size /= 2) count++;
+
+    return count;
+}
+
+// Allocate the texture mipmap levels [0, levelCount), pixels of existing levels are preserved
+// NOTE: Levels count defined (texture->levelCount) is not modified
+static bool sw_texture_alloc_levels(sw_texture_t *texture, int levelCount)
+{
+    sw_texture_init_levels(texture, levelCount);
+
+    const sw_texture_level_t *last = &texture->levels[levelCount - 1];
+    int newSize = sw_pixel_get_data_size(texture->format, last->offset + sw_texture_get_level_size(texture, last));
+
+    if (newSize > texture->allocSz)
+    {
+        void *ptr = SW_REALLOC(texture->pixels, newSize);
+        if (!ptr) { RLSW.errCode = SW_OUT_OF_MEMORY; return false; }
+        texture->allocSz = newSize;
+        texture->pixels = ptr;
+    }
+
+    return true;
+}
+
+// Generate the full mipmap chain from the base level, 2x2 box filter
+// NOTE: Odd dimensions (NPOT textures) reuse the last row/column of the upper level
+static bool sw_texture_generate_mipmaps(sw_texture_t *texture)
+{
+    int levelCount = sw_texture_get_max_levels(texture->width, texture->height);
+    if (!sw_texture_alloc_levels(texture, levelCount)) return false;
+
+    sw_pixel_write_color_f writeColor = sw_pixel_get_write_color_func(texture->format);
+    int bpp = SW_PIXELFORMAT_SIZE[texture->format];
+
+    // Formats with independent 8 bit channels are averaged per byte, with exact rounding
+    bool isByteChannels = ((texture->format == SW_PIXELFORMAT_COLOR_GRAYSCALE) ||
+                           (texture->format == SW_PIXELFORMAT_COLOR_GRAYALPHA) ||
+                           (texture->format == SW_PIXELFORMAT_COLOR_R8G8B8) ||
+                           (texture->format == SW_PIXELFORMAT_COLOR_R8G8B8A8));
+
+    uint8_t *pixels = (uint8_t *)texture->pixels;
+
+    for (int i = 1; i < levelCount; i++)
+    {
+        const sw_texture_level_t *src = &texture->levels[i - 1];
+        const sw_texture_level_t *dst = &texture->levels[i];
+
+        for (int y = 0; y < dst->height; y++)
+        {
+            int sy0 = sw_clamp_int(2*y, 0, src->hMinus1);
+            int sy1 = sw_clamp_int(2*y + 1, 0, src->hMinus1);
+
+            for (int x = 0; x < dst->width; x++)
+            {
+                int sx0 = sw_clamp_int(2*x, 0, src->wMinus1);
+                int sx1 = sw_clamp_int(2*x + 1, 0, src->wMinus1);
+
+                uint32_t o00 = sw_texture_get_offset(texture, src, sx0, sy0);
+                uint32_t o10 = sw_texture_get_offset(texture, src, sx1, sy0);
+                uint32_t o01 = sw_texture_get_offset(texture, src, sx0, sy1);
+                uint32_t o11 = sw_texture_get_offset(texture, src, sx1, sy1);
+                uint32_t oDst = sw_texture_get_offset(texture, dst, x, y);
+
+                if (isByteChannels)
+                {
+                    for (int c = 0; c < bpp; c++)
+                    {
+                        int sum = pixels[o00*bpp + c] + pixels[o10*bpp + c] + pixels[o01*bpp + c] + pixels[o11*bpp + c];
+                        pixels[oDst*bpp + c] = (uint8_t)((sum + 2)/4);
+                    }
+                }
+                else
+                {
+                    float c00[4], c10[4], c01[4], c11[4];
+                    texture->readColor(c00, pixels, o00);
+                    texture->readColor(c10, pixels, o10);
+                    texture->readColor(c01, pixels, o01);
+                    texture->readColor(c11, pixels, o11);
+
+                    float color[4];
+                    for (int c = 0; c < 4; c++) color[c] = (c00[c] + c10[c] + c01[c] + c11[c])*0.25f;
+                    writeColor(pixels, color, oDst);
+                }
+            }
+        }
+    }
+
+    texture->levelCount = levelCount;
 
     return true;
 }
@@ -2402,26 +3647,69 @@ static inline bool sw_texture_alloc(sw_texture_t *texture, const void *data, int
 static inline void sw_texture_free(sw_texture_t *texture)
 {
     SW_FREE(texture->pixels);
+    SW_FREE(texture->depthTiles);
+}
+
+// Read a texel, reads are inlined for the common formats
+static inline void sw_texture_read(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex, uint32_t offset)
+{
+    switch (tex->format)
+    {
+        case SW_PIXELFORMAT_COLOR_GRAYSCALE: sw_pixel_read_color_GRAYSCALE(color, tex->pixels, offset); break;
+        case SW_PIXELFORMAT_COLOR_GRAYALPHA: sw_pixel_read_color_GRAYALPHA(color, tex->pixels, offset); break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8: sw_pixel_read_color_R8G8B8(color, tex->pixels, offset); break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8A8: sw_pixel_read_color_R8G8B8A8(color, tex->pixels, offset); break;
+        default: tex->readColor(color, tex->pixels, offset); break;
+    }
+}
+
+// Read the four texels of a bilinear quad, format dispatched once for the quad
+// NOTE: Quad texels are ordered (x0,y0), (x1,y0), (x0,y1), (x1,y1)
+static inline void sw_texture_read_quad(float (*SW_RESTRICT colors)[4], const sw_texture_t *SW_RESTRICT tex, const uint32_t *SW_RESTRICT offsets)
+{
+    const void *pixels = tex->pixels;
+
+    switch (tex->format)
+    {
+        case SW_PIXELFORMAT_COLOR_GRAYSCALE: for (int i = 0; i < 4; i++) sw_pixel_read_color_GRAYSCALE(colors[i], pixels, offsets[i]); break;
+        case SW_PIXELFORMAT_COLOR_GRAYALPHA: for (int i = 0; i < 4; i++) sw_pixel_read_color_GRAYALPHA(colors[i], pixels, offsets[i]); break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8: for (int i = 0; i < 4; i++) sw_pixel_read_color_R8G8B8(colors[i], pixels, offsets[i]); break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8A8: for (int i = 0; i < 4; i++) sw_pixel_read_color_R8G8B8A8(colors[i], pixels, offsets[i]); break;
+        default: for (int i = 0; i < 4; i++) tex->readColor(colors[i], pixels, offsets[i]); break;
+    }
 }
 
-static inline void sw_texture_sample_nearest(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex, float u, float v)
+// Get offset of the texel selected by nearest filtering
+// NOTE: Shared by float and fixed-point pipelines, so both select the same texels
+static inline uint32_t sw_texture_get_nearest_offset(const sw_texture_t *SW_RESTRICT tex, const sw_texture_level_t *SW_RESTRICT level, float u, float v)
 {
     u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
     v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
 
-    int x = u*tex->width;
-    int y = v*tex->height;
+    int x = u*level->width;
+    int y = v*level->height;
+
+    // Clamped coordinates can reach the level size
+    x = (x > level->wMinus1)? level->wMinus1 : x;
+    y = (y > level->hMinus1)? level->hMinus1 : y;
+
+    return sw_texture_get_offset(tex, level, x, y);
+}
 
-    tex->readColor(color, tex->pixels, y*tex->width + x);
+static inline void sw_texture_sample_nearest(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex,
+                                             const sw_texture_level_t *SW_RESTRICT level, float u, float v)
+{
+    sw_texture_read(color, tex, sw_texture_get_nearest_offset(tex, level, u, v));
 }
 
-static inline void sw_texture_sample_linear(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex, float u, float v)
+static inline void sw_texture_sample_linear(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex,
+                                            const sw_texture_level_t *SW_RESTRICT level, float u, float v)
 {
     // TODO: With a bit more cleverness the number of operations can
     // be clearly reduced, but for now it works fine
 
-    float xf = (u*tex->width) - 0.5f;
-    float yf = (v*tex->height) - 0.5f;
+    float xf = (u*level->width) - 0.5f;
+    float yf = (v*level->height) - 0.5f;
 
     float fx = sw_fract(xf);
     float fy = sw_fract(yf);
@@ -2432,77 +3720,143 @@ static inline void sw_texture_sample_linear(float *SW_RESTRICT color, const sw_t
     int x1 = x0 + 1;
     int y1 = y0 + 1;
 
-    // NOTE: If the textures are POT, avoid the division for SW_REPEAT
+    // NOTE: POT textures levels are wrapped with a mask for SW_REPEAT, no division
 
     if (tex->sWrap == SW_CLAMP)
     {
-        x0 = (x0 > tex->wMinus1)? tex->wMinus1 : x0;
-        x1 = (x1 > tex->wMinus1)? tex->wMinus1 : x1;
+        x0 = sw_clamp_int(x0, 0, level->wMinus1);
+        x1 = sw_clamp_int(x1, 0, level->wMinus1);
+    }
+    else if (tex->isPOT)
+    {
+        x0 &= level->wMinus1;
+        x1 &= level->wMinus1;
     }
     else
     {
-        x0 = (x0%tex->width + tex->width)%tex->width;
-        x1 = (x1%tex->width + tex->width)%tex->width;
+        x0 = (x0%level->width + level->width)%level->width;
+        x1 = (x1%level->width + level->width)%level->width;
     }
 
     if (tex->tWrap == SW_CLAMP)
     {
-        y0 = (y0 > tex->hMinus1)? tex->hMinus1 : y0;
-        y1 = (y1 > tex->hMinus1)? tex->hMinus1 : y1;
+        y0 = sw_clamp_int(y0, 0, level->hMinus1);
+        y1 = sw_clamp_int(y1, 0, level->hMinus1);
+    }
+    else if (tex->isPOT)
+    {
+        y0 &= level->hMinus1;
+        y1 &= level->hMinus1;
     }
     else
     {
-        y0 = (y0%tex->height + tex->height)%tex->height;
-        y1 = (y1%tex->height + tex->height)%tex->height;
+        y0 = (y0%level->height + level->height)%level->height;
+        y1 = (y1%level->height + level->height)%level->height;
     }
 
-    float c00[4], c10[4], c01[4], c11[4];
-    tex->readColor(c00, tex->pixels, y0*tex->width + x0);
-    tex->readColor(c10, tex->pixels, y0*tex->width + x1);
-    tex->readColor(c01, tex->pixels, y1*tex->width + x0);
-    tex->readColor(c11, tex->pixels, y1*tex->width + x1);
+    uint32_t row0 = level->offset + sw_texture_get_row_offset(tex, level, y0);
+    uint32_t row1 = level->offset + sw_texture_get_row_offset(tex, level, y1);
+    uint32_t col0 = sw_texture_get_column_offset(tex, x0);
+    uint32_t col1 = sw_texture_get_column_offset(tex, x1);
+
+    uint32_t offsets[4] = { row0 + col0, row0 + col1, row1 + col0, row1 + col1 };
+    float c[4][4];
+    sw_texture_read_quad(c, tex, offsets);
 
     for (int i = 0; i < 4; i++)
     {
-        float t = c00[i] + fx*(c10[i] - c00[i]);
-        float b = c01[i] + fx*(c11[i] - c01[i]);
+        float t = c[0][i] + fx*(c[1][i] - c[0][i]);
+        float b = c[2][i] + fx*(c[3][i] - c[2][i]);
         color[i] = t + fy*(b - t);
     }
 }
 
-static inline void sw_texture_sample(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex,
-                                     float u, float v, float dUdx, float dUdy, float dVdx, float dVdy)
+// Get the texture level of detail, log2 of the texels covered by a pixel
+// NOTE: Derivatives are texture coordinates variation for one pixel step in screen space,
+// magnification is required for a level of detail <= 0
+static inline float sw_texture_get_lod(const sw_texture_t *tex, float dUdx, float dUdy, float dVdx, float dVdy)
 {
-    // NOTE: Commented there is the previous method used
-    // There was no need to compute the square root because
-    // using the squared value, the comparison remains (L2 > 1.0f*1.0f)
-    //float du = sqrtf(dUdx*dUdx + dUdy*dUdy);
-    //float dv = sqrtf(dVdx*dVdx + dVdy*dVdy);
-    //float L = (du > dv)? du : dv;
+    // Same filtering on minification and magnification, no mipmaps sampled
+    if (tex->minFilter == tex->magFilter) return 0.0f;
 
-    // Calculate the derivatives for each axis
-    float dU2 = dUdx*dUdx + dUdy*dUdy;
-    float dV2 = dVdx*dVdx + dVdy*dVdy;
-    float L2 = (dU2 > dV2)? dU2 : dV2;
+    float w = (float)tex->width;
+    float h = (float)tex->height;
 
-    SWfilter filter = (L2 > 1.0f)? tex->minFilter : tex->magFilter;
+    float dx2 = (dUdx*dUdx)*(w*w) + (dVdx*dVdx)*(h*h);
+    float dy2 = (dUdy*dUdy)*(w*w) + (dVdy*dVdy)*(h*h);
+    float rho2 = (dx2 > dy2)? dx2 : dy2;
 
-    switch (filter)
-    {
-        case SW_NEAREST: sw_texture_sample_nearest(color, tex, u, v); break;
-        case SW_LINEAR: sw_texture_sample_linear(color, tex, u, v); break;
-        default: break;
-    }
+    // NOTE: Squared scale factor is used, log2(sqrt(x)) = 0.5*log2(x)
+    return (rho2 > 1.0f)? 0.5f*log2f(rho2) : 0.0f;
 }
-//-------------------------------------------------------------------------------------------
 
-// Framebuffer management functions
-//-------------------------------------------------------------------------------------------
-static inline bool sw_default_framebuffer_alloc(sw_default_framebuffer_t *fb, int w, int h)
+static inline void sw_texture_sample(float *SW_RESTRICT color, const sw_texture_t *SW_RESTRICT tex, float u, float v, float lod)
 {
-    if (!sw_texture_alloc(&fb->color, NULL, w, h, SW_FRAMEBUFFER_COLOR_FORMAT))
+    const sw_texture_level_t *levels = tex->levels;
+
+    if (lod <= 0.0f)
     {
-        return false;
+        if (tex->magFilter == SW_LINEAR) sw_texture_sample_linear(color, tex, &levels[0], u, v);
+        else sw_texture_sample_nearest(color, tex, &levels[0], u, v);
+        return;
+    }
+
+    int lastLevel = tex->levelCount - 1;
+
+    switch (tex->minFilter)
+    {
+        case SW_NEAREST: sw_texture_sample_nearest(color, tex, &levels[0], u, v); break;
+        case SW_LINEAR: sw_texture_sample_linear(color, tex, &levels[0], u, v); break;
+        case SW_NEAREST_MIPMAP_NEAREST:
+        case SW_LINEAR_MIPMAP_NEAREST:
+        {
+            int level = (int)(lod + 0.5f);
+            if (level > lastLevel) level = lastLevel;
+
+            if (tex->minFilter == SW_LINEAR_MIPMAP_NEAREST) sw_texture_sample_linear(color, tex, &levels[level], u, v);
+            else sw_texture_sample_nearest(color, tex, &levels[level], u, v);
+        } break;
+        case SW_NEAREST_MIPMAP_LINEAR:
+        case SW_LINEAR_MIPMAP_LINEAR:
+        {
+            bool linear = (tex->minFilter == SW_LINEAR_MIPMAP_LINEAR);
+
+            int level = (int)lod;
+            if (level >= lastLevel)
+            {
+                if (linear) sw_texture_sample_linear(color, tex, &levels[lastLevel], u, v);
+                else sw_texture_sample_nearest(color, tex, &levels[lastLevel], u, v);
+                break;
+            }
+
+            // Blend the two nearest levels
+            float c0[4], c1[4];
+            if (linear)
+            {
+                sw_texture_sample_linear(c0, tex, &levels[level], u, v);
+                sw_texture_sample_linear(c1, tex, &levels[level + 1], u, v);
+            }
+            else
+            {
+                sw_texture_sample_nearest(c0, tex, &levels[level], u, v);
+                sw_texture_sample_nearest(c1, tex, &levels[level + 1], u, v);
+            }
+
+            float f = lod - (float)level;
+            for (int i = 0; i < 4; i++) color[i] = c0[i] + f*(c1[i] - c0[i]);
+        } break;
+        default: break;
+    }
+}
+//-------------------------------------------------------------------------------------------
+
+// Framebuffer management functions
+//-------------------------------------------------------------------------------------------
+static inline bool sw_default_framebuffer_alloc(sw_default_framebuffer_t *fb, int w, int h)
+{
+    if (!sw_texture_alloc(&fb->color, NULL, w, h, SW_FRAMEBUFFER_COLOR_FORMAT))
+    {
+        return false;
     }
 
     if (!sw_texture_alloc(&fb->depth, NULL, w, h, SW_FRAMEBUFFER_DEPTH_FORMAT))
@@ -2519,169 +3873,344 @@ static inline void sw_default_framebuffer_free(sw_default_framebuffer_t *fb)
     sw_texture_free(&fb->depth);
 }
 
-static inline void sw_framebuffer_fill_color(sw_texture_t *colorBuffer, const float color[4])
+// Pixel rows kernels, used on framebuffer clear, read and blit
+// NOTE: Source and destination rows are not required to be aligned
+#define SW_FILL_PATTERN_SIZE    96      // Multiple of all pixel sizes (1, 2, 3, 4) and SIMD registers size
+#define SW_BLIT_CHUNK_PIXELS    256     // Pixels gathered per step on scaled blit
+
+// Repeat pixel into fill pattern
+static inline void sw_pixels_fill_pattern(uint8_t *SW_RESTRICT pattern, const uint8_t *SW_RESTRICT pixel, int pixelSize)
 {
-    // NOTE: MSVC doesn't support VLA, so the largest possible size is allocated: 16 bytes
-    //uint8_t pixel[SW_FRAMEBUFFER_COLOR_SIZE] = { 0 };
-    uint8_t pixel[16] = { 0 };
-    SW_FRAMEBUFFER_COLOR_SET(pixel, color, 0);
+    for (int i = 0; i < SW_FILL_PATTERN_SIZE; i++) pattern[i] = pixel[i%pixelSize];
+}
 
-    uint8_t *dst = (uint8_t *)colorBuffer->pixels;
+// Fill bytes with fill pattern, destination must start on a pixel boundary
+static inline void sw_pixels_fill(uint8_t *SW_RESTRICT dst, size_t size, const uint8_t *SW_RESTRICT pattern)
+{
+    size_t i = 0;
 
-    if (RLSW.userState & SW_STATE_SCISSOR_TEST)
+#if defined(SW_SIMD_AVX2)
+    __m256i p0 = _mm256_loadu_si256((const __m256i *)pattern);
+    __m256i p1 = _mm256_loadu_si256((const __m256i *)(pattern + 32));
+    __m256i p2 = _mm256_loadu_si256((const __m256i *)(pattern + 64));
+    for (; i + SW_FILL_PATTERN_SIZE <= size; i += SW_FILL_PATTERN_SIZE)
+    {
+        _mm256_storeu_si256((__m256i *)(dst + i), p0);
+        _mm256_storeu_si256((__m256i *)(dst + i + 32), p1);
+        _mm256_storeu_si256((__m256i *)(dst + i + 64), p2);
+    }
+#elif defined(SW_SIMD_SSE2)
+    __m128i p[6];
+    for (int k = 0; k < 6; k++) p[k] = _mm_loadu_si128((const __m128i *)(pattern + k*16));
+    for (; i + SW_FILL_PATTERN_SIZE <= size; i += SW_FILL_PATTERN_SIZE)
+    {
+        for (int k = 0; k < 6; k++) _mm_storeu_si128((__m128i *)(dst + i + k*16), p[k]);
+    }
+#elif defined(SW_SIMD_NEON)
+    uint8x16_t p[6];
+    for (int k = 0; k < 6; k++) p[k] = vld1q_u8(pattern + k*16);
+    for (; i + SW_FILL_PATTERN_SIZE <= size; i += SW_FILL_PATTERN_SIZE)
+    {
+        for (int k = 0; k < 6; k++) vst1q_u8(dst + i + k*16, p[k]);
+    }
+#else
+    for (; i + SW_FILL_PATTERN_SIZE <= size; i += SW_FILL_PATTERN_SIZE)
     {
-        int xMin = sw_clamp_int(RLSW.scMin[0], 0, colorBuffer->width - 1);
-        int xMax = sw_clamp_int(RLSW.scMax[0], 0, colorBuffer->width - 1);
-        int yMin = sw_clamp_int(RLSW.scMin[1], 0, colorBuffer->height - 1);
-        int yMax = sw_clamp_int(RLSW.scMax[1], 0, colorBuffer->height - 1);
+        for (int k = 0; k < SW_FILL_PATTERN_SIZE; k++) dst[i + k] = pattern[k];
+    }
+#endif
 
-        int w = xMax - xMin;
-        for (int y = yMin; y <= yMax; y++)
-        {
-            uint8_t *row = dst + (y*colorBuffer->width + xMin)*SW_FRAMEBUFFER_COLOR_SIZE;
-            for (int x = 0; x <= w; x++, row += SW_FRAMEBUFFER_COLOR_SIZE)
-            {
-                for (int b = 0; b < SW_FRAMEBUFFER_COLOR_SIZE; b++) row[b] = pixel[b];
-            }
-        }
+    for (int k = 0; i < size; i++, k++) dst[i] = pattern[k];
+}
+
+static inline void sw_pixels_copy(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, size_t size)
+{
+    for (size_t i = 0; i < size; i++) dst[i] = src[i];
+}
+
+// Copy R8G8B8A8 pixels swapping red and blue channels
+static inline void sw_pixels_swap_rb_rgba8(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, int count)
+{
+    int i = 0;
+
+#if defined(SW_SIMD_AVX2)
+    const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                             2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + i*4));
+        _mm256_storeu_si256((__m256i *)(dst + i*4), _mm256_shuffle_epi8(v, shuffle));
     }
-    else
+#elif defined(SW_SIMD_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for (; i + 4 <= count; i += 4)
     {
-        int size = colorBuffer->width*colorBuffer->height;
-        for (int i = 0; i < size; i++)
-        {
-            for (int b = 0; b < SW_FRAMEBUFFER_COLOR_SIZE; b++)
-            {
-                dst[i*SW_FRAMEBUFFER_COLOR_SIZE + b] = pixel[b];
-            }
-        }
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i*4));
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_shuffle_epi8(v, shuffle));
+    }
+#elif defined(SW_SIMD_SSE2)
+    const __m128i maskGA = _mm_set1_epi32((int)0xff00ff00);
+    const __m128i maskRB = _mm_set1_epi32(0x00ff00ff);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i rb = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(v, 16), _mm_slli_epi32(v, 16)), maskRB);
+        _mm_storeu_si128((__m128i *)(dst + i*4), _mm_or_si128(_mm_and_si128(v, maskGA), rb));
+    }
+#elif defined(SW_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        uint8x16_t r = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = r;
+        vst4q_u8(dst + i*4, v);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        uint32_t v = ((const uint32_t *)src)[i];
+        ((uint32_t *)dst)[i] = (v & 0xff00ff00) | ((v >> 16) & 0xff) | ((v & 0xff) << 16);
     }
 }
 
-static inline void sw_framebuffer_fill_depth(sw_texture_t *depthBuffer, float depth)
+// Convert R8G8B8A8 pixels to R8G8B8, optionally swapping red and blue channels
+static inline void sw_pixels_rgba8_to_rgb8(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, int count, bool swapRB)
 {
-    // NOTE: MSVC doesn't support VLA, so the largest possible size is allocated: 4 bytes
-    //uint8_t pixel[SW_FRAMEBUFFER_DEPTH_SIZE] = { 0 };
-    uint8_t pixel[4] = { 0 };
-    SW_FRAMEBUFFER_DEPTH_SET(pixel, depth, 0);
+    int i = 0;
+    int r = swapRB? 2 : 0;
+    int b = swapRB? 0 : 2;
 
-    uint8_t *dst = (uint8_t *)depthBuffer->pixels;
+#if defined(SW_SIMD_SSSE3) || defined(SW_SIMD_AVX2)
+    // NOTE: Every store writes 16 bytes but only 12 are valid, next store overwrites the remaining ones
+    const __m128i shuffle = _mm_setr_epi8((char)r, 1, (char)b, (char)(4 + r), 5, (char)(4 + b), (char)(8 + r), 9, (char)(8 + b),
+                                          (char)(12 + r), 13, (char)(12 + b), -1, -1, -1, -1);
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i*4));
+        _mm_storeu_si128((__m128i *)(dst + i*3), _mm_shuffle_epi8(v, shuffle));
+    }
+#elif defined(SW_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        uint8x16x3_t o = { { v.val[r], v.val[1], v.val[b] } };
+        vst3q_u8(dst + i*3, o);
+    }
+#endif
 
-    if (RLSW.userState & SW_STATE_SCISSOR_TEST)
+    for (; i < count; i++)
     {
-        int xMin = sw_clamp_int(RLSW.scMin[0], 0, depthBuffer->width - 1);
-        int xMax = sw_clamp_int(RLSW.scMax[0], 0, depthBuffer->width - 1);
-        int yMin = sw_clamp_int(RLSW.scMin[1], 0, depthBuffer->height - 1);
-        int yMax = sw_clamp_int(RLSW.scMax[1], 0, depthBuffer->height - 1);
+        const uint8_t *s = src + i*4;
+        uint8_t *d = dst + i*3;
+        d[0] = s[r];
+        d[1] = s[1];
+        d[2] = s[b];
+    }
+}
+
+// Convert R8G8B8A8 pixels to R5G6B5, truncating as sw_pixel_write_color8_R5G6B5()
+static inline void sw_pixels_rgba8_to_r5g6b5(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, int count)
+{
+    int i = 0;
 
-        int w = xMax - xMin;
-        for (int y = yMin; y <= yMax; y++)
+#if defined(SW_SIMD_SSE2)
+    const __m128i maskR = _mm_set1_epi32(0xf8);
+    const __m128i maskG = _mm_set1_epi32(0xfc00);
+    const __m128i maskB = _mm_set1_epi32(0xf80000);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + i*4 + 16));
+
+        __m128i p0 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v0, maskR), 8),
+            _mm_srli_epi32(_mm_and_si128(v0, maskG), 5)), _mm_srli_epi32(_mm_and_si128(v0, maskB), 19));
+        __m128i p1 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v1, maskR), 8),
+            _mm_srli_epi32(_mm_and_si128(v1, maskG), 5)), _mm_srli_epi32(_mm_and_si128(v1, maskB), 19));
+
+        // Sign extend 16-bit values so signed saturation keeps them unchanged
+        p0 = _mm_srai_epi32(_mm_slli_epi32(p0, 16), 16);
+        p1 = _mm_srai_epi32(_mm_slli_epi32(p1, 16), 16);
+        _mm_storeu_si128((__m128i *)(dst + i*2), _mm_packs_epi32(p0, p1));
+    }
+#elif defined(SW_SIMD_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        uint16x8_t lo = vshll_n_u8(vget_low_u8(v.val[0]), 8);
+        uint16x8_t hi = vshll_n_u8(vget_high_u8(v.val[0]), 8);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(v.val[1]), 8), 5);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(v.val[1]), 8), 5);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(v.val[2]), 8), 11);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(v.val[2]), 8), 11);
+        vst1q_u16((uint16_t *)(dst + i*2), lo);
+        vst1q_u16((uint16_t *)(dst + i*2 + 16), hi);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        uint32_t v = ((const uint32_t *)src)[i];
+        ((uint16_t *)dst)[i] = (uint16_t)(((v & 0xf8) << 8) | ((v >> 5) & 0x7e0) | ((v >> 19) & 0x1f));
+    }
+}
+
+// Convert framebuffer pixels to output format, red and blue channels are swapped
+// on R8G8B8A8 and R8G8B8 outputs when SW_FRAMEBUFFER_OUTPUT_BGRA is enabled
+// NOTE: Framebuffer format is a constant, only the kernels for that format are compiled in
+static inline void sw_framebuffer_convert_row(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, int count, sw_pixelformat_t format)
+{
+    if (SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8A8)
+    {
+        switch (format)
         {
-            uint8_t *row = dst + (y*depthBuffer->width + xMin)*SW_FRAMEBUFFER_DEPTH_SIZE;
-            for (int x = 0; x <= w; x++, row += SW_FRAMEBUFFER_DEPTH_SIZE)
+            case SW_PIXELFORMAT_COLOR_R8G8B8A8:
             {
-                for (int b = 0; b < SW_FRAMEBUFFER_DEPTH_SIZE; b++) row[b] = pixel[b];
-            }
+                if (SW_FRAMEBUFFER_OUTPUT_BGRA) sw_pixels_swap_rb_rgba8(dst, src, count);
+                else sw_pixels_copy(dst, src, (size_t)count*4);
+            } return;
+            case SW_PIXELFORMAT_COLOR_R8G8B8: sw_pixels_rgba8_to_rgb8(dst, src, count, SW_FRAMEBUFFER_OUTPUT_BGRA); return;
+            case SW_PIXELFORMAT_COLOR_R5G6B5: sw_pixels_rgba8_to_r5g6b5(dst, src, count); return;
+            default: break;
         }
     }
-    else
+    else if ((format == SW_FRAMEBUFFER_COLOR_FORMAT) && !(SW_FRAMEBUFFER_OUTPUT_BGRA && (format == SW_PIXELFORMAT_COLOR_R8G8B8)))
     {
-        int size = depthBuffer->width*depthBuffer->height;
-        for (int i = 0; i < size; i++)
+        sw_pixels_copy(dst, src, (size_t)count*SW_FRAMEBUFFER_COLOR_SIZE);
+        return;
+    }
+
+    // Generic conversion, pixel by pixel
+    int dstPixelSize = SW_PIXELFORMAT_SIZE[format];
+    sw_pixel_write_color8_f setColor8 = sw_pixel_get_write_color8_func(format);
+
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t color[4];
+        SW_FRAMEBUFFER_COLOR8_GET(color, src, i);
+
+        #if SW_FRAMEBUFFER_OUTPUT_BGRA
+        if (format == SW_PIXELFORMAT_COLOR_R8G8B8A8 || format == SW_PIXELFORMAT_COLOR_R8G8B8)
         {
-            for (int b = 0; b < SW_FRAMEBUFFER_DEPTH_SIZE; b++)
-            {
-                dst[i*SW_FRAMEBUFFER_DEPTH_SIZE + b] = pixel[b];
-            }
+            uint8_t tmp = color[0]; color[0] = color[2]; color[2] = tmp;
         }
+        #endif
+
+        setColor8(dst, color, 0);
+        dst += dstPixelSize;
     }
 }
 
-static inline void sw_framebuffer_output_fast(void *dst, const sw_texture_t *buffer)
+// Get the framebuffer buffer rectangle filled on clear, scissor test considered
+// NOTE: Rectangle bounds are inclusive, returns false if the rectangle is empty
+static inline bool sw_framebuffer_get_fill_rect(const sw_texture_t *buffer, int *xMin, int *yMin, int *xMax, int *yMax)
 {
-    int width = buffer->width;
-    int height = buffer->height;
+    if (RLSW.userState & SW_STATE_SCISSOR_TEST)
+    {
+        *xMin = sw_clamp_int(RLSW.scMin[0], 0, buffer->width - 1);
+        *xMax = sw_clamp_int(RLSW.scMax[0], 0, buffer->width - 1);
+        *yMin = sw_clamp_int(RLSW.scMin[1], 0, buffer->height - 1);
+        *yMax = sw_clamp_int(RLSW.scMax[1], 0, buffer->height - 1);
+    }
+    else
+    {
+        *xMin = 0;
+        *yMin = 0;
+        *xMax = buffer->width - 1;
+        *yMax = buffer->height - 1;
+    }
 
-    uint8_t *d = (uint8_t *)dst;
+    return ((*xMax >= *xMin) && (*yMax >= *yMin));
+}
+
+// Fill framebuffer buffer with a pixel value, scissor test considered
+static inline void sw_framebuffer_fill(sw_texture_t *buffer, const uint8_t *pixel, int pixelSize)
+{
+    int xMin, yMin, xMax, yMax;
+    if (!sw_framebuffer_get_fill_rect(buffer, &xMin, &yMin, &xMax, &yMax)) return;
 
-#if SW_FRAMEBUFFER_OUTPUT_BGRA && (SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8A8)
-    for (int y = height - 1; y >= 0; y--)
+    uint8_t pattern[SW_FILL_PATTERN_SIZE];
+    sw_pixels_fill_pattern(pattern, pixel, pixelSize);
+
+    uint8_t *dst = (uint8_t *)buffer->pixels;
+    size_t rowSize = (size_t)buffer->width*pixelSize;
+
+    if ((xMin == 0) && (xMax == buffer->width - 1))
     {
-        const uint8_t *src = (uint8_t *)(buffer->pixels) + y*width*4;
-        for (int x = 0; x < width; x++, src += 4, d += 4)
-        {
-            d[0] = src[2];
-            d[1] = src[1];
-            d[2] = src[0];
-            d[3] = src[3];
-        }
+        // Full width rows are contiguous
+        sw_pixels_fill(dst + yMin*rowSize, (yMax - yMin + 1)*rowSize, pattern);
     }
-#elif SW_FRAMEBUFFER_OUTPUT_BGRA && (SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8)
-    for (int y = height - 1; y >= 0; y--)
+    else
     {
-        const uint8_t *src = (uint8_t *)(buffer->pixels) + y*width*3;
-        for (int x = 0; x < width; x++, src += 3, d += 3)
-        {
-            d[0] = src[2];
-            d[1] = src[1];
-            d[2] = src[0];
-        }
+        size_t size = (size_t)(xMax - xMin + 1)*pixelSize;
+        for (int y = yMin; y <= yMax; y++) sw_pixels_fill(dst + y*rowSize + (size_t)xMin*pixelSize, size, pattern);
     }
-#else
-    int rowBytes = width*SW_FRAMEBUFFER_COLOR_SIZE;
-    for (int y = height - 1; y >= 0; y--)
+}
+
+static inline void sw_framebuffer_fill_color(sw_texture_t *colorBuffer, const float color[4])
+{
+    // NOTE: MSVC doesn't support VLA, so the largest possible size is allocated: 16 bytes
+    //uint8_t pixel[SW_FRAMEBUFFER_COLOR_SIZE] = { 0 };
+    uint8_t pixel[16] = { 0 };
+    SW_FRAMEBUFFER_COLOR_SET(pixel, color, 0);
+
+    sw_framebuffer_fill(colorBuffer, pixel, SW_FRAMEBUFFER_COLOR_SIZE);
+}
+
+static inline void sw_framebuffer_fill_depth(sw_texture_t *depthBuffer, float depth)
+{
+    // NOTE: MSVC doesn't support VLA, so the largest possible size is allocated: 4 bytes
+    //uint8_t pixel[SW_FRAMEBUFFER_DEPTH_SIZE] = { 0 };
+    uint8_t pixel[4] = { 0 };
+    SW_FRAMEBUFFER_DEPTH_SET(pixel, depth, 0);
+
+    sw_framebuffer_fill(depthBuffer, pixel, SW_FRAMEBUFFER_DEPTH_SIZE);
+
+#if SW_USE_DEPTH_TILES
+    // Coarse depth tiles are set to the depth stored, not the one requested
+    int xMin, yMin, xMax, yMax;
+    if (sw_framebuffer_get_fill_rect(depthBuffer, &xMin, &yMin, &xMax, &yMax))
     {
-        const uint8_t *src = (uint8_t *)(buffer->pixels) + y*rowBytes;
-        for (int i = 0; i < rowBytes; i++) d[i] = src[i];
-        d += rowBytes;
+        sw_depth_tiles_fill(depthBuffer, SW_FRAMEBUFFER_DEPTH_GET(pixel, 0), xMin, yMin, xMax, yMax);
     }
 #endif
 }
 
-static inline void sw_framebuffer_output_copy(void *dst, const sw_texture_t *buffer, int x, int y, int w, int h, sw_pixelformat_t format)
+static inline void sw_framebuffer_output_fast(void *dst, const sw_texture_t *buffer)
 {
-    int stride = buffer->width;
-    int dstPixelSize = SW_PIXELFORMAT_SIZE[format];
-    sw_pixel_write_color8_f setColor8 = sw_pixel_get_write_color8_func(format);
-
-    const uint8_t *src = (uint8_t *)(buffer->pixels) + ((y + h - 1)*stride + x)*SW_FRAMEBUFFER_COLOR_SIZE;
-    uint8_t *d = dst;
+    size_t rowSize = (size_t)buffer->width*SW_FRAMEBUFFER_COLOR_SIZE;
+    const uint8_t *src = (const uint8_t *)buffer->pixels + (buffer->height - 1)*rowSize;
+    uint8_t *d = (uint8_t *)dst;
 
-    for (int iy = 0; iy < h; iy++)
+    for (int y = 0; y < buffer->height; y++, src -= rowSize, d += rowSize)
     {
-        const uint8_t *line = src;
-        uint8_t *dline = d;
-
-        for (int ix = 0; ix < w; ix++)
-        {
-            uint8_t color[4];
-            SW_FRAMEBUFFER_COLOR8_GET(color, line, 0);
+        sw_framebuffer_convert_row(d, src, buffer->width, SW_FRAMEBUFFER_COLOR_FORMAT);
+    }
+}
 
-            #if SW_FRAMEBUFFER_OUTPUT_BGRA
-            if (format == SW_PIXELFORMAT_COLOR_R8G8B8A8 || format == SW_PIXELFORMAT_COLOR_R8G8B8)
-            {
-                uint8_t tmp = color[0]; color[0] = color[2]; color[2] = tmp;
-            }
-            #endif
+static inline void sw_framebuffer_output_copy(void *dst, const sw_texture_t *buffer, int x, int y, int w, int h, sw_pixelformat_t format)
+{
+    size_t stride = (size_t)buffer->width*SW_FRAMEBUFFER_COLOR_SIZE;
+    size_t dstRowSize = (size_t)w*SW_PIXELFORMAT_SIZE[format];
 
-            setColor8(dline, color, 0);
-            line += SW_FRAMEBUFFER_COLOR_SIZE;
-            dline += dstPixelSize;
-        }
+    const uint8_t *src = (uint8_t *)(buffer->pixels) + (y + h - 1)*stride + (size_t)x*SW_FRAMEBUFFER_COLOR_SIZE;
+    uint8_t *d = dst;
 
-        src -= stride*SW_FRAMEBUFFER_COLOR_SIZE;
-        d += w*dstPixelSize;
+    for (int iy = 0; iy < h; iy++, src -= stride, d += dstRowSize)
+    {
+        sw_framebuffer_convert_row(d, src, w, format);
     }
 }
 
 static inline void sw_framebuffer_output_blit(void *dst, const sw_texture_t *buffer,
     int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, sw_pixelformat_t format)
 {
+    (void)xDst; (void)yDst;     // NOTE: Output is always written from the start of dst, rows packed
     const uint8_t *srcBase = buffer->pixels;
 
     int fbWidth = buffer->width;
     int dstPixelSize = SW_PIXELFORMAT_SIZE[format];
-    sw_pixel_write_color8_f setColor8 = sw_pixel_get_write_color8_func(format);
 
     uint32_t xScale = ((uint32_t)wSrc << 16)/(uint32_t)wDst;
     uint32_t yScale = ((uint32_t)hSrc << 16)/(uint32_t)hDst;
@@ -2689,6 +4218,59 @@ static inline void sw_framebuffer_output_blit(void *dst, const sw_texture_t *buf
     int ySrcLast = ySrc + hSrc - 1;
     uint8_t *d = (uint8_t *)dst;
 
+    if (SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8A8)
+    {
+        // Gather source pixels by chunks, chunks are converted as a row
+        uint32_t chunk[SW_BLIT_CHUNK_PIXELS];
+        size_t dstRowSize = (size_t)wDst*dstPixelSize;
+        int syPrev = -1;
+
+        for (int dy = 0; dy < hDst; dy++)
+        {
+            int sy = ySrcLast - (int)(dy*yScale >> 16);
+            uint8_t *dline = d;
+
+            // Rows repeated on vertical upscaling are copied from previous row
+            if (sy == syPrev)
+            {
+                sw_pixels_copy(d, d - dstRowSize, dstRowSize);
+                d += dstRowSize;
+                continue;
+            }
+
+            const uint32_t *srcLine = (const uint32_t *)srcBase + sy*fbWidth + xSrc;
+            syPrev = sy;
+
+            for (int dx = 0; dx < wDst; dx += SW_BLIT_CHUNK_PIXELS)
+            {
+                int count = wDst - dx;
+                if (count > SW_BLIT_CHUNK_PIXELS) count = SW_BLIT_CHUNK_PIXELS;
+
+                int i = 0;
+            #if defined(SW_SIMD_AVX2)
+                const __m256i step = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+                const __m256i scale = _mm256_set1_epi32((int)xScale);
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256i ix = _mm256_add_epi32(_mm256_set1_epi32(dx + i), step);
+                    __m256i sx = _mm256_srli_epi32(_mm256_mullo_epi32(ix, scale), 16);
+                    _mm256_storeu_si256((__m256i *)(chunk + i), _mm256_i32gather_epi32((const int *)srcLine, sx, 4));
+                }
+            #endif
+                for (uint32_t sx = (uint32_t)(dx + i)*xScale; i < count; i++, sx += xScale) chunk[i] = srcLine[sx >> 16];
+
+                sw_framebuffer_convert_row(dline, (const uint8_t *)chunk, count, format);
+                dline += count*dstPixelSize;
+            }
+
+            d += dstRowSize;
+        }
+
+        return;
+    }
+
+    sw_pixel_write_color8_f setColor8 = sw_pixel_get_write_color8_func(format);
+
     for (int dy = 0; dy < hDst; dy++)
     {
         int sy = ySrcLast - (int)(dy*yScale >> 16);
@@ -2719,6 +4301,106 @@ static inline void sw_framebuffer_output_blit(void *dst, const sw_texture_t *buf
 }
 //-------------------------------------------------------------------------------------------
 
+// Frames output ring functionality
+//-------------------------------------------------------------------------------------------
+#define SW_FRAME_RING_ALIGNMENT 64  // Header and frames alignment, avoids sharing cache lines between frames
+
+// Store value, ordered after previous stores (consumers loading it see previous stores)
+static inline void sw_atomic_store_release(volatile uint32_t *ptr, uint32_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    _InterlockedExchange((volatile long *)ptr, (long)value);
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#endif
+}
+
+// Store value, ordered before next stores (consumers seeing next stores see value)
+static inline void sw_atomic_store_fenced(volatile uint32_t *ptr, uint32_t value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    _InterlockedExchange((volatile long *)ptr, (long)value);
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline size_t sw_frame_ring_align(size_t size)
+{
+    return (size + SW_FRAME_RING_ALIGNMENT - 1) & ~(size_t)(SW_FRAME_RING_ALIGNMENT - 1);
+}
+
+// Get framebuffer output format as OpenGL format/type pair
+static inline void sw_frame_ring_get_format(sw_pixelformat_t format, SWformat *glFormat, SWtype *glType)
+{
+    switch (format)
+    {
+        case SW_PIXELFORMAT_COLOR_GRAYSCALE: *glFormat = SW_LUMINANCE; *glType = SW_UNSIGNED_BYTE; break;
+        case SW_PIXELFORMAT_COLOR_GRAYALPHA: *glFormat = SW_LUMINANCE_ALPHA; *glType = SW_UNSIGNED_BYTE; break;
+        case SW_PIXELFORMAT_COLOR_R3G3B2: *glFormat = SW_RGB; *glType = SW_UNSIGNED_BYTE_3_3_2; break;
+        case SW_PIXELFORMAT_COLOR_R5G6B5: *glFormat = SW_RGB; *glType = SW_UNSIGNED_SHORT_5_6_5; break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8: *glFormat = SW_RGB; *glType = SW_UNSIGNED_BYTE; break;
+        case SW_PIXELFORMAT_COLOR_R5G5B5A1: *glFormat = SW_RGBA; *glType = SW_UNSIGNED_SHORT_5_5_5_1; break;
+        case SW_PIXELFORMAT_COLOR_R4G4B4A4: *glFormat = SW_RGBA; *glType = SW_UNSIGNED_SHORT_4_4_4_4; break;
+        case SW_PIXELFORMAT_COLOR_R8G8B8A8: *glFormat = SW_RGBA; *glType = SW_UNSIGNED_BYTE; break;
+        default: *glFormat = SW_RGBA; *glType = SW_FLOAT; break;
+    }
+}
+
+// Initialize frames output ring header, frames are sized for the default framebuffer
+static void sw_frame_ring_init(void *memory, size_t size, int frameCount)
+{
+    SWframering *ring = (SWframering *)memory;
+    const sw_texture_t *buffer = &RLSW.framebuffer.color;
+
+    SWformat glFormat;
+    SWtype glType;
+    sw_frame_ring_get_format(SW_FRAMEBUFFER_COLOR_FORMAT, &glFormat, &glType);
+
+    // Magic is cleared first and set last, consumers ignore a ring being initialized
+    sw_atomic_store_fenced(&ring->magic, 0);
+
+    ring->headerSize = (uint32_t)sw_frame_ring_align(sizeof(SWframering));
+    ring->width = (uint32_t)buffer->width;
+    ring->height = (uint32_t)buffer->height;
+    ring->format = (uint32_t)glFormat;
+    ring->type = (uint32_t)glType;
+    ring->bgra = SW_FRAMEBUFFER_OUTPUT_BGRA &&
+        ((SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8A8) || (SW_FRAMEBUFFER_COLOR_FORMAT == SW_PIXELFORMAT_COLOR_R8G8B8));
+    ring->pixelSize = (uint32_t)SW_FRAMEBUFFER_COLOR_SIZE;
+    ring->pitch = ring->width*ring->pixelSize;
+    ring->frameSize = (uint32_t)sw_frame_ring_align((size_t)ring->pitch*ring->height);
+    ring->frameCount = (uint32_t)frameCount;
+    ring->sequence = 0;
+    for (int i = 0; i < SW_MAX_FRAME_RING_FRAMES; i++) ring->frameSequence[i] = 0;
+
+    sw_atomic_store_release(&ring->magic, SW_FRAME_RING_MAGIC);
+
+    RLSW.frameRing.header = ring;
+    RLSW.frameRing.size = size;
+    RLSW.frameRing.sequence = 0;
+}
+
+// Detach frames output ring, shared memory objects created by rlsw are unmapped and removed
+static void sw_frame_ring_detach(void)
+{
+#if defined(SW_SHARED_FRAME_RING_SUPPORTED)
+    if (RLSW.frameRing.shared)
+    {
+        munmap(RLSW.frameRing.header, RLSW.frameRing.size);
+        shm_unlink(RLSW.frameRing.name);
+    }
+#endif
+
+    RLSW.frameRing.header = NULL;
+    RLSW.frameRing.size = 0;
+    RLSW.frameRing.sequence = 0;
+    RLSW.frameRing.shared = false;
+    RLSW.frameRing.name[0] = '\0';
+}
+//-------------------------------------------------------------------------------------------
+
 // Color blending functionality
 //-------------------------------------------------------------------------------------------
 // Blend factor component macros: SW_BF_XXX(src, dst, component_index)
@@ -2821,33 +4503,346 @@ static inline int sw_blend_factor_index(SWfactor f)
     }
 }
 
-static bool sw_blend_factor_needs_alpha(SWfactor f)
+static bool sw_blend_factor_needs_alpha(SWfactor f)
+{
+    switch (f)
+    {
+        case SW_SRC_ALPHA:
+        case SW_ONE_MINUS_SRC_ALPHA:
+        case SW_DST_ALPHA:
+        case SW_ONE_MINUS_DST_ALPHA:
+        case SW_SRC_ALPHA_SATURATE: return true;
+        default: break;
+    }
+
+    return false;
+}
+
+static uint32_t sw_blend_compute_flags(SWfactor src, SWfactor dst)
+{
+    uint32_t flags = 0;
+
+    // Blend is a no-op: result = src*1 + dst*0 = src
+    if (src == SW_ONE && dst == SW_ZERO) flags |= SW_BLEND_FLAG_NOOP;
+
+    // Factors that depend on the alpha channel
+    if (sw_blend_factor_needs_alpha(src) || sw_blend_factor_needs_alpha(dst)) flags |= SW_BLEND_FLAG_NEEDS_ALPHA;
+
+    return flags;
+}
+
+// Get the fixed-point pipeline mode for blend factors, SW_FIXED_DISABLED if not supported
+static sw_fixed_mode_t sw_blend_get_fixed_mode(SWfactor src, SWfactor dst)
+{
+    if ((src == SW_SRC_ALPHA) && (dst == SW_ONE_MINUS_SRC_ALPHA)) return SW_FIXED_ALPHA;
+    if ((src == SW_SRC_ALPHA) && (dst == SW_ONE)) return SW_FIXED_ADDITIVE;
+    if ((src == SW_ONE) && (dst == SW_ONE_MINUS_SRC_ALPHA)) return SW_FIXED_PREMULTIPLIED;
+    if ((src == SW_ONE) && (dst == SW_ZERO)) return SW_FIXED_REPLACE;
+
+    return SW_FIXED_DISABLED;
+}
+//-------------------------------------------------------------------------------------------
+
+// Fixed-point fragment pipeline functionality
+//-------------------------------------------------------------------------------------------
+// NOTE: Fragments are processed as 8-bit RGBA colors, products are computed on 16-bit
+// lanes and divided by 255 with rounding, SIMD versions process several pixels at once
+#if SW_USE_FIXED_PIPELINE
+
+// Divide a 16-bit product of two 8-bit values by 255, rounded
+static inline uint32_t sw_fixed_div255(uint32_t x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Interpolate colors into 8-bit RGBA colors, color and gradient provided in 16.16 fixed-point (0..255)
+// NOTE: Colors are generated by groups of 4 pixels, buffer must be sized accordingly
+static inline void sw_fixed_span_colors(uint8_t *SW_RESTRICT colors, int count, int32_t color[4], const int32_t dCdx[4])
+{
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i c0 = _mm_loadu_si128((const __m128i *)color);
+    __m128i step = _mm_loadu_si128((const __m128i *)dCdx);
+    for (int i = 0; i < count; i += 4)
+    {
+        __m128i c1 = _mm_add_epi32(c0, step);
+        __m128i c2 = _mm_add_epi32(c1, step);
+        __m128i c3 = _mm_add_epi32(c2, step);
+        __m128i c01 = _mm_packs_epi32(_mm_srai_epi32(c0, 16), _mm_srai_epi32(c1, 16));
+        __m128i c23 = _mm_packs_epi32(_mm_srai_epi32(c2, 16), _mm_srai_epi32(c3, 16));
+        _mm_storeu_si128((__m128i *)&colors[i*4], _mm_packus_epi16(c01, c23));
+        c0 = _mm_add_epi32(c3, step);
+    }
+    _mm_storeu_si128((__m128i *)color, c0);
+
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    int32x4_t c0 = vld1q_s32(color);
+    int32x4_t step = vld1q_s32(dCdx);
+    for (int i = 0; i < count; i += 4)
+    {
+        int32x4_t c1 = vaddq_s32(c0, step);
+        int32x4_t c2 = vaddq_s32(c1, step);
+        int32x4_t c3 = vaddq_s32(c2, step);
+        int16x8_t c01 = vcombine_s16(vqshrn_n_s32(c0, 16), vqshrn_n_s32(c1, 16));
+        int16x8_t c23 = vcombine_s16(vqshrn_n_s32(c2, 16), vqshrn_n_s32(c3, 16));
+        vst1q_u8(&colors[i*4], vcombine_u8(vqmovun_s16(c01), vqmovun_s16(c23)));
+        c0 = vaddq_s32(c3, step);
+    }
+    vst1q_s32(color, c0);
+
+#else
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            int32_t c = color[j] >> 16;
+            colors[i*4 + j] = (c < 0)? 0 : ((c > 255)? 255 : (uint8_t)c);
+            color[j] += dCdx[j];
+        }
+    }
+#endif
+}
+
+// Fetch texels with nearest filtering into 8-bit RGBA colors
+// NOTE: Texture coordinates are stepped in float along the span and texels are selected
+// as on the float pipeline, so both pipelines select the same texels, coordinates are updated
+static inline void sw_fixed_span_texels(uint8_t *SW_RESTRICT texels, int count, const sw_texture_t *SW_RESTRICT tex,
+                                        float *SW_RESTRICT u, float *SW_RESTRICT v, float dUdx, float dVdx)
+{
+    const sw_texture_level_t *level = &tex->levels[0];
+    const uint8_t *pixels = (const uint8_t *)tex->pixels;
+
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t offset = sw_texture_get_nearest_offset(tex, level, *u, *v);
+
+        if (tex->format == SW_PIXELFORMAT_COLOR_R8G8B8A8)
+        {
+            const uint8_t *src = &pixels[offset*4];
+            texels[i*4 + 0] = src[0];
+            texels[i*4 + 1] = src[1];
+            texels[i*4 + 2] = src[2];
+            texels[i*4 + 3] = src[3];
+        }
+        else tex->readColor8(&texels[i*4], pixels, offset);
+
+        *u += dUdx;
+        *v += dVdx;
+    }
+}
+
+// Modulate colors by texels
+// NOTE: Colors are modulated by groups of 4 pixels, buffers must be sized accordingly
+static inline void sw_fixed_span_modulate(uint8_t *SW_RESTRICT colors, const uint8_t *SW_RESTRICT texels, int count)
+{
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i zero = _mm_setzero_si128();
+    __m128i half = _mm_set1_epi16(128);
+    for (int i = 0; i < count; i += 4)
+    {
+        __m128i c = _mm_loadu_si128((const __m128i *)&colors[i*4]);
+        __m128i t = _mm_loadu_si128((const __m128i *)&texels[i*4]);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(t, zero)), half);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(t, zero)), half);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i *)&colors[i*4], _mm_packus_epi16(lo, hi));
+    }
+
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    for (int i = 0; i < count; i += 4)
+    {
+        uint8x16_t c = vld1q_u8(&colors[i*4]);
+        uint8x16_t t = vld1q_u8(&texels[i*4]);
+        uint16x8_t lo = vmull_u8(vget_low_u8(c), vget_low_u8(t));
+        uint16x8_t hi = vmull_u8(vget_high_u8(c), vget_high_u8(t));
+        uint8x8_t rlo = vraddhn_u16(lo, vrshrq_n_u16(lo, 8));
+        uint8x8_t rhi = vraddhn_u16(hi, vrshrq_n_u16(hi, 8));
+        vst1q_u8(&colors[i*4], vcombine_u8(rlo, rhi));
+    }
+
+#else
+    for (int i = 0; i < count*4; i++) colors[i] = (uint8_t)sw_fixed_div255(colors[i]*texels[i]);
+#endif
+}
+
+// Blend source colors into destination pixels, one pixel at a time
+static inline void sw_fixed_blend_pixels(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT src, int count, sw_fixed_mode_t mode)
+{
+    switch (mode)
+    {
+        case SW_FIXED_ALPHA:
+        {
+            for (int i = 0; i < count*4; i += 4)
+            {
+                uint32_t a = src[i + 3], aInv = 255 - a;
+                for (int j = i; j < i + 4; j++) dst[j] = (uint8_t)sw_fixed_div255(src[j]*a + dst[j]*aInv);
+            }
+        } break;
+        case SW_FIXED_ADDITIVE:
+        {
+            for (int i = 0; i < count*4; i += 4)
+            {
+                uint32_t a = src[i + 3];
+                for (int j = i; j < i + 4; j++)
+                {
+                    uint32_t c = dst[j] + sw_fixed_div255(src[j]*a);
+                    dst[j] = (c > 255)? 255 : (uint8_t)c;
+                }
+            }
+        } break;
+        case SW_FIXED_PREMULTIPLIED:
+        {
+            for (int i = 0; i < count*4; i += 4)
+            {
+                uint32_t aInv = 255 - src[i + 3];
+                for (int j = i; j < i + 4; j++)
+                {
+                    uint32_t c = src[j] + sw_fixed_div255(dst[j]*aInv);
+                    dst[j] = (c > 255)? 255 : (uint8_t)c;
+                }
+            }
+        } break;
+        default:
+        {
+            for (int i = 0; i < count*4; i++) dst[i] = src[i];
+        } break;
+    }
+}
+
+// Blend source colors into destination pixels
+static inline void sw_fixed_span_blend(uint8_t *SW_RESTRICT dst, const uint8_t *SW_RESTRICT colors, int count, sw_fixed_mode_t mode)
+{
+    int i = 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i zero = _mm_setzero_si128();
+    __m128i half = _mm_set1_epi16(128);
+    __m128i mask = _mm_set1_epi16(255);
+
+    // Products rounded and divided by 255
+    #define SW_FIXED_DIV255(x) \
+        _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16((x), half), _mm_srli_epi16(_mm_add_epi16((x), half), 8)), 8)
+
+    for (; (mode != SW_FIXED_REPLACE) && (i + 4 <= count); i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)&colors[i*4]);
+        __m128i d = _mm_loadu_si128((const __m128i *)&dst[i*4]);
+
+        __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        __m128i sHi = _mm_unpackhi_epi8(s, zero);
+        __m128i dLo = _mm_unpacklo_epi8(d, zero);
+        __m128i dHi = _mm_unpackhi_epi8(d, zero);
+
+        // Source alpha broadcasted on each pixel channels
+        __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m128i rLo, rHi;
+        switch (mode)
+        {
+            case SW_FIXED_ALPHA:
+            {
+                rLo = _mm_add_epi16(_mm_mullo_epi16(sLo, aLo), _mm_mullo_epi16(dLo, _mm_xor_si128(aLo, mask)));
+                rHi = _mm_add_epi16(_mm_mullo_epi16(sHi, aHi), _mm_mullo_epi16(dHi, _mm_xor_si128(aHi, mask)));
+                rLo = SW_FIXED_DIV255(rLo);
+                rHi = SW_FIXED_DIV255(rHi);
+            } break;
+            case SW_FIXED_ADDITIVE:
+            {
+                rLo = _mm_add_epi16(dLo, SW_FIXED_DIV255(_mm_mullo_epi16(sLo, aLo)));
+                rHi = _mm_add_epi16(dHi, SW_FIXED_DIV255(_mm_mullo_epi16(sHi, aHi)));
+            } break;
+            case SW_FIXED_PREMULTIPLIED:
+            default:
+            {
+                rLo = _mm_add_epi16(sLo, SW_FIXED_DIV255(_mm_mullo_epi16(dLo, _mm_xor_si128(aLo, mask))));
+                rHi = _mm_add_epi16(sHi, SW_FIXED_DIV255(_mm_mullo_epi16(dHi, _mm_xor_si128(aHi, mask))));
+            } break;
+        }
+
+        // Saturated to 255 on packing
+        _mm_storeu_si128((__m128i *)&dst[i*4], _mm_packus_epi16(rLo, rHi));
+    }
+
+    #undef SW_FIXED_DIV255
+
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    // Source alpha broadcasted on each pixel channels
+    static const uint8_t alphaIndices[8] = { 3, 3, 3, 3, 7, 7, 7, 7 };
+    uint8x8_t alphaLut = vld1_u8(alphaIndices);
+
+    // Products rounded and divided by 255
+    #define SW_FIXED_DIV255(x) vraddhn_u16((x), vrshrq_n_u16((x), 8))
+
+    for (; (mode != SW_FIXED_REPLACE) && (i + 2 <= count); i += 2)
+    {
+        uint8x8_t s = vld1_u8(&colors[i*4]);
+        uint8x8_t d = vld1_u8(&dst[i*4]);
+        uint8x8_t a = vtbl1_u8(s, alphaLut);
+        uint8x8_t r;
+
+        switch (mode)
+        {
+            case SW_FIXED_ALPHA:
+            {
+                uint16x8_t sum = vmlal_u8(vmull_u8(s, a), d, vmvn_u8(a));
+                r = SW_FIXED_DIV255(sum);
+            } break;
+            case SW_FIXED_ADDITIVE: r = vqadd_u8(d, SW_FIXED_DIV255(vmull_u8(s, a))); break;
+            case SW_FIXED_PREMULTIPLIED:
+            default: r = vqadd_u8(s, SW_FIXED_DIV255(vmull_u8(d, vmvn_u8(a)))); break;
+        }
+
+        vst1_u8(&dst[i*4], r);
+    }
+
+    #undef SW_FIXED_DIV255
+#endif
+
+    sw_fixed_blend_pixels(&dst[i*4], &colors[i*4], count - i, mode);
+}
+
+// Process a span of fragments with the fixed-point pipeline and write them to a R8G8B8A8 framebuffer
+// NOTE: Color and texture coordinates are interpolated linearly along the span,
+// texture is not sampled if NULL
+static void sw_fixed_span(uint8_t *SW_RESTRICT dst, int count, const float color[4], const float dCdx[4],
+                          const sw_texture_t *SW_RESTRICT tex, float u, float v, float dUdx, float dVdx, sw_fixed_mode_t mode)
 {
-    switch (f)
+    // NOTE: Buffers are processed by groups of 4 pixels, span size must be a multiple of 4
+    uint8_t colors[SW_FIXED_SPAN_PIXELS*4];
+    uint8_t texels[SW_FIXED_SPAN_PIXELS*4];
+
+    // Colors converted to 16.16 fixed-point, on 0..255 range
+    // NOTE: Gradient is clamped to keep interpolation in 32-bit range
+    int32_t cFixed[4], dCdxFixed[4];
+    for (int i = 0; i < 4; i++)
     {
-        case SW_SRC_ALPHA:
-        case SW_ONE_MINUS_SRC_ALPHA:
-        case SW_DST_ALPHA:
-        case SW_ONE_MINUS_DST_ALPHA:
-        case SW_SRC_ALPHA_SATURATE: return true;
-        default: break;
+        float d = dCdx[i];
+        d = (d < -1.0f)? -1.0f : ((d > 1.0f)? 1.0f : d);
+        cFixed[i] = (int32_t)(sw_saturate(color[i])*(255.0f*65536.0f));
+        dCdxFixed[i] = (int32_t)(d*(255.0f*65536.0f));
     }
 
-    return false;
-}
+    while (count > 0)
+    {
+        int n = (count < SW_FIXED_SPAN_PIXELS)? count : SW_FIXED_SPAN_PIXELS;
 
-static uint32_t sw_blend_compute_flags(SWfactor src, SWfactor dst)
-{
-    uint32_t flags = 0;
+        sw_fixed_span_colors(colors, n, cFixed, dCdxFixed);
 
-    // Blend is a no-op: result = src*1 + dst*0 = src
-    if (src == SW_ONE && dst == SW_ZERO) flags |= SW_BLEND_FLAG_NOOP;
+        if (tex != NULL)
+        {
+            sw_fixed_span_texels(texels, n, tex, &u, &v, dUdx, dVdx);
+            sw_fixed_span_modulate(colors, texels, n);
+        }
 
-    // Factors that depend on the alpha channel
-    if (sw_blend_factor_needs_alpha(src) || sw_blend_factor_needs_alpha(dst)) flags |= SW_BLEND_FLAG_NEEDS_ALPHA;
+        sw_fixed_span_blend(dst, colors, n, mode);
 
-    return flags;
+        dst += n*4;
+        count -= n;
+    }
 }
+#endif // SW_USE_FIXED_PIPELINE
 //-------------------------------------------------------------------------------------------
 
 // Projection helper functions
@@ -2978,6 +4973,27 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
     return (n >= 3);
 }
 
+// Line rasterization helpers
+//-------------------------------------------------------------------------------------------
+// Narrow the line steps range [*iStart, *iEnd) to the steps where the coordinate
+// (start + inc*i) could be inside [min, max), range is widened by one step for rounding
+static inline void sw_line_step_range(float start, float inc, int min, int max, int *iStart, int *iEnd)
+{
+    if (fabsf(inc) < SW_CLIP_EPSILON)
+    {
+        if ((start < (float)min - 1.0f) || (start > (float)max + 1.0f)) *iEnd = *iStart;
+        return;
+    }
+
+    float t0 = ((float)min - start)/inc;
+    float t1 = ((float)max - start)/inc;
+    if (t0 > t1) { float tmp = t0; t0 = t1; t1 = tmp; }
+
+    if (t0 - 1.0f > (float)*iStart) *iStart = (t0 - 1.0f < (float)*iEnd)? (int)(t0 - 1.0f) : *iEnd;
+    if (t1 + 2.0f < (float)*iEnd) *iEnd = (t1 + 2.0f > (float)*iStart)? (int)(t1 + 2.0f) : *iStart;
+}
+//-------------------------------------------------------------------------------------------
+
 // Triangle rasterizer variant dispatch
 //-------------------------------------------------------------------------------------------
 #ifndef RLSW_TEMPLATE_RASTER_TRIANGLE_EXPANDING
@@ -3002,7 +5018,7 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
     // Forward declarations because clangd does not follow #include __FILE__ to avoid infinite recursion
     // These declarations make all variants visible to static analysis tools without affecting compilation
     #define SW_FWD_DECL(NAME, _FLAGS) \
-        static void sw_raster_triangle_##NAME(const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
+        static void sw_raster_triangle_##NAME(const sw_raster_t*, const sw_vertex_t*, const sw_vertex_t*, const sw_vertex_t*);
     SW_RASTER_VARIANTS(SW_FWD_DECL) // NOLINT
     #undef SW_FWD_DECL
 
@@ -3101,7 +5117,7 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
     // Forward declarations because clangd does not follow #include __FILE__ to avoid infinite recursion
     // These declarations make all variants visible to static analysis tools without affecting compilation
     #define SW_FWD_DECL(NAME, _FLAGS) \
-        static void sw_raster_quad_##NAME(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, const sw_vertex_t *v3);
+        static void sw_raster_quad_##NAME(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, const sw_vertex_t *v3);
     SW_RASTER_VARIANTS(SW_FWD_DECL) // NOLINT
     #undef SW_FWD_DECL
 
@@ -3196,8 +5212,8 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
     // Forward declarations because clangd does not follow #include __FILE__ to avoid infinite recursion
     // These declarations make all variants visible to static analysis tools without affecting compilation
     #define SW_FWD_DECL(NAME, _FLAGS)                                                       \
-        static void sw_raster_line_##NAME(const sw_vertex_t *v0, const sw_vertex_t *v1);    \
-        static void sw_raster_line_thick_##NAME(const sw_vertex_t *v0, const sw_vertex_t *v1);
+        static void sw_raster_line_##NAME(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1);    \
+        static void sw_raster_line_thick_##NAME(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1);
     SW_RASTER_VARIANTS(SW_FWD_DECL) // NOLINT
     #undef SW_FWD_DECL
 
@@ -3261,7 +5277,7 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
     // Forward declarations because clangd does not follow #include __FILE__ to avoid infinite recursion
     // These declarations make all variants visible to static analysis tools without affecting compilation
     #define SW_FWD_DECL(NAME, _FLAGS) \
-        static void sw_raster_point_##NAME(const sw_vertex_t *v);
+        static void sw_raster_point_##NAME(const sw_raster_t *raster, const sw_vertex_t *v);
     SW_RASTER_VARIANTS(SW_FWD_DECL) // NOLINT
     #undef SW_FWD_DECL
 
@@ -3304,6 +5320,529 @@ static bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES]
 #endif // RLSW_TEMPLATE_RASTER_POINT_EXPANDING
 //-------------------------------------------------------------------------------------------
 
+// Rasterizer submission logic
+//-------------------------------------------------------------------------------------------
+// Get rasterizer state from current context, clipped to the bound framebuffer
+static inline sw_raster_t sw_raster_get_state(void)
+{
+    sw_raster_t raster = { 0 };
+
+    raster.texture = RLSW.boundTexture;
+    raster.blendFunc = RLSW.blendFunc;
+    raster.pointRadius = RLSW.pointRadius;
+    raster.lineWidth = RLSW.lineWidth;
+    raster.clipMax[0] = RLSW.colorBuffer->width;
+    raster.clipMax[1] = RLSW.colorBuffer->height;
+
+    return raster;
+}
+
+// Get fixed-point fragment pipeline mode for primitives rasterized with the provided state
+// NOTE: Only R8G8B8A8 framebuffers without depth test, textures sampled with nearest filtering
+// from 8-bit color or compressed formats and blending modes supported by sw_blend_get_fixed_mode()
+static inline sw_fixed_mode_t sw_raster_get_fixed_mode(uint32_t state)
+{
+#if SW_USE_FIXED_PIPELINE
+    if (SW_FRAMEBUFFER_COLOR_FORMAT != SW_PIXELFORMAT_COLOR_R8G8B8A8) return SW_FIXED_DISABLED;
+    if (state & SW_STATE_DEPTH_TEST) return SW_FIXED_DISABLED;
+
+    if (state & SW_STATE_TEXTURE_2D)
+    {
+        const sw_texture_t *tex = RLSW.boundTexture;
+        if ((tex->minFilter != SW_NEAREST) || (tex->magFilter != SW_NEAREST)) return SW_FIXED_DISABLED;
+        if (((tex->format < SW_PIXELFORMAT_COLOR_GRAYSCALE) || (tex->format > SW_PIXELFORMAT_COLOR_R8G8B8A8)) &&
+            !sw_pixel_is_compressed_format(tex->format)) return SW_FIXED_DISABLED;
+    }
+
+    return (state & SW_STATE_BLEND)? RLSW.blendFixedMode : SW_FIXED_REPLACE;
+#else
+    (void)state;
+    return SW_FIXED_DISABLED;
+#endif
+}
+
+#if defined(RLSW_USE_RASTER_THREADS)
+// Init mutex
+static void sw_mutex_init(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    InitializeSRWLock((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+// Destroy mutex
+static void sw_mutex_destroy(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    (void)mutex;    // NOTE: SRWLOCK does not need to be destroyed
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+// Lock mutex
+static void sw_mutex_lock(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+// Unlock mutex
+static void sw_mutex_unlock(sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+// Init condition
+static void sw_cond_init(sw_cond_t *cond)
+{
+#if defined(_WIN32)
+    cond->cond = NULL;      // NOTE: CONDITION_VARIABLE_INIT
+#else
+    pthread_cond_init(cond, NULL);
+#endif
+}
+
+// Destroy condition
+static void sw_cond_destroy(sw_cond_t *cond)
+{
+#if defined(_WIN32)
+    (void)cond;     // NOTE: CONDITION_VARIABLE does not need to be destroyed
+#else
+    pthread_cond_destroy(cond);
+#endif
+}
+
+// Wait for condition signal
+// NOTE: Mutex must be locked, it's unlocked while waiting
+static void sw_cond_wait(sw_cond_t *cond, sw_mutex_t *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW((struct _RTL_CONDITION_VARIABLE *)cond, (struct _RTL_SRWLOCK *)mutex, 0xffffffff, 0);    // INFINITE
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+// Signal condition, wakes one waiting thread
+static void sw_cond_signal(sw_cond_t *cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable((struct _RTL_CONDITION_VARIABLE *)cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+// Signal condition, wakes all waiting threads
+static void sw_cond_broadcast(sw_cond_t *cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable((struct _RTL_CONDITION_VARIABLE *)cond);
+#else
+    pthread_cond_broadcast(cond);
+#endif
+}
+
+// Create thread running proc(arg)
+static bool sw_thread_create(sw_thread_t *thread, sw_thread_proc_f proc, void *arg)
+{
+#if defined(_WIN32)
+    *thread = (sw_thread_t)_beginthreadex(NULL, 0, proc, arg, 0, NULL);
+    return (*thread != NULL);
+#else
+    return (pthread_create(thread, NULL, proc, arg) == 0);
+#endif
+}
+
+// Wait for thread to finish
+static void sw_thread_join(sw_thread_t thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, 0xffffffff);    // INFINITE
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+// Get logical processors count
+static int sw_get_processor_count(void)
+{
+    int count = 1;
+
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);     // ALL_PROCESSOR_GROUPS
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processors > 0) count = (int)processors;
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Rasterize all binned primitives overlapping a tile, in submission order
+static void sw_tiler_raster_tile(int tile)
+{
+    const sw_tile_bin_t *bin = &RLSW.tiler.bins[tile];
+    if (bin->count == 0) return;
+
+    int xMin = (tile%RLSW.tiler.tilesX)*SW_RASTER_TILE_SIZE;
+    int yMin = (tile/RLSW.tiler.tilesX)*SW_RASTER_TILE_SIZE;
+    int xMax = xMin + SW_RASTER_TILE_SIZE;
+    int yMax = yMin + SW_RASTER_TILE_SIZE;
+    if (xMax > RLSW.colorBuffer->width) xMax = RLSW.colorBuffer->width;
+    if (yMax > RLSW.colorBuffer->height) yMax = RLSW.colorBuffer->height;
+
+    for (int i = 0; i < bin->count; i++)
+    {
+        const sw_raster_cmd_t *cmd = &RLSW.tiler.cmds[bin->cmds[i]];
+        const sw_vertex_t *v = cmd->vertices;
+
+        sw_raster_t raster = cmd->raster;
+        raster.clipMin[0] = xMin;
+        raster.clipMin[1] = yMin;
+        raster.clipMax[0] = xMax;
+        raster.clipMax[1] = yMax;
+
+        switch (cmd->type)
+        {
+            case SW_RASTER_CMD_TRIANGLE: cmd->func.triangle(&raster, &v[0], &v[1], &v[2]); break;
+            case SW_RASTER_CMD_QUAD: cmd->func.quad(&raster, &v[0], &v[1], &v[2], &v[3]); break;
+            case SW_RASTER_CMD_LINE: cmd->func.line(&raster, &v[0], &v[1]); break;
+            case SW_RASTER_CMD_POINT: cmd->func.point(&raster, &v[0]); break;
+            default: break;
+        }
+    }
+}
+
+// Rasterize tiles of current flush until none is left
+static void sw_tiler_run(void)
+{
+    sw_mutex_lock(&RLSW.tiler.lock);
+
+    while (RLSW.tiler.nextTile < RLSW.tiler.tileCount)
+    {
+        int tile = RLSW.tiler.nextTile++;
+        sw_mutex_unlock(&RLSW.tiler.lock);
+
+        sw_tiler_raster_tile(tile);
+
+        sw_mutex_lock(&RLSW.tiler.lock);
+        RLSW.tiler.tilesDone++;
+        if (RLSW.tiler.tilesDone == RLSW.tiler.tileCount) sw_cond_signal(&RLSW.tiler.done);
+    }
+
+    sw_mutex_unlock(&RLSW.tiler.lock);
+}
+
+// Worker thread: rasterizes tiles on every flush until stopped
+SW_THREAD_PROC(sw_tiler_worker)
+{
+    (void)arg;
+
+    sw_mutex_lock(&RLSW.tiler.lock);
+    uint32_t generation = RLSW.tiler.generation;
+
+    while (true)
+    {
+        while (!RLSW.tiler.quit && (RLSW.tiler.generation == generation)) sw_cond_wait(&RLSW.tiler.wake, &RLSW.tiler.lock);
+        if (RLSW.tiler.quit) break;
+
+        generation = RLSW.tiler.generation;
+        sw_mutex_unlock(&RLSW.tiler.lock);
+
+        sw_tiler_run();
+
+        sw_mutex_lock(&RLSW.tiler.lock);
+    }
+
+    sw_mutex_unlock(&RLSW.tiler.lock);
+
+    return 0;
+}
+
+// Rasterize all binned primitives, tiles are shared by worker threads and calling thread
+static void sw_tiler_flush(void)
+{
+    if (RLSW.tiler.cmdCount == 0) return;
+
+    sw_mutex_lock(&RLSW.tiler.lock);
+    RLSW.tiler.tileCount = RLSW.tiler.tilesX*RLSW.tiler.tilesY;
+    RLSW.tiler.nextTile = 0;
+    RLSW.tiler.tilesDone = 0;
+    RLSW.tiler.generation++;
+    sw_cond_broadcast(&RLSW.tiler.wake);
+    sw_mutex_unlock(&RLSW.tiler.lock);
+
+    sw_tiler_run();
+
+    sw_mutex_lock(&RLSW.tiler.lock);
+    while (RLSW.tiler.tilesDone < RLSW.tiler.tileCount) sw_cond_wait(&RLSW.tiler.done, &RLSW.tiler.lock);
+    sw_mutex_unlock(&RLSW.tiler.lock);
+
+    for (int i = 0; i < RLSW.tiler.tileCount; i++) RLSW.tiler.bins[i].count = 0;
+    RLSW.tiler.cmdCount = 0;
+}
+
+// Start worker threads, count includes calling thread (0: processors count)
+// NOTE: Rasterization is immediate if no worker thread could be started
+static void sw_tiler_start(int count)
+{
+    if (count <= 0) count = sw_get_processor_count();
+    if (count > SW_MAX_RASTER_THREADS) count = SW_MAX_RASTER_THREADS;
+
+    RLSW.tiler.quit = false;
+
+    for (int i = 0; i < count - 1; i++)
+    {
+        if (!sw_thread_create(&RLSW.tiler.threads[RLSW.tiler.threadCount], sw_tiler_worker, NULL)) break;
+        RLSW.tiler.threadCount++;
+    }
+
+    if (RLSW.tiler.threadCount > 0) SW_LOG("INFO: RLSW: Deferred rasterization enabled (%i threads)\n", RLSW.tiler.threadCount + 1);
+}
+
+// Stop worker threads, binned primitives must be flushed before
+static void sw_tiler_stop(void)
+{
+    sw_mutex_lock(&RLSW.tiler.lock);
+    RLSW.tiler.quit = true;
+    sw_cond_broadcast(&RLSW.tiler.wake);
+    sw_mutex_unlock(&RLSW.tiler.lock);
+
+    for (int i = 0; i < RLSW.tiler.threadCount; i++) sw_thread_join(RLSW.tiler.threads[i]);
+    RLSW.tiler.threadCount = 0;
+}
+
+static void sw_tiler_init(void)
+{
+    sw_mutex_init(&RLSW.tiler.lock);
+    sw_cond_init(&RLSW.tiler.wake);
+    sw_cond_init(&RLSW.tiler.done);
+    RLSW.tiler.ready = true;
+
+    sw_tiler_start(SW_RASTER_THREADS);
+}
+
+static void sw_tiler_close(void)
+{
+    if (!RLSW.tiler.ready) return;
+
+    // NOTE: Binned primitives are discarded
+    sw_tiler_stop();
+
+    for (int i = 0; i < RLSW.tiler.binCapacity; i++) SW_FREE(RLSW.tiler.bins[i].cmds);
+    SW_FREE(RLSW.tiler.bins);
+    SW_FREE(RLSW.tiler.cmds);
+
+    sw_cond_destroy(&RLSW.tiler.done);
+    sw_cond_destroy(&RLSW.tiler.wake);
+    sw_mutex_destroy(&RLSW.tiler.lock);
+    RLSW.tiler.ready = false;
+}
+
+// Bin primitive into all tiles overlapped by its bounding box
+// NOTE: Returns false if primitive could not be binned, it must be rasterized immediately
+static bool sw_tiler_push(const sw_raster_cmd_t *cmd)
+{
+    if (RLSW.tiler.threadCount <= 0) return false;
+
+    int width = RLSW.colorBuffer->width;
+    int height = RLSW.colorBuffer->height;
+    int tilesX = (width + SW_RASTER_TILE_SIZE - 1)/SW_RASTER_TILE_SIZE;
+    int tilesY = (height + SW_RASTER_TILE_SIZE - 1)/SW_RASTER_TILE_SIZE;
+    if ((tilesX <= 0) || (tilesY <= 0)) return false;
+
+    // Binned primitives are rasterized before the tiles grid changes or when the limit is reached
+    if ((tilesX != RLSW.tiler.tilesX) || (tilesY != RLSW.tiler.tilesY) || (RLSW.tiler.cmdCount >= SW_MAX_BINNED_PRIMITIVES)) sw_tiler_flush();
+
+    if ((tilesX != RLSW.tiler.tilesX) || (tilesY != RLSW.tiler.tilesY))
+    {
+        int tileCount = tilesX*tilesY;
+        if (tileCount > RLSW.tiler.binCapacity)
+        {
+            sw_tile_bin_t *bins = (sw_tile_bin_t *)SW_REALLOC(RLSW.tiler.bins, tileCount*sizeof(sw_tile_bin_t));
+            if (bins == NULL) return false;
+
+            for (int i = RLSW.tiler.binCapacity; i < tileCount; i++) bins[i] = SW_CURLY_INIT(sw_tile_bin_t) { 0 };
+            RLSW.tiler.bins = bins;
+            RLSW.tiler.binCapacity = tileCount;
+        }
+
+        RLSW.tiler.tilesX = tilesX;
+        RLSW.tiler.tilesY = tilesY;
+    }
+
+    if (RLSW.tiler.cmdCount == RLSW.tiler.cmdCapacity)
+    {
+        int capacity = (RLSW.tiler.cmdCapacity > 0)? RLSW.tiler.cmdCapacity*2 : 256;
+        if (capacity > SW_MAX_BINNED_PRIMITIVES) capacity = SW_MAX_BINNED_PRIMITIVES;
+
+        sw_raster_cmd_t *cmds = (sw_raster_cmd_t *)SW_REALLOC(RLSW.tiler.cmds, capacity*sizeof(sw_raster_cmd_t));
+        if (cmds == NULL) { sw_tiler_flush(); return false; }
+
+        RLSW.tiler.cmds = cmds;
+        RLSW.tiler.cmdCapacity = capacity;
+    }
+
+    // Conservative screen bounding box, expanded by lines width and points radius
+    static const int vertexCounts[] = { 3, 4, 2, 1 };
+    const sw_vertex_t *v = cmd->vertices;
+
+    float xMinF = v[0].position[0], xMaxF = v[0].position[0];
+    float yMinF = v[0].position[1], yMaxF = v[0].position[1];
+    for (int i = 1; i < vertexCounts[cmd->type]; i++)
+    {
+        if (v[i].position[0] < xMinF) xMinF = v[i].position[0];
+        if (v[i].position[0] > xMaxF) xMaxF = v[i].position[0];
+        if (v[i].position[1] < yMinF) yMinF = v[i].position[1];
+        if (v[i].position[1] > yMaxF) yMaxF = v[i].position[1];
+    }
+
+    int margin = 1;
+    if (cmd->type == SW_RASTER_CMD_LINE) margin += (int)cmd->raster.lineWidth;
+    else if (cmd->type == SW_RASTER_CMD_POINT) margin += (int)cmd->raster.pointRadius;
+
+    int tx0 = sw_clamp_int((int)xMinF - margin, 0, width - 1)/SW_RASTER_TILE_SIZE;
+    int ty0 = sw_clamp_int((int)yMinF - margin, 0, height - 1)/SW_RASTER_TILE_SIZE;
+    int tx1 = sw_clamp_int((int)xMaxF + margin, 0, width - 1)/SW_RASTER_TILE_SIZE;
+    int ty1 = sw_clamp_int((int)yMaxF + margin, 0, height - 1)/SW_RASTER_TILE_SIZE;
+
+    // Reserve bins space first, so a failed allocation leaves no primitive partially binned
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            sw_tile_bin_t *bin = &RLSW.tiler.bins[ty*tilesX + tx];
+            if (bin->count < bin->capacity) continue;
+
+            int capacity = (bin->capacity > 0)? bin->capacity*2 : 64;
+            uint32_t *cmds = (uint32_t *)SW_REALLOC(bin->cmds, capacity*sizeof(uint32_t));
+            if (cmds == NULL) { sw_tiler_flush(); return false; }
+
+            bin->cmds = cmds;
+            bin->capacity = capacity;
+        }
+    }
+
+    uint32_t index = (uint32_t)RLSW.tiler.cmdCount++;
+    RLSW.tiler.cmds[index] = *cmd;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            sw_tile_bin_t *bin = &RLSW.tiler.bins[ty*tilesX + tx];
+            bin->cmds[bin->count++] = index;
+        }
+    }
+
+    return true;
+}
+#else
+static inline void sw_tiler_flush(void) { }
+#endif
+
+// Submit primitives to rasterizer, binned on deferred rasterization or rasterized immediately
+static void sw_submit_triangle(uint32_t state, const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2)
+{
+    sw_raster_t raster = sw_raster_get_state();
+    sw_raster_triangle_f func = SW_RASTER_TRIANGLE_TABLE[state];
+    raster.fixedMode = sw_raster_get_fixed_mode(state);
+
+#if defined(RLSW_USE_RASTER_THREADS)
+    if (RLSW.tiler.threadCount > 0)
+    {
+        sw_raster_cmd_t cmd;
+        cmd.type = SW_RASTER_CMD_TRIANGLE;
+        cmd.func.triangle = func;
+        cmd.raster = raster;
+        cmd.vertices[0] = *v0;
+        cmd.vertices[1] = *v1;
+        cmd.vertices[2] = *v2;
+        if (sw_tiler_push(&cmd)) return;
+    }
+#endif
+
+    func(&raster, v0, v1, v2);
+}
+
+static void sw_submit_quad(uint32_t state, const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, const sw_vertex_t *v3)
+{
+    sw_raster_t raster = sw_raster_get_state();
+    sw_raster_quad_f func = SW_RASTER_QUAD_TABLE[state];
+    raster.fixedMode = sw_raster_get_fixed_mode(state);
+
+#if defined(RLSW_USE_RASTER_THREADS)
+    if (RLSW.tiler.threadCount > 0)
+    {
+        sw_raster_cmd_t cmd;
+        cmd.type = SW_RASTER_CMD_QUAD;
+        cmd.func.quad = func;
+        cmd.raster = raster;
+        cmd.vertices[0] = *v0;
+        cmd.vertices[1] = *v1;
+        cmd.vertices[2] = *v2;
+        cmd.vertices[3] = *v3;
+        if (sw_tiler_push(&cmd)) return;
+    }
+#endif
+
+    func(&raster, v0, v1, v2, v3);
+}
+
+static void sw_submit_line(uint32_t state, const sw_vertex_t *v0, const sw_vertex_t *v1)
+{
+    sw_raster_t raster = sw_raster_get_state();
+    sw_raster_line_f func = (raster.lineWidth >= 2.0f)? SW_RASTER_LINE_THICK_TABLE[state] : SW_RASTER_LINE_TABLE[state];
+
+#if defined(RLSW_USE_RASTER_THREADS)
+    if (RLSW.tiler.threadCount > 0)
+    {
+        sw_raster_cmd_t cmd;
+        cmd.type = SW_RASTER_CMD_LINE;
+        cmd.func.line = func;
+        cmd.raster = raster;
+        cmd.vertices[0] = *v0;
+        cmd.vertices[1] = *v1;
+        if (sw_tiler_push(&cmd)) return;
+    }
+#endif
+
+    func(&raster, v0, v1);
+}
+
+static void sw_submit_point(uint32_t state, const sw_vertex_t *v)
+{
+    sw_raster_t raster = sw_raster_get_state();
+    sw_raster_point_f func = SW_RASTER_POINT_TABLE[state];
+
+#if defined(RLSW_USE_RASTER_THREADS)
+    if (RLSW.tiler.threadCount > 0)
+    {
+        sw_raster_cmd_t cmd;
+        cmd.type = SW_RASTER_CMD_POINT;
+        cmd.func.point = func;
+        cmd.raster = raster;
+        cmd.vertices[0] = *v;
+        if (sw_tiler_push(&cmd)) return;
+    }
+#endif
+
+    func(&raster, v);
+}
+//-------------------------------------------------------------------------------------------
+
 // Triangle rendering logic
 //-------------------------------------------------------------------------------------------
 static inline bool sw_triangle_face_culling(void)
@@ -3404,7 +5943,7 @@ static void sw_triangle_render(uint32_t state)
 
     for (int i = 0; i < RLSW.primitive.vertexCount - 2; i++)
     {
-        SW_RASTER_TRIANGLE_TABLE[state](
+        sw_submit_triangle(state,
             &RLSW.primitive.buffer[0],
             &RLSW.primitive.buffer[i + 1],
             &RLSW.primitive.buffer[i + 2]
@@ -3555,7 +6094,7 @@ static void sw_quad_render(uint32_t state)
 
     if ((RLSW.primitive.vertexCount == 4) && sw_quad_is_axis_aligned())
     {
-        SW_RASTER_QUAD_TABLE[state](
+        sw_submit_quad(state,
             &RLSW.primitive.buffer[0],
             &RLSW.primitive.buffer[1],
             &RLSW.primitive.buffer[2],
@@ -3566,7 +6105,7 @@ static void sw_quad_render(uint32_t state)
     {
         for (int i = 0; i < RLSW.primitive.vertexCount - 2; i++)
         {
-            SW_RASTER_TRIANGLE_TABLE[state](
+            sw_submit_triangle(state,
                 &RLSW.primitive.buffer[0],
                 &RLSW.primitive.buffer[i + 1],
                 &RLSW.primitive.buffer[i + 2]
@@ -3683,18 +6222,11 @@ static bool sw_line_clip_and_project(sw_vertex_t *v0, sw_vertex_t *v1)
 
 static void sw_line_render(uint32_t state, sw_vertex_t *vertices)
 {
-    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
-
-    state &= SW_RASTER_LINE_STATE_MASK;
-
-    if (RLSW.lineWidth >= 2.0f)
-    {
-        SW_RASTER_LINE_THICK_TABLE[state](&vertices[0], &vertices[1]);
-    }
-    else
-    {
-        SW_RASTER_LINE_TABLE[state](&vertices[0], &vertices[1]);
-    }
+    if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
+
+    state &= SW_RASTER_LINE_STATE_MASK;
+
+    sw_submit_line(state, &vertices[0], &vertices[1]);
 }
 //-------------------------------------------------------------------------------------------
 
@@ -3738,7 +6270,7 @@ static void sw_point_render(uint32_t state, sw_vertex_t *v)
 {
     if (!sw_point_clip_and_project(v)) return;
     state &= SW_RASTER_POINT_STATE_MASK;
-    SW_RASTER_POINT_TABLE[state](v);
+    sw_submit_point(state, v);
 }
 //-------------------------------------------------------------------------------------------
 
@@ -3829,6 +6361,32 @@ static void sw_immediate_set_texcoord(const float texcoord[2])
     RLSW.primitive.texcoord[1] = m[1]*texcoord[0] + m[5]*texcoord[1] + m[13];
 }
 
+static void sw_immediate_render_primitive(void)
+{
+    uint32_t state = RLSW.rasterState;
+
+    // Reduces blend mode costs when it's possible
+    if (state & SW_STATE_BLEND)
+    {
+        if (RLSW.blendFlags & SW_BLEND_FLAG_NOOP) state &= ~SW_STATE_BLEND;
+        else if ((RLSW.blendFlags & SW_BLEND_FLAG_NEEDS_ALPHA) && (!RLSW.primitive.hasColorAlpha))
+        {
+            if (!(state & SW_STATE_TEXTURE_2D) || (RLSW.boundTexture->alpha == SW_PIXEL_ALPHA_NONE)) state &= ~SW_STATE_BLEND;
+        }
+    }
+
+    switch (RLSW.polyMode)
+    {
+        case SW_FILL: sw_poly_fill_render(state); break;
+        case SW_LINE: sw_poly_line_render(state); break;
+        case SW_POINT: sw_poly_point_render(state); break;
+        default: break;
+    }
+
+    RLSW.primitive.hasColorAlpha = false;
+    RLSW.primitive.vertexCount = 0;
+}
+
 static void sw_immediate_push_vertex(const float position[4])
 {
     // Check if the draw mode is valid
@@ -3853,36 +6411,153 @@ static void sw_immediate_push_vertex(const float position[4])
     for (int i = 0; i < 2; i++) vertex->texcoord[i] = RLSW.primitive.texcoord[i];
 
     // Immediate rendering of the primitive if the required number is reached
-    if (RLSW.primitive.vertexCount == SW_PRIMITIVE_VERTEX_COUNT[RLSW.drawMode])
+    if (RLSW.primitive.vertexCount == SW_PRIMITIVE_VERTEX_COUNT[RLSW.drawMode]) sw_immediate_render_primitive();
+}
+
+// Push a vertex already transformed to clip space
+// NOTE: Draw mode must be validated by the caller
+static inline void sw_immediate_push_transformed(const sw_vertex_t *vertex)
+{
+    RLSW.primitive.buffer[RLSW.primitive.vertexCount++] = *vertex;
+    RLSW.primitive.hasColorAlpha |= (vertex->color[3] < 1.0f);
+
+    if (RLSW.primitive.vertexCount == SW_PRIMITIVE_VERTEX_COUNT[RLSW.drawMode]) sw_immediate_render_primitive();
+}
+
+static void sw_immediate_end(void)
+{
+    RLSW.drawMode = SW_DRAW_INVALID;
+}
+//-------------------------------------------------------------------------------------------
+
+// Vertex arrays processing logic
+//-------------------------------------------------------------------------------------------
+// Reserve vertex cache space, NULL if allocation fails
+// NOTE: Callers fall back to transforming every vertex separately
+static sw_vertex_t *sw_vertex_cache_reserve(int count)
+{
+    if (count > RLSW.vertexCache.capacity)
+    {
+        sw_vertex_t *vertices = (sw_vertex_t *)SW_REALLOC(RLSW.vertexCache.vertices, count*sizeof(sw_vertex_t));
+        if (vertices == NULL) return NULL;
+
+        RLSW.vertexCache.vertices = vertices;
+        RLSW.vertexCache.capacity = count;
+    }
+
+    return RLSW.vertexCache.vertices;
+}
+
+// Transform vertex arrays elements [first, first + count) to clip space
+// NOTE: Every attribute is processed in its own pass over the batch,
+// current color/texcoord are used for attributes without array
+static void sw_vertex_transform_batch(sw_vertex_t *SW_RESTRICT vertices, int first, int count)
+{
+    const float *SW_RESTRICT positions = &RLSW.array.positions[3*first];
+    const float *m = RLSW.matMVP;
+
+    // Positions, w = 1
+#if defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    float32x4_t c0 = vld1q_f32(&m[0]);
+    float32x4_t c1 = vld1q_f32(&m[4]);
+    float32x4_t c2 = vld1q_f32(&m[8]);
+    float32x4_t c3 = vld1q_f32(&m[12]);
+
+    for (int i = 0; i < count; i++, positions += 3)
+    {
+        float32x4_t v = vmulq_n_f32(c0, positions[0]);
+        v = vmlaq_n_f32(v, c1, positions[1]);
+        v = vmlaq_n_f32(v, c2, positions[2]);
+        vst1q_f32(vertices[i].position, vaddq_f32(v, c3));
+    }
+#elif defined(SW_HAS_SSE) || defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128 c0 = _mm_loadu_ps(&m[0]);
+    __m128 c1 = _mm_loadu_ps(&m[4]);
+    __m128 c2 = _mm_loadu_ps(&m[8]);
+    __m128 c3 = _mm_loadu_ps(&m[12]);
+
+    for (int i = 0; i < count; i++, positions += 3)
+    {
+        __m128 v = _mm_mul_ps(c0, _mm_set1_ps(positions[0]));
+        v = _mm_add_ps(v, _mm_mul_ps(c1, _mm_set1_ps(positions[1])));
+        v = _mm_add_ps(v, _mm_mul_ps(c2, _mm_set1_ps(positions[2])));
+        _mm_storeu_ps(vertices[i].position, _mm_add_ps(v, c3));
+    }
+#else
+    for (int i = 0; i < count; i++, positions += 3)
     {
-        uint32_t state = RLSW.rasterState;
+        float *p = vertices[i].position;
+        p[0] = m[0]*positions[0] + m[4]*positions[1] + m[8]*positions[2] + m[12];
+        p[1] = m[1]*positions[0] + m[5]*positions[1] + m[9]*positions[2] + m[13];
+        p[2] = m[2]*positions[0] + m[6]*positions[1] + m[10]*positions[2] + m[14];
+        p[3] = m[3]*positions[0] + m[7]*positions[1] + m[11]*positions[2] + m[15];
+    }
+#endif
 
-        // Reduces blend mode costs when it's possible
-        if (state & SW_STATE_BLEND)
+    // Colors
+    if (RLSW.array.colors != NULL)
+    {
+        const uint8_t *SW_RESTRICT colors = &RLSW.array.colors[4*first];
+        for (int i = 0; i < count; i++) sw_color8_to_color(vertices[i].color, &colors[4*i]);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
         {
-            if (RLSW.blendFlags & SW_BLEND_FLAG_NOOP) state &= ~SW_STATE_BLEND;
-            else if ((RLSW.blendFlags & SW_BLEND_FLAG_NEEDS_ALPHA) && (!RLSW.primitive.hasColorAlpha))
-            {
-                if (!(state & SW_STATE_TEXTURE_2D) || (RLSW.boundTexture->alpha == SW_PIXEL_ALPHA_NONE)) state &= ~SW_STATE_BLEND;
-            }
+            for (int j = 0; j < 4; j++) vertices[i].color[j] = RLSW.primitive.color[j];
         }
+    }
+
+    // Texture coordinates
+    if (RLSW.array.texcoords != NULL)
+    {
+        const float *SW_RESTRICT texcoords = &RLSW.array.texcoords[2*first];
+        const float *t = RLSW.stackTexture[RLSW.stackTextureCounter - 1];
 
-        switch (RLSW.polyMode)
+        for (int i = 0; i < count; i++)
         {
-            case SW_FILL: sw_poly_fill_render(state); break;
-            case SW_LINE: sw_poly_line_render(state); break;
-            case SW_POINT: sw_poly_point_render(state); break;
-            default: break;
+            const float *uv = &texcoords[2*i];
+            vertices[i].texcoord[0] = t[0]*uv[0] + t[4]*uv[1] + t[12];
+            vertices[i].texcoord[1] = t[1]*uv[0] + t[5]*uv[1] + t[13];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+        {
+            vertices[i].texcoord[0] = RLSW.primitive.texcoord[0];
+            vertices[i].texcoord[1] = RLSW.primitive.texcoord[1];
         }
-
-        RLSW.primitive.hasColorAlpha = false;
-        RLSW.primitive.vertexCount = 0;
     }
 }
 
-static void sw_immediate_end(void)
+// Get the range of vertices referenced by indices
+static void sw_vertex_get_index_range(const void *indices, int type, int count, uint32_t *minIndex, uint32_t *maxIndex)
 {
-    RLSW.drawMode = SW_DRAW_INVALID;
+    uint32_t iMin = UINT32_MAX, iMax = 0;
+
+    switch (type)
+    {
+        case SW_UNSIGNED_BYTE:
+        {
+            const uint8_t *ub = (const uint8_t *)indices;
+            for (int i = 0; i < count; i++) { if (ub[i] < iMin) iMin = ub[i]; if (ub[i] > iMax) iMax = ub[i]; }
+        } break;
+        case SW_UNSIGNED_SHORT:
+        {
+            const uint16_t *us = (const uint16_t *)indices;
+            for (int i = 0; i < count; i++) { if (us[i] < iMin) iMin = us[i]; if (us[i] > iMax) iMax = us[i]; }
+        } break;
+        case SW_UNSIGNED_INT:
+        {
+            const uint32_t *ui = (const uint32_t *)indices;
+            for (int i = 0; i < count; i++) { if (ui[i] < iMin) iMin = ui[i]; if (ui[i] > iMax) iMax = ui[i]; }
+        } break;
+        default: break;
+    }
+
+    *minIndex = iMin;
+    *maxIndex = iMax;
 }
 //-------------------------------------------------------------------------------------------
 
@@ -3944,7 +6619,9 @@ bool swInit(int w, int h)
 
     RLSW.srcFactor = SW_SRC_ALPHA;
     RLSW.dstFactor = SW_ONE_MINUS_SRC_ALPHA;
+    RLSW.blendFlags = sw_blend_compute_flags(SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA);
     RLSW.blendFunc = sw_blend_SRC_ALPHA_ONE_MINUS_SRC_ALPHA;
+    RLSW.blendFixedMode = sw_blend_get_fixed_mode(SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA);
 
     RLSW.drawMode = SW_DRAW_INVALID;
     RLSW.polyMode = SW_FILL;
@@ -3954,6 +6631,10 @@ bool swInit(int w, int h)
     for (int i = 0; i < 256; i++) SW_LUT_UINT8_TO_FLOAT[i] = (float)i*SW_INV_255;
 #endif
 
+#if defined(RLSW_USE_RASTER_THREADS)
+    sw_tiler_init();
+#endif
+
     SW_LOG("INFO: RLSW: Software renderer initialized successfully\n");
 #if defined(SW_HAS_FMA_AVX) && defined(SW_HAS_FMA_AVX2)
     SW_LOG("INFO: RLSW: Using SIMD instructions: FMA AVX\n");
@@ -3976,6 +6657,10 @@ bool swInit(int w, int h)
 
 void swClose(void)
 {
+#if defined(RLSW_USE_RASTER_THREADS)
+    sw_tiler_close();
+#endif
+
     for (int i = 1; i < RLSW.texturePool.watermark; i++)
     {
         if (RLSW.texturePool.gen[i] & SW_POOL_SLOT_LIVE)
@@ -3984,20 +6669,26 @@ void swClose(void)
         }
     }
 
+    sw_frame_ring_detach();
     sw_pool_destroy(&RLSW.texturePool);
     sw_pool_destroy(&RLSW.framebufferPool);
     sw_default_framebuffer_free(&RLSW.framebuffer);
+    SW_FREE(RLSW.vertexCache.vertices);
 
     RLSW = SW_CURLY_INIT(sw_context_t) { 0 };
 }
 
 bool swResize(int w, int h)
 {
+    sw_tiler_flush();
+
     return sw_default_framebuffer_alloc(&RLSW.framebuffer, w, h);
 }
 
 void swReadPixels(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels)
 {
+    sw_tiler_flush();
+
     // REVIEW: Handle depth buffer copy here or consider it as an error ?
     if (format == SW_DEPTH_COMPONENT) { RLSW.errCode = SW_INVALID_ENUM; return; }
 
@@ -4027,6 +6718,8 @@ void swReadPixels(int x, int y, int w, int h, SWformat format, SWtype type, void
 
 void swBlitPixels(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels)
 {
+    sw_tiler_flush();
+
     // REVIEW: Handle depth buffer copy here or consider it as an error ?
     if (format == SW_DEPTH_COMPONENT) { RLSW.errCode = SW_INVALID_ENUM; return; }
 
@@ -4057,11 +6750,158 @@ void swBlitPixels(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, in
 // Get framefuffer pixel data pointer and size
 void *swGetColorBuffer(int *width, int *height)
 {
+    sw_tiler_flush();
+
     if (width != NULL) *width = RLSW.framebuffer.color.width;
     if (height != NULL) *height = RLSW.framebuffer.color.height;
     return RLSW.framebuffer.color.pixels;
 }
 
+// Rasterize all binned primitives
+// NOTE: Only required by deferred rasterization, rendering is flushed automatically
+// when framebuffer data is read or when framebuffers and textures are modified
+void swFinish(void)
+{
+    sw_tiler_flush();
+}
+
+// Set threads used on deferred rasterization, calling thread included
+// NOTE: 0 uses processors count, 1 disables deferred rasterization (immediate)
+void swSetRasterThreads(int count)
+{
+#if defined(RLSW_USE_RASTER_THREADS)
+    if (!RLSW.tiler.ready) return;
+
+    sw_tiler_flush();
+    sw_tiler_stop();
+    sw_tiler_start(count);
+#else
+    (void)count;
+#endif
+}
+
+// Get memory required by a frames output ring, header included
+// NOTE: Returns 0 if dimensions or frames count are not valid
+size_t swGetFrameRingSize(int width, int height, int frameCount)
+{
+    if ((width <= 0) || (height <= 0)) return 0;
+    if ((frameCount <= 0) || (frameCount > SW_MAX_FRAME_RING_FRAMES)) return 0;
+
+    size_t frameSize = sw_frame_ring_align((size_t)width*height*SW_FRAMEBUFFER_COLOR_SIZE);
+    if (frameSize > UINT32_MAX) return 0;
+
+    return sw_frame_ring_align(sizeof(SWframering)) + frameSize*frameCount;
+}
+
+// Attach frames output ring, memory is provided by the caller (i.e. shared memory mapped by the application)
+// NOTE: Frames are sized for current framebuffer, ring must be attached again after swResize()
+// Memory must be kept valid while attached, NULL detaches current ring
+bool swAttachFrameRing(void *memory, size_t size, int frameCount)
+{
+    sw_frame_ring_detach();
+
+    if (memory == NULL) return true;
+
+    size_t required = swGetFrameRingSize(RLSW.framebuffer.color.width, RLSW.framebuffer.color.height, frameCount);
+    if ((required == 0) || (size < required)) { RLSW.errCode = SW_INVALID_VALUE; return false; }
+
+    sw_frame_ring_init(memory, size, frameCount);
+
+    return true;
+}
+
+// Create a POSIX shared memory object (i.e. "/rlsw-frames") and attach it as frames output ring
+// NOTE: Any previous object with same name is removed first, consumers map the new object by name,
+// the object is removed when ring is detached or rlsw is closed
+bool swCreateSharedFrameRing(const char *name, int frameCount)
+{
+#if defined(SW_SHARED_FRAME_RING_SUPPORTED)
+    sw_frame_ring_detach();
+
+    size_t size = swGetFrameRingSize(RLSW.framebuffer.color.width, RLSW.framebuffer.color.height, frameCount);
+    if ((name == NULL) || (name[0] == '\0') || (size == 0)) { RLSW.errCode = SW_INVALID_VALUE; return false; }
+
+    int length = 0;
+    while (name[length] != '\0') length++;
+    if (length >= (int)sizeof(RLSW.frameRing.name)) { RLSW.errCode = SW_INVALID_VALUE; return false; }
+
+    shm_unlink(name);
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) { RLSW.errCode = SW_INVALID_OPERATION; return false; }
+
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        close(fd);
+        shm_unlink(name);
+        RLSW.errCode = SW_OUT_OF_MEMORY;
+        return false;
+    }
+
+    void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);  // Mapping keeps the object referenced
+
+    if (memory == MAP_FAILED)
+    {
+        shm_unlink(name);
+        RLSW.errCode = SW_OUT_OF_MEMORY;
+        return false;
+    }
+
+    sw_frame_ring_init(memory, size, frameCount);
+
+    RLSW.frameRing.shared = true;
+    for (int i = 0; i <= length; i++) RLSW.frameRing.name[i] = name[i];
+
+    SW_LOG("INFO: RLSW: Shared frames ring created: %s [%i frames, %i bytes]\n", name, frameCount, (int)size);
+
+    return true;
+#else
+    (void)name;
+    (void)frameCount;
+    RLSW.errCode = SW_INVALID_OPERATION;
+    return false;
+#endif
+}
+
+// Get frames output ring attached, NULL if none
+const SWframering *swGetFrameRing(void)
+{
+    return RLSW.frameRing.header;
+}
+
+// Publish default framebuffer into next frames output ring frame
+// NOTE: Rendering is flushed and frame is written in output layout (flipped, BGRA if required),
+// replacing swReadPixels() into a separate buffer, returns frame sequence or 0 on failure
+uint32_t swPresentFrame(void)
+{
+    SWframering *ring = RLSW.frameRing.header;
+    if (ring == NULL) { RLSW.errCode = SW_INVALID_OPERATION; return 0; }
+
+    sw_tiler_flush();
+
+    const sw_texture_t *buffer = &RLSW.framebuffer.color;
+    if ((buffer->width != (int)ring->width) || (buffer->height != (int)ring->height)) { RLSW.errCode = SW_INVALID_OPERATION; return 0; }
+
+    uint32_t sequence = RLSW.frameRing.sequence + 1;
+    if (sequence == 0) sequence = 1;    // Sequence wrapped, 0 means no frame
+
+    uint32_t slot = (sequence - 1)%ring->frameCount;
+    uint8_t *frame = (uint8_t *)ring + ring->headerSize + (size_t)slot*ring->frameSize;
+
+    // Invalidate the slot before overwriting it, consumers still reading the old frame discard it
+    sw_atomic_store_fenced(&ring->frameSequence[slot], 0);
+
+    sw_framebuffer_output_fast(frame, buffer);
+
+    sw_atomic_store_release(&ring->frameSequence[slot], sequence);
+    sw_atomic_store_release(&ring->sequence, sequence);
+
+    RLSW.frameRing.sequence = sequence;
+
+    return sequence;
+}
+
 void swEnable(SWstate state)
 {
     switch (state)
@@ -4231,6 +7071,8 @@ void swClear(uint32_t bitmask)
 {
     if (!sw_is_ready_to_render()) return;
 
+    sw_tiler_flush();
+
     if ((bitmask & (SW_COLOR_BUFFER_BIT)) && (RLSW.colorBuffer != NULL) && (RLSW.colorBuffer->pixels != NULL))
     {
         sw_framebuffer_fill_color(RLSW.colorBuffer, RLSW.clearColor);
@@ -4254,6 +7096,7 @@ void swBlendFunc(SWfactor sfactor, SWfactor dfactor)
     RLSW.dstFactor = dfactor;
     RLSW.blendFlags = sw_blend_compute_flags(sfactor, dfactor);
     RLSW.blendFunc = SW_BLEND_TABLE[sIndex][dIndex];
+    RLSW.blendFixedMode = sw_blend_get_fixed_mode(sfactor, dfactor);
 }
 
 void swPolygonMode(SWpoly mode)
@@ -4764,32 +7607,27 @@ void swDrawArrays(SWdraw mode, int offset, int count)
         return;
     }
 
+    if (!sw_is_draw_mode_valid(mode))
+    {
+        RLSW.errCode = SW_INVALID_ENUM;
+        return;
+    }
+
     sw_immediate_begin(mode);
     {
-        const float *positions = RLSW.array.positions;
-        const float *texcoords = RLSW.array.texcoords;
-        const uint8_t *colors = RLSW.array.colors;
+        // Vertices are transformed in batches and primitives assembled from the transformed batch
+        sw_vertex_t vertex = { 0 };
+        int batchSize = (count < SW_VERTEX_BATCH_SIZE)? count : SW_VERTEX_BATCH_SIZE;
+        sw_vertex_t *batch = sw_vertex_cache_reserve(batchSize);
+        if (batch == NULL) { batch = &vertex; batchSize = 1; }
 
         int end = offset + count;
-        for (int i = offset; i < end; i++)
+        for (int first = offset; first < end; first += batchSize)
         {
-            if (texcoords) sw_immediate_set_texcoord(&texcoords[2*i]);
+            int batchCount = ((end - first) < batchSize)? (end - first) : batchSize;
+            sw_vertex_transform_batch(batch, first, batchCount);
 
-            if (colors)
-            {
-                const uint8_t *c = &colors[4*i];
-                float color[4] = {
-                    (float)c[0]*SW_INV_255,
-                    (float)c[1]*SW_INV_255,
-                    (float)c[2]*SW_INV_255,
-                    (float)c[3]*SW_INV_255,
-                };
-                sw_immediate_set_color(color);
-            }
-
-            const float *p = &positions[3*i];
-            float position[4] = { p[0], p[1], p[2], 1.0f };
-            sw_immediate_push_vertex(position);
+            for (int i = 0; i < batchCount; i++) sw_immediate_push_transformed(&batch[i]);
         }
     }
     sw_immediate_end();
@@ -4815,11 +7653,24 @@ void swDrawElements(SWdraw mode, int count, int type, const void *indices)
         return;
     }
 
+    if (!sw_is_draw_mode_valid(mode))
+    {
+        RLSW.errCode = SW_INVALID_ENUM;
+        return;
+    }
+
+    if (count == 0) return;
+
+    uint32_t minIndex = 0, maxIndex = 0;
+    sw_vertex_get_index_range(indices, type, count, &minIndex, &maxIndex);
+
     sw_immediate_begin(mode);
     {
-        const float *positions = RLSW.array.positions;
-        const float *texcoords = RLSW.array.texcoords;
-        const uint8_t *colors = RLSW.array.colors;
+        // Referenced vertices range is transformed once, so shared vertices are not transformed again
+        // on every reference; sparse indices (range too big for indices count) transform every reference
+        uint32_t rangeCount = maxIndex - minIndex + 1;
+        sw_vertex_t *cache = (rangeCount <= 2*(uint32_t)count)? sw_vertex_cache_reserve((int)rangeCount) : NULL;
+        if (cache != NULL) sw_vertex_transform_batch(cache, (int)minIndex, (int)rangeCount);
 
         const uint8_t *indicesUb = (type == SW_UNSIGNED_BYTE)? indices : NULL;
         const uint16_t *indicesUs = (type == SW_UNSIGNED_SHORT)? indices : NULL;
@@ -4829,23 +7680,13 @@ void swDrawElements(SWdraw mode, int count, int type, const void *indices)
         {
             uint32_t index = indicesUb? (uint32_t)indicesUb[i] : (indicesUs? (uint32_t)indicesUs[i] : (uint32_t)indicesUi[i]);
 
-            if (texcoords) sw_immediate_set_texcoord(&texcoords[2*index]);
-
-            if (colors)
+            if (cache != NULL) sw_immediate_push_transformed(&cache[index - minIndex]);
+            else
             {
-                const uint8_t *c = &colors[4*index];
-                float color[4] = {
-                    (float)c[0]*SW_INV_255,
-                    (float)c[1]*SW_INV_255,
-                    (float)c[2]*SW_INV_255,
-                    (float)c[3]*SW_INV_255,
-                };
-                sw_immediate_set_color(color);
+                sw_vertex_t vertex;
+                sw_vertex_transform_batch(&vertex, (int)index, 1);
+                sw_immediate_push_transformed(&vertex);
             }
-
-            const float *p = &positions[3*index];
-            float position[4] = { p[0], p[1], p[2], 1.0f };
-            sw_immediate_push_vertex(position);
         }
     }
     sw_immediate_end();
@@ -4866,6 +7707,13 @@ void swGenTextures(int count, sw_handle_t *textures)
         sw_handle_t h = sw_pool_alloc(&RLSW.texturePool);
         if (h == SW_HANDLE_NULL) { RLSW.errCode = SW_OUT_OF_MEMORY; return; }
         textures[i] = h;
+
+        // Default texture parameters (spec)
+        sw_texture_t *tex = sw_pool_get(&RLSW.texturePool, h);
+        tex->minFilter = SW_NEAREST_MIPMAP_LINEAR;
+        tex->magFilter = SW_LINEAR;
+        tex->sWrap = SW_REPEAT;
+        tex->tWrap = SW_REPEAT;
     }
 }
 
@@ -4877,6 +7725,8 @@ void swDeleteTextures(int count, sw_handle_t *textures)
         return;
     }
 
+    sw_tiler_flush();
+
     if (!count || !textures) return;
 
     for (int i = 0; i < count; i++)
@@ -4902,22 +7752,126 @@ void swBindTexture(sw_handle_t id)
         return;
     }
 
-    if (id == SW_HANDLE_NULL)
+    if (id == SW_HANDLE_NULL)
+    {
+        RLSW.boundTexture = NULL;
+        return;
+    }
+
+    if (!sw_is_texture_valid(id))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    RLSW.boundTexture = sw_pool_get(&RLSW.texturePool, id);
+}
+
+void swTexStorage2D(int width, int height, SWinternalformat format)
+{
+    if (sw_immediate_is_active())
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    sw_tiler_flush();
+
+    if (RLSW.boundTexture == NULL) return;
+
+    int pixelFormat = SW_PIXELFORMAT_UNKNOWN;
+    switch (format)
+    {
+        case SW_LUMINANCE8: pixelFormat = SW_PIXELFORMAT_COLOR_GRAYSCALE; break;
+        case SW_LUMINANCE8_ALPHA8: pixelFormat = SW_PIXELFORMAT_COLOR_GRAYALPHA; break;
+        case SW_R3_G3_B2: pixelFormat = SW_PIXELFORMAT_COLOR_R3G3B2; break;
+        case SW_RGB8: pixelFormat = SW_PIXELFORMAT_COLOR_R8G8B8; break;
+        case SW_RGBA4: pixelFormat = SW_PIXELFORMAT_COLOR_R4G4B4A4; break;
+        case SW_RGB5_A1: pixelFormat = SW_PIXELFORMAT_COLOR_R5G5B5A1; break;
+        case SW_RGBA8: pixelFormat = SW_PIXELFORMAT_COLOR_R8G8B8A8; break;
+        case SW_R16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16; break;
+        case SW_RGB16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16G16B16; break;
+        case SW_RGBA16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16G16B16A16; break;
+        case SW_R32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32; break;
+        case SW_RGB32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32G32B32; break;
+        case SW_RGBA32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32G32B32A32; break;
+        case SW_DEPTH_COMPONENT16: pixelFormat = SW_PIXELFORMAT_DEPTH_D16; break;
+        case SW_DEPTH_COMPONENT24: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
+        case SW_DEPTH_COMPONENT32: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
+        case SW_DEPTH_COMPONENT32F: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
+        default: RLSW.errCode = SW_INVALID_ENUM; return;
+    }
+
+    (void)sw_texture_alloc(RLSW.boundTexture, NULL, width, height, pixelFormat);
+}
+
+void swTexImage2D(int width, int height, SWformat format, SWtype type, const void *data)
+{
+    swTexImage2DLevel(0, width, height, format, type, data);
+}
+
+void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, const void *data)
+{
+    if (sw_immediate_is_active())
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    sw_tiler_flush();
+
+    if (RLSW.boundTexture == NULL) return;
+
+    int pixelFormat = sw_pixel_get_format(format, type);
+    if (pixelFormat <= SW_PIXELFORMAT_UNKNOWN) { RLSW.errCode = SW_INVALID_ENUM; return; }
+
+    if (level == 0)
+    {
+        (void)sw_texture_alloc(RLSW.boundTexture, data, width, height, pixelFormat);
+        return;
+    }
+
+    // Mipmap levels must be defined in order, after the base level,
+    // with the base level format and the dimensions expected for the level
+    sw_texture_t *tex = RLSW.boundTexture;
+
+    if ((level < 0) || (level >= sw_texture_get_max_levels(tex->width, tex->height)))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    if (!sw_is_texture_complete(tex) || (level > tex->levelCount) || (pixelFormat != (int)tex->format))
     {
-        RLSW.boundTexture = NULL;
+        RLSW.errCode = SW_INVALID_OPERATION;
         return;
     }
 
-    if (!sw_is_texture_valid(id))
+    int levelWidth = tex->width >> level;
+    int levelHeight = tex->height >> level;
+    if ((width != ((levelWidth > 1)? levelWidth : 1)) || (height != ((levelHeight > 1)? levelHeight : 1)))
     {
         RLSW.errCode = SW_INVALID_VALUE;
         return;
     }
 
-    RLSW.boundTexture = sw_pool_get(&RLSW.texturePool, id);
+    if (!sw_texture_alloc_levels(tex, level + 1)) return;
+
+    const sw_texture_level_t *mip = &tex->levels[level];
+    int bpp = SW_PIXELFORMAT_SIZE[pixelFormat];
+
+    if (data != NULL) sw_texture_write_rows(tex, mip, 0, 0, width, height, (const uint8_t *)data, width*bpp);
+    else
+    {
+        int size = sw_texture_get_level_size(tex, mip)*bpp;
+        uint8_t *dst = (uint8_t *)tex->pixels + mip->offset*bpp;
+        for (int i = 0; i < size; i++) dst[i] = 0;
+    }
+
+    if (level == tex->levelCount) tex->levelCount++;
 }
 
-void swTexStorage2D(int width, int height, SWinternalformat format)
+void swCompressedTexImage2D(int level, int width, int height, SWinternalformat format, int imageSize, const void *data)
 {
     if (sw_immediate_is_active())
     {
@@ -4925,48 +7879,71 @@ void swTexStorage2D(int width, int height, SWinternalformat format)
         return;
     }
 
+    sw_tiler_flush();
+
     if (RLSW.boundTexture == NULL) return;
 
+    // NOTE: ETC1 is a subset of ETC2, ETC1 blocks never use the ETC2 modes
     int pixelFormat = SW_PIXELFORMAT_UNKNOWN;
     switch (format)
     {
-        case SW_LUMINANCE8: pixelFormat = SW_PIXELFORMAT_COLOR_GRAYSCALE; break;
-        case SW_LUMINANCE8_ALPHA8: pixelFormat = SW_PIXELFORMAT_COLOR_GRAYALPHA; break;
-        case SW_R3_G3_B2: pixelFormat = SW_PIXELFORMAT_COLOR_R3G3B2; break;
-        case SW_RGB8: pixelFormat = SW_PIXELFORMAT_COLOR_R8G8B8; break;
-        case SW_RGBA4: pixelFormat = SW_PIXELFORMAT_COLOR_R4G4B4A4; break;
-        case SW_RGB5_A1: pixelFormat = SW_PIXELFORMAT_COLOR_R5G5B5A1; break;
-        case SW_RGBA8: pixelFormat = SW_PIXELFORMAT_COLOR_R8G8B8A8; break;
-        case SW_R16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16; break;
-        case SW_RGB16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16G16B16; break;
-        case SW_RGBA16F: pixelFormat = SW_PIXELFORMAT_COLOR_R16G16B16A16; break;
-        case SW_R32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32; break;
-        case SW_RGB32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32G32B32; break;
-        case SW_RGBA32F: pixelFormat = SW_PIXELFORMAT_COLOR_R32G32B32A32; break;
-        case SW_DEPTH_COMPONENT16: pixelFormat = SW_PIXELFORMAT_DEPTH_D16; break;
-        case SW_DEPTH_COMPONENT24: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
-        case SW_DEPTH_COMPONENT32: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
-        case SW_DEPTH_COMPONENT32F: pixelFormat = SW_PIXELFORMAT_DEPTH_D32; break;
+        case SW_COMPRESSED_RGB_S3TC_DXT1: pixelFormat = SW_PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+        case SW_COMPRESSED_RGBA_S3TC_DXT1: pixelFormat = SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+        case SW_COMPRESSED_RGBA_S3TC_DXT3: pixelFormat = SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+        case SW_COMPRESSED_RGBA_S3TC_DXT5: pixelFormat = SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+        case SW_ETC1_RGB8: pixelFormat = SW_PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+        case SW_COMPRESSED_RGB8_ETC2: pixelFormat = SW_PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+        case SW_COMPRESSED_RGBA8_ETC2_EAC: pixelFormat = SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
         default: RLSW.errCode = SW_INVALID_ENUM; return;
     }
 
-    (void)sw_texture_alloc(RLSW.boundTexture, NULL, width, height, pixelFormat);
-}
+    int blocksSize = ((width + 3)/4)*((height + 3)/4)*SW_PIXELFORMAT_BLOCK_SIZE[pixelFormat];
+    if ((width <= 0) || (height <= 0) || (imageSize != blocksSize) || (data == NULL))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
 
-void swTexImage2D(int width, int height, SWformat format, SWtype type, const void *data)
-{
-    if (sw_immediate_is_active())
+    if (level == 0)
+    {
+        (void)sw_texture_alloc(RLSW.boundTexture, data, width, height, pixelFormat);
+        return;
+    }
+
+    // Mipmap levels are defined as for swTexImage2DLevel()
+    sw_texture_t *tex = RLSW.boundTexture;
+
+    if ((level < 0) || (level >= sw_texture_get_max_levels(tex->width, tex->height)))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
+
+    if (!sw_is_texture_complete(tex) || (level > tex->levelCount) || (pixelFormat != (int)tex->format))
     {
         RLSW.errCode = SW_INVALID_OPERATION;
         return;
     }
 
-    if (RLSW.boundTexture == NULL) return;
+    int levelWidth = tex->width >> level;
+    int levelHeight = tex->height >> level;
+    if ((width != ((levelWidth > 1)? levelWidth : 1)) || (height != ((levelHeight > 1)? levelHeight : 1)))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return;
+    }
 
-    int pixelFormat = sw_pixel_get_format(format, type);
-    if (pixelFormat <= SW_PIXELFORMAT_UNKNOWN) { RLSW.errCode = SW_INVALID_ENUM; return; }
+    if (!sw_texture_alloc_levels(tex, level + 1)) return;
 
-    (void)sw_texture_alloc(RLSW.boundTexture, data, width, height, pixelFormat);
+    // Blocks are provided in row-major order, the order of the level tiles
+    const sw_texture_level_t *mip = &tex->levels[level];
+    uint8_t *dst = (uint8_t *)tex->pixels + sw_pixel_get_data_size(tex->format, mip->offset);
+    const uint8_t *src = (const uint8_t *)data;
+    for (int i = 0; i < imageSize; i++) dst[i] = src[i];
+
+    RLSW_BLOCK_CACHE_EPOCH++;
+
+    if (level == tex->levelCount) tex->levelCount++;
 }
 
 void swTexSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
@@ -4977,6 +7954,8 @@ void swTexSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum for
         return;
     }
 
+    sw_tiler_flush();
+
     if (!sw_is_texture_complete(RLSW.boundTexture) || (!pixels) || (width <= 0) || (height <= 0))
     {
         RLSW.errCode = SW_INVALID_VALUE;
@@ -5005,26 +7984,13 @@ void swTexSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum for
     }
 
     const int srcPixelSize = SW_PIXELFORMAT_SIZE[srcPixelFormat];
-    const int dstPixelSize = SW_PIXELFORMAT_SIZE[RLSW.boundTexture->format];
 
     const uint8_t *srcBytes = (const uint8_t *)pixels;
     uint8_t *dstBytes = (uint8_t *)RLSW.boundTexture->pixels;
 
     if (srcPixelFormat == RLSW.boundTexture->format)
     {
-        const int rowSize = width*dstPixelSize;
-        const int dstStride = RLSW.boundTexture->width*dstPixelSize;
-        const int srcStride = width*srcPixelSize;
-
-        uint8_t *dstRow = dstBytes + (y*RLSW.boundTexture->width + x)*dstPixelSize;
-        const uint8_t *srcRow = srcBytes;
-
-        for (int j = 0; j < height; ++j)
-        {
-            for (int i = 0; i < rowSize; ++i) dstRow[i] = srcRow[i];
-            dstRow += dstStride;
-            srcRow += srcStride;
-        }
+        sw_texture_write_rows(RLSW.boundTexture, &RLSW.boundTexture->levels[0], x, y, width, height, srcBytes, width*srcPixelSize);
         return;
     }
 
@@ -5035,8 +8001,8 @@ void swTexSubImage2D(GLint x, GLint y, GLsizei width, GLsizei height, GLenum for
         for (int i = 0; i < width; ++i)
         {
             float color[4];
-            const int srcPixelOffset = ((j*width) + i)*srcPixelSize;
-            const int dstPixelOffset = (((y + j)*RLSW.boundTexture->width) + (x + i))*dstPixelSize;
+            const int srcPixelOffset = (j*width) + i;
+            const int dstPixelOffset = sw_texture_get_offset(RLSW.boundTexture, &RLSW.boundTexture->levels[0], x + i, y + j);
 
             readColor(color, srcBytes, srcPixelOffset);
             alphaFound |= (color[3] < 1.0f);
@@ -5056,13 +8022,15 @@ void swTexParameteri(int param, int value)
         return;
     }
 
+    sw_tiler_flush();
+
     if (RLSW.boundTexture == NULL) return;
 
     switch (param)
     {
         case SW_TEXTURE_MIN_FILTER:
         {
-            if (!sw_is_texture_filter_valid(value)) { RLSW.errCode = SW_INVALID_ENUM; return; }
+            if (!sw_is_texture_min_filter_valid(value)) { RLSW.errCode = SW_INVALID_ENUM; return; }
             RLSW.boundTexture->minFilter = (SWfilter)value;
         } break;
         case SW_TEXTURE_MAG_FILTER:
@@ -5084,6 +8052,27 @@ void swTexParameteri(int param, int value)
     }
 }
 
+void swGenerateMipmap(void)
+{
+    if (sw_immediate_is_active())
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    sw_tiler_flush();
+
+    // NOTE: Compressed textures mipmaps must be provided, blocks are not encoded
+    if (!sw_is_texture_complete(RLSW.boundTexture) || sw_pixel_is_depth_format(RLSW.boundTexture->format) ||
+        sw_pixel_is_compressed_format(RLSW.boundTexture->format))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    (void)sw_texture_generate_mipmaps(RLSW.boundTexture);
+}
+
 void swGenFramebuffers(int count, uint32_t *framebuffers)
 {
     if (sw_immediate_is_active())
@@ -5110,6 +8099,8 @@ void swDeleteFramebuffers(int count, uint32_t *framebuffers)
         return;
     }
 
+    sw_tiler_flush();
+
     if (!count || !framebuffers) return;
 
     for (int i = 0; i < count; i++)
@@ -5136,6 +8127,8 @@ void swBindFramebuffer(uint32_t id)
         return;
     }
 
+    sw_tiler_flush();
+
     if (id == SW_HANDLE_NULL)
     {
         RLSW.boundFramebufferId = SW_HANDLE_NULL;
@@ -5154,6 +8147,9 @@ void swBindFramebuffer(uint32_t id)
     RLSW.boundFramebufferId = id;
     RLSW.colorBuffer = sw_pool_get(&RLSW.texturePool, fb->colorAttachment);
     RLSW.depthBuffer = sw_pool_get(&RLSW.texturePool, fb->depthAttachment);
+
+    // Color attachments are rendered, texels must be stored linearly
+    if (RLSW.colorBuffer != NULL) (void)sw_texture_untile(RLSW.colorBuffer);
 }
 
 void swFramebufferTexture2D(SWattachment attach, uint32_t texture)
@@ -5164,6 +8160,8 @@ void swFramebufferTexture2D(SWattachment attach, uint32_t texture)
         return;
     }
 
+    sw_tiler_flush();
+
     sw_framebuffer_t *fb = sw_pool_get(&RLSW.framebufferPool, RLSW.boundFramebufferId);
     if (fb == NULL) return; // Should never happen
 
@@ -5173,6 +8171,7 @@ void swFramebufferTexture2D(SWattachment attach, uint32_t texture)
         {
             fb->colorAttachment = texture;
             RLSW.colorBuffer = sw_pool_get(&RLSW.texturePool, texture);
+            if (RLSW.colorBuffer != NULL) (void)sw_texture_untile(RLSW.colorBuffer);
         } break;
         case SW_DEPTH_ATTACHMENT:
         {
@@ -5264,13 +8263,20 @@ void swGetFramebufferAttachmentParameteriv(SWattachment attachment, SWattachget
     #define SW_ADD_GRAD_SCALED  sw_add_vertex_grad_scaled_PC
 #endif
 
-static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t *end, float dUdy, float dVdy)
+static void SW_RASTER_TRIANGLE_SPAN(const sw_raster_t *raster, const sw_vertex_t *start, const sw_vertex_t *end, const float dTdy[3])
 {
+#ifndef SW_ENABLE_TEXTURE
+    (void)dTdy;
+#endif
+
     // Gets the start/end coordinates and skip empty lines
     int xStart = (int)start->position[0];
     int xEnd = (int)end->position[0];
     if (xStart == xEnd) return;
 
+    // Skip spans outside the clip rectangle
+    if ((xEnd <= raster->clipMin[0]) || (xStart >= raster->clipMax[0])) return;
+
     // Compute the inverse horizontal distance along the X axis
     float dxRcp = 1.0f/(end->position[0] - start->position[0]);
 
@@ -5294,40 +8300,76 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
     float xSubstep = 1.0f - sw_fract(start->position[0]);
 
     // Initializing the interpolation starting values
-    float w = start->position[3] + dWdx*xSubstep;
-    float color[4] = {
+    float wStart = start->position[3] + dWdx*xSubstep;
+    float cStart[4] = {
         start->color[0] + dCdx[0]*xSubstep,
         start->color[1] + dCdx[1]*xSubstep,
         start->color[2] + dCdx[2]*xSubstep,
         start->color[3] + dCdx[3]*xSubstep
     };
 #ifdef SW_ENABLE_DEPTH_TEST
-    float z = start->position[2] + dZdx*xSubstep;
+    float zStart = start->position[2] + dZdx*xSubstep;
 #endif
 #ifdef SW_ENABLE_TEXTURE
-    float u = start->texcoord[0] + dUdx*xSubstep;
-    float v = start->texcoord[1] + dVdx*xSubstep;
+    float uStart = start->texcoord[0] + dUdx*xSubstep;
+    float vStart = start->texcoord[1] + dVdx*xSubstep;
 #endif
 
     // Pre-calculate the starting pointers for the framebuffer row
     int y = (int)start->position[1];
-    int baseOffset = y*RLSW.colorBuffer->width + xStart;
-    uint8_t *cPtr = (uint8_t *)(RLSW.colorBuffer->pixels) + baseOffset*SW_FRAMEBUFFER_COLOR_SIZE;
+    int rowOffset = y*RLSW.colorBuffer->width;
+    uint8_t *cRow = (uint8_t *)(RLSW.colorBuffer->pixels) + rowOffset*SW_FRAMEBUFFER_COLOR_SIZE;
 #ifdef SW_ENABLE_DEPTH_TEST
-    uint8_t *dPtr = (uint8_t *)(RLSW.depthBuffer->pixels) + baseOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
+    uint8_t *dRow = (uint8_t *)(RLSW.depthBuffer->pixels) + rowOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
 #endif
 
+    // Span is interpolated by blocks aligned on screen, values are computed from the span
+    // start on every block, so only the blocks overlapping the clip rectangle are visited
+    int xClipStart = raster->clipMin[0];
+    int xClipEnd = (xEnd < raster->clipMax[0])? xEnd : raster->clipMax[0];
+
 #define SW_AFFINE_BLOCK 16
 
-    int x = xStart;
-    while (x < xEnd)
+    int x = (xClipStart/SW_AFFINE_BLOCK)*SW_AFFINE_BLOCK;
+    if (x < xStart) x = xStart;
+
+    while (x < xClipEnd)
     {
         // Clamp last block to remaining pixels
-        int blockEnd = x + SW_AFFINE_BLOCK;
+        int blockEnd = (x/SW_AFFINE_BLOCK + 1)*SW_AFFINE_BLOCK;
         if (blockEnd > xEnd) blockEnd = xEnd;
         float blockLenF = (float)(blockEnd - x);
         float blockLenRcp = 1.0f/blockLenF;
 
+        float xOffset = (float)(x - xStart);
+
+    #ifdef SW_ENABLE_DEPTH_TEST
+        float z = zStart + dZdx*xOffset;
+
+        #if SW_USE_DEPTH_TILES
+        // Skip blocks behind the coarse depth of their tile row, before interpolation
+        float zLast = z + dZdx*(blockLenF - 1.0f);
+        if (sw_depth_tiles_row_occluded(RLSW.depthBuffer, x, y, (z < zLast)? z : zLast))
+        {
+            x = blockEnd;
+            continue;
+        }
+        #endif
+    #endif
+
+        // Perspective-space values at block start
+        float w = wStart + dWdx*xOffset;
+        float color[4] = {
+            cStart[0] + dCdx[0]*xOffset,
+            cStart[1] + dCdx[1]*xOffset,
+            cStart[2] + dCdx[2]*xOffset,
+            cStart[3] + dCdx[3]*xOffset
+        };
+    #ifdef SW_ENABLE_TEXTURE
+        float u = uStart + dUdx*xOffset;
+        float v = vStart + dVdx*xOffset;
+    #endif
+
         // Only 2 '1/w' here; none inside the pixel loop
         float wRcpA = 1.0f/w;
         float wB = w + dWdx*blockLenF;
@@ -5353,23 +8395,73 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
         float vAffine  = v*wRcpA;
         float dUaffine = ((u + dUdx*blockLenF)*wRcpB - uAffine)*blockLenRcp;
         float dVaffine = ((v + dVdx*blockLenF)*wRcpB - vAffine)*blockLenRcp;
+
+        // Texture level of detail, constant over the block
+        float dUaffinedy = (dTdy[0] - uAffine*dTdy[2])*wRcpA;
+        float dVaffinedy = (dTdy[1] - vAffine*dTdy[2])*wRcpA;
+        float lod = sw_texture_get_lod(raster->texture, dUaffine, dUaffinedy, dVaffine, dVaffinedy);
+    #endif
+
+        // Step the block pixels that are left of the clip rectangle
+        // NOTE: Only required if the clip rectangle is not aligned on blocks
+        for (; x < xClipStart; x++)
+        {
+            srcColor[0] += dSrcColordx[0];
+            srcColor[1] += dSrcColordx[1];
+            srcColor[2] += dSrcColordx[2];
+            srcColor[3] += dSrcColordx[3];
+        #ifdef SW_ENABLE_DEPTH_TEST
+            z += dZdx;
+        #endif
+        #ifdef SW_ENABLE_TEXTURE
+            uAffine += dUaffine;
+            vAffine += dVaffine;
+        #endif
+        }
+
+        uint8_t *cPtr = cRow + x*SW_FRAMEBUFFER_COLOR_SIZE;
+    #ifdef SW_ENABLE_DEPTH_TEST
+        uint8_t *dPtr = dRow + x*SW_FRAMEBUFFER_DEPTH_SIZE;
+    #endif
+
+        int pixelEnd = (blockEnd < xClipEnd)? blockEnd : xClipEnd;
+
+    #if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+        bool depthWritten = false;
+    #endif
+
+    #if SW_USE_FIXED_PIPELINE && !defined(SW_ENABLE_DEPTH_TEST)
+        // Block pixels processed at once on fixed-point pipeline
+        if (raster->fixedMode != SW_FIXED_DISABLED)
+        {
+        #ifdef SW_ENABLE_TEXTURE
+            sw_fixed_span(cPtr, pixelEnd - x, srcColor, dSrcColordx, raster->texture, uAffine, vAffine, dUaffine, dVaffine, raster->fixedMode);
+        #else
+            sw_fixed_span(cPtr, pixelEnd - x, srcColor, dSrcColordx, NULL, 0.0f, 0.0f, 0.0f, 0.0f, raster->fixedMode);
+        #endif
+            x = blockEnd;
+            continue;
+        }
     #endif
 
         // Inner span pixel loop
-        for (; x < blockEnd; x++)
+        for (; x < pixelEnd; x++)
         {
             #ifdef SW_ENABLE_DEPTH_TEST
             {
                 float depth = SW_FRAMEBUFFER_DEPTH_GET(dPtr, 0);
                 if (z > depth) goto discard;
                 SW_FRAMEBUFFER_DEPTH_SET(dPtr, z, 0);
+                #if SW_USE_DEPTH_TILES
+                    depthWritten = true;
+                #endif
             }
             #endif
 
             #ifdef SW_ENABLE_TEXTURE
             {
                 float texColor[4];
-                sw_texture_sample(texColor, RLSW.boundTexture, uAffine, vAffine, dUdx, dUdy, dVdx, dVdy);
+                sw_texture_sample(texColor, raster->texture, uAffine, vAffine, lod);
                 float finalColor[4] = {
                     srcColor[0]*texColor[0],
                     srcColor[1]*texColor[1],
@@ -5380,7 +8472,7 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
                 {
                     float dstColor[4];
                     SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
-                    RLSW.blendFunc(dstColor, finalColor);
+                    raster->blendFunc(dstColor, finalColor);
                     SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
                 }
                 #else
@@ -5393,7 +8485,7 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
                 {
                     float dstColor[4];
                     SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
-                    RLSW.blendFunc(dstColor, srcColor);
+                    raster->blendFunc(dstColor, srcColor);
                     SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
                 }
                 #else
@@ -5402,7 +8494,9 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
             }
             #endif
 
+        #ifdef SW_ENABLE_DEPTH_TEST
         discard:
+        #endif
             srcColor[0] += dSrcColordx[0];
             srcColor[1] += dSrcColordx[1];
             srcColor[2] += dSrcColordx[2];
@@ -5424,22 +8518,17 @@ static void SW_RASTER_TRIANGLE_SPAN(const sw_vertex_t *start, const sw_vertex_t
             #endif
         }
 
-        // Advance perspective-space accumulators by the full block width
-        w = wB;
-        color[0] += dCdx[0]*blockLenF;
-        color[1] += dCdx[1]*blockLenF;
-        color[2] += dCdx[2]*blockLenF;
-        color[3] += dCdx[3]*blockLenF;
-        #ifdef SW_ENABLE_TEXTURE
-        u += dUdx*blockLenF;
-        v += dVdx*blockLenF;
-        #endif
+    #if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+        if (depthWritten) sw_depth_tiles_update(RLSW.depthBuffer, x - 1, y);
+    #endif
+
+        x = blockEnd;
     }
 
 #undef SW_AFFINE_BLOCK
 }
 
-static void SW_RASTER_TRIANGLE(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2)
+static void SW_RASTER_TRIANGLE(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2)
 {
     // Swap vertices by increasing Y
     if (v0->position[1] > v1->position[1]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; }
@@ -5450,6 +8539,7 @@ static void SW_RASTER_TRIANGLE(const sw_vertex_t *v0, const sw_vertex_t *v1, con
     float x0 = v0->position[0], y0 = v0->position[1];
     float x1 = v1->position[0], y1 = v1->position[1];
     float x2 = v2->position[0], y2 = v2->position[1];
+    (void)x0; (void)x1; (void)x2;   // NOTE: Only required for texture level of detail and depth tiles
 
     // Compute height differences
     float h02 = y2 - y0;
@@ -5469,46 +8559,91 @@ static void SW_RASTER_TRIANGLE(const sw_vertex_t *v0, const sw_vertex_t *v1, con
     SW_GET_GRAD(&dVXdy01, v0, v1, h01Rcp);
     SW_GET_GRAD(&dVXdy12, v1, v2, h12Rcp);
 
+    // Texcoords and 1/w gradients along Y on the triangle plane, for texture level of detail
+    float dTdy[3] = { 0 };
+#ifdef SW_ENABLE_TEXTURE
+    float area = (x1 - x0)*h02 - (x2 - x0)*h01;
+    if (fabsf(area) > 1e-6f)
+    {
+        float areaRcp = 1.0f/area;
+        dTdy[0] = ((x1 - x0)*(v2->texcoord[0] - v0->texcoord[0]) - (x2 - x0)*(v1->texcoord[0] - v0->texcoord[0]))*areaRcp;
+        dTdy[1] = ((x1 - x0)*(v2->texcoord[1] - v0->texcoord[1]) - (x2 - x0)*(v1->texcoord[1] - v0->texcoord[1]))*areaRcp;
+        dTdy[2] = ((x1 - x0)*(v2->position[3] - v0->position[3]) - (x2 - x0)*(v1->position[3] - v0->position[3]))*areaRcp;
+    }
+#endif
+
     // Y subpixel correction
     float y0Substep = 1.0f - sw_fract(y0);
     float y1Substep = 1.0f - sw_fract(y1);
 
     // Get a copy of vertices for interpolation and apply substep correction
-    sw_vertex_t lVert = *v0, rVert = *v0;
-    SW_ADD_GRAD_SCALED(&lVert, &dVXdy02, y0Substep);
-    SW_ADD_GRAD_SCALED(&rVert, &dVXdy01, y0Substep);
+    sw_vertex_t lBase = *v0, rBase = *v0;
+    SW_ADD_GRAD_SCALED(&lBase, &dVXdy02, y0Substep);
+    SW_ADD_GRAD_SCALED(&rBase, &dVXdy01, y0Substep);
 
     // Y bounds (vertical clipping)
     int yTop = (int)y0;
     int yMid = (int)y1;
     int yBot = (int)y2;
 
+    // Scanlines are interpolated from the edges start, so only
+    // the scanlines inside the clip rectangle are visited
+    int yClipMin = raster->clipMin[1];
+    int yClipMax = raster->clipMax[1];
+
+#if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+    // Skip triangles behind the coarse depth of all the tiles overlapped by their bounding box
+    {
+        float xMinF = (x0 < x1)? ((x0 < x2)? x0 : x2) : ((x1 < x2)? x1 : x2);
+        float xMaxF = (x0 > x1)? ((x0 > x2)? x0 : x2) : ((x1 > x2)? x1 : x2);
+        float zMin = v0->position[2];
+        if (v1->position[2] < zMin) zMin = v1->position[2];
+        if (v2->position[2] < zMin) zMin = v2->position[2];
+
+        int xBoxMin = ((int)xMinF > raster->clipMin[0])? (int)xMinF : raster->clipMin[0];
+        int xBoxMax = ((int)xMaxF + 1 < raster->clipMax[0])? (int)xMaxF + 1 : raster->clipMax[0];
+        int yBoxMin = (yTop > yClipMin)? yTop : yClipMin;
+        int yBoxMax = (yBot + 1 < yClipMax)? yBot + 1 : yClipMax;
+
+        if ((xBoxMin < xBoxMax) && (yBoxMin < yBoxMax) &&
+            sw_depth_tiles_rect_occluded(RLSW.depthBuffer, xBoxMin, yBoxMin, xBoxMax, yBoxMax, zMin)) return;
+    }
+#endif
+
     // Scanline for the upper part of the triangle
-    for (int y = yTop; y < yMid; y++)
+    int yStart = (yTop > yClipMin)? yTop : yClipMin;
+    int yEnd = (yMid < yClipMax)? yMid : yClipMax;
+    for (int y = yStart; y < yEnd; y++)
     {
+        sw_vertex_t lVert = lBase, rVert = rBase;
+        SW_ADD_GRAD_SCALED(&lVert, &dVXdy02, (float)(y - yTop));
+        SW_ADD_GRAD_SCALED(&rVert, &dVXdy01, (float)(y - yTop));
+
         lVert.position[1] = rVert.position[1] = y;
         bool longSideIsLeft = (lVert.position[0] < rVert.position[0]);
         const sw_vertex_t *a = longSideIsLeft? &lVert : &rVert;
         const sw_vertex_t *b = longSideIsLeft? &rVert : &lVert;
-        SW_RASTER_TRIANGLE_SPAN(a, b, dVXdy02.texcoord[0], dVXdy02.texcoord[1]);
-        SW_ADD_GRAD(&lVert, &dVXdy02);
-        SW_ADD_GRAD(&rVert, &dVXdy01);
+        SW_RASTER_TRIANGLE_SPAN(raster, a, b, dTdy);
     }
 
     // Get a copy of next right for interpolation and apply substep correction
-    rVert = *v1;
-    SW_ADD_GRAD_SCALED(&rVert, &dVXdy12, y1Substep);
+    rBase = *v1;
+    SW_ADD_GRAD_SCALED(&rBase, &dVXdy12, y1Substep);
 
     // Scanline for the lower part of the triangle
-    for (int y = yMid; y < yBot; y++)
+    yStart = (yMid > yClipMin)? yMid : yClipMin;
+    yEnd = (yBot < yClipMax)? yBot : yClipMax;
+    for (int y = yStart; y < yEnd; y++)
     {
+        sw_vertex_t lVert = lBase, rVert = rBase;
+        SW_ADD_GRAD_SCALED(&lVert, &dVXdy02, (float)(y - yTop));
+        SW_ADD_GRAD_SCALED(&rVert, &dVXdy12, (float)(y - yMid));
+
         lVert.position[1] = rVert.position[1] = y;
         bool longSideIsLeft = (lVert.position[0] < rVert.position[0]);
         const sw_vertex_t *a = longSideIsLeft? &lVert : &rVert;
         const sw_vertex_t *b = longSideIsLeft? &rVert : &lVert;
-        SW_RASTER_TRIANGLE_SPAN(a, b, dVXdy02.texcoord[0], dVXdy02.texcoord[1]);
-        SW_ADD_GRAD(&lVert, &dVXdy02);
-        SW_ADD_GRAD(&rVert, &dVXdy12);
+        SW_RASTER_TRIANGLE_SPAN(raster, a, b, dTdy);
     }
 }
 
@@ -5534,7 +8669,7 @@ static void SW_RASTER_TRIANGLE(const sw_vertex_t *v0, const sw_vertex_t *v1, con
 // NOTE: This function should only render affine axis-aligned quads
 //       No perspective divide is applied after interpolation
 
-static void SW_RASTER_QUAD(const sw_vertex_t *a, const sw_vertex_t *b,
+static void SW_RASTER_QUAD(const sw_raster_t *raster, const sw_vertex_t *a, const sw_vertex_t *b,
                            const sw_vertex_t *c, const sw_vertex_t *d)
 {
     // Classify corners
@@ -5594,6 +8729,9 @@ static void SW_RASTER_QUAD(const sw_vertex_t *a, const sw_vertex_t *b,
     float dVdy = (bl->texcoord[1] - tl->texcoord[1])*hRcp;
     float uRow = tl->texcoord[0] + dUdx*xSubstep + dUdy*ySubstep;
     float vRow = tl->texcoord[1] + dVdx*xSubstep + dVdy*ySubstep;
+
+    // Texture level of detail, constant over the quad
+    float lod = sw_texture_get_lod(raster->texture, dUdx, dUdy, dVdx, dVdy);
 #endif
 
     float cRow[4] = {
@@ -5603,103 +8741,198 @@ static void SW_RASTER_QUAD(const sw_vertex_t *a, const sw_vertex_t *b,
         tl->color[3] + dCdx[3]*xSubstep + dCdy[3]*ySubstep,
     };
 
+    // Horizontal span covered by the clip rectangle
+    int xStart = (xMin > raster->clipMin[0])? xMin : raster->clipMin[0];
+    int xEnd = (xMax < raster->clipMax[0])? xMax : raster->clipMax[0];
+    if (xStart >= xEnd) return;
+
+    // Vertical span covered by the clip rectangle
+    int yStart = (yMin > raster->clipMin[1])? yMin : raster->clipMin[1];
+    int yEnd = (yMax < raster->clipMax[1])? yMax : raster->clipMax[1];
+
+#if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+    // Skip quads behind the coarse depth of all the tiles they overlap
+    // NOTE: Depth is interpolated from the top-left, top-right and bottom-left corners
+    {
+        float zBr = tr->position[2] + bl->position[2] - tl->position[2];
+        float zMin = tl->position[2];
+        if (tr->position[2] < zMin) zMin = tr->position[2];
+        if (bl->position[2] < zMin) zMin = bl->position[2];
+        if (zBr < zMin) zMin = zBr;
+
+        if ((yStart < yEnd) && sw_depth_tiles_rect_occluded(RLSW.depthBuffer, xStart, yStart, xEnd, yEnd, zMin)) return;
+    }
+#endif
+
+    // Rows are interpolated from the quad top edge, by blocks aligned on screen, so
+    // only the rows and blocks overlapping the clip rectangle are visited
+#define SW_QUAD_BLOCK 16
+
+    int xBlock = (xStart/SW_QUAD_BLOCK)*SW_QUAD_BLOCK;
+    if (xBlock < xMin) xBlock = xMin;
+
     int stride = RLSW.colorBuffer->width;
     uint8_t *cPixels = RLSW.colorBuffer->pixels;
 #ifdef SW_ENABLE_DEPTH_TEST
     uint8_t *dPixels = RLSW.depthBuffer->pixels;
 #endif
 
-    for (int y = yMin; y < yMax; y++)
+    for (int y = yStart; y < yEnd; y++)
     {
-        int baseOffset = y*stride + xMin;
-        uint8_t *cPtr = cPixels + baseOffset*SW_FRAMEBUFFER_COLOR_SIZE;
+        // Row values at quad left edge
+        float yOffset = (float)(y - yMin);
+        float color0[4] = {
+            cRow[0] + dCdy[0]*yOffset,
+            cRow[1] + dCdy[1]*yOffset,
+            cRow[2] + dCdy[2]*yOffset,
+            cRow[3] + dCdy[3]*yOffset
+        };
     #ifdef SW_ENABLE_DEPTH_TEST
-        uint8_t *dPtr = dPixels + baseOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
-        float z = zRow;
+        float z0 = zRow + dZdy*yOffset;
     #endif
     #ifdef SW_ENABLE_TEXTURE
-        float u = uRow;
-        float v = vRow;
+        float u0 = uRow + dUdy*yOffset;
+        float v0 = vRow + dVdy*yOffset;
     #endif
-        float color[4] = { cRow[0], cRow[1], cRow[2], cRow[3] };
 
-        for (int x = xMin; x < xMax; x++)
+        for (int xb = xBlock; xb < xEnd; xb = (xb/SW_QUAD_BLOCK + 1)*SW_QUAD_BLOCK)
         {
-            float srcColor[4] = { color[0], color[1], color[2], color[3] };
+            float xOffset = (float)(xb - xMin);
+            int blockEnd = (xb/SW_QUAD_BLOCK + 1)*SW_QUAD_BLOCK;
+            if (blockEnd > xEnd) blockEnd = xEnd;
+
+            float color[4] = {
+                color0[0] + dCdx[0]*xOffset,
+                color0[1] + dCdx[1]*xOffset,
+                color0[2] + dCdx[2]*xOffset,
+                color0[3] + dCdx[3]*xOffset
+            };
+        #ifdef SW_ENABLE_DEPTH_TEST
+            float z = z0 + dZdx*xOffset;
 
-            #ifdef SW_ENABLE_DEPTH_TEST
-            {
-                float depth = SW_FRAMEBUFFER_DEPTH_GET(dPtr, 0);
-                if (z > depth) goto discard;
-                SW_FRAMEBUFFER_DEPTH_SET(dPtr, z, 0);
-            }
+            #if SW_USE_DEPTH_TILES
+            // Skip blocks behind the coarse depth of their tile row
+            float zLast = z + dZdx*(float)(blockEnd - 1 - xb);
+            if (sw_depth_tiles_row_occluded(RLSW.depthBuffer, xb, y, (z < zLast)? z : zLast)) continue;
             #endif
+        #endif
+        #ifdef SW_ENABLE_TEXTURE
+            float u = u0 + dUdx*xOffset;
+            float v = v0 + dVdx*xOffset;
+        #endif
 
-            #ifdef SW_ENABLE_TEXTURE
+            // Step the pixels of the first block that are left of the clip rectangle
+            // NOTE: Only required if the clip rectangle is not aligned on blocks
+            int x = xb;
+            for (; x < xStart; x++)
             {
-                float texColor[4];
-                sw_texture_sample(texColor, RLSW.boundTexture, u, v, dUdx, dUdy, dVdx, dVdy);
-                srcColor[0] *= texColor[0];
-                srcColor[1] *= texColor[1];
-                srcColor[2] *= texColor[2];
-                srcColor[3] *= texColor[3];
-            }
+                color[0] += dCdx[0];
+                color[1] += dCdx[1];
+                color[2] += dCdx[2];
+                color[3] += dCdx[3];
+            #ifdef SW_ENABLE_DEPTH_TEST
+                z += dZdx;
             #endif
+            #ifdef SW_ENABLE_TEXTURE
+                u += dUdx;
+                v += dVdx;
+            #endif
+            }
+
+            int baseOffset = y*stride + x;
+            uint8_t *cPtr = cPixels + baseOffset*SW_FRAMEBUFFER_COLOR_SIZE;
+        #ifdef SW_ENABLE_DEPTH_TEST
+            uint8_t *dPtr = dPixels + baseOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
+        #endif
 
-            #ifdef SW_ENABLE_BLEND
+        #if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+            bool depthWritten = false;
+        #endif
+
+        #if SW_USE_FIXED_PIPELINE && !defined(SW_ENABLE_DEPTH_TEST)
+            // Block pixels processed at once on fixed-point pipeline
+            if (raster->fixedMode != SW_FIXED_DISABLED)
             {
-                float dstColor[4];
-                SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
-                RLSW.blendFunc(dstColor, srcColor);
-                SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
-            }
+            #ifdef SW_ENABLE_TEXTURE
+                sw_fixed_span(cPtr, blockEnd - x, color, dCdx, raster->texture, u, v, dUdx, dVdx, raster->fixedMode);
             #else
-            {
-                SW_FRAMEBUFFER_COLOR_SET(cPtr, srcColor, 0);
-            }
+                sw_fixed_span(cPtr, blockEnd - x, color, dCdx, NULL, 0.0f, 0.0f, 0.0f, 0.0f, raster->fixedMode);
             #endif
+                continue;
+            }
+        #endif
 
-        discard:
-            color[0] += dCdx[0];
-            color[1] += dCdx[1];
-            color[2] += dCdx[2];
-            color[3] += dCdx[3];
+            for (; x < blockEnd; x++)
+            {
+                float srcColor[4] = { color[0], color[1], color[2], color[3] };
+
+                #ifdef SW_ENABLE_DEPTH_TEST
+                {
+                    float depth = SW_FRAMEBUFFER_DEPTH_GET(dPtr, 0);
+                    if (z > depth) goto discard;
+                    SW_FRAMEBUFFER_DEPTH_SET(dPtr, z, 0);
+                    #if SW_USE_DEPTH_TILES
+                        depthWritten = true;
+                    #endif
+                }
+                #endif
+
+                #ifdef SW_ENABLE_TEXTURE
+                {
+                    float texColor[4];
+                    sw_texture_sample(texColor, raster->texture, u, v, lod);
+                    srcColor[0] *= texColor[0];
+                    srcColor[1] *= texColor[1];
+                    srcColor[2] *= texColor[2];
+                    srcColor[3] *= texColor[3];
+                }
+                #endif
+
+                #ifdef SW_ENABLE_BLEND
+                {
+                    float dstColor[4];
+                    SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
+                    raster->blendFunc(dstColor, srcColor);
+                    SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
+                }
+                #else
+                {
+                    SW_FRAMEBUFFER_COLOR_SET(cPtr, srcColor, 0);
+                }
+                #endif
 
             #ifdef SW_ENABLE_DEPTH_TEST
-            {
-                z += dZdx;
-                dPtr += SW_FRAMEBUFFER_DEPTH_SIZE;
-            }
+            discard:
             #endif
+                color[0] += dCdx[0];
+                color[1] += dCdx[1];
+                color[2] += dCdx[2];
+                color[3] += dCdx[3];
 
-            #ifdef SW_ENABLE_TEXTURE
-            {
-                u += dUdx;
-                v += dVdx;
-            }
-            #endif
+                #ifdef SW_ENABLE_DEPTH_TEST
+                {
+                    z += dZdx;
+                    dPtr += SW_FRAMEBUFFER_DEPTH_SIZE;
+                }
+                #endif
 
-            cPtr += SW_FRAMEBUFFER_COLOR_SIZE;
-        }
+                #ifdef SW_ENABLE_TEXTURE
+                {
+                    u += dUdx;
+                    v += dVdx;
+                }
+                #endif
 
-        cRow[0] += dCdy[0];
-        cRow[1] += dCdy[1];
-        cRow[2] += dCdy[2];
-        cRow[3] += dCdy[3];
+                cPtr += SW_FRAMEBUFFER_COLOR_SIZE;
+            }
 
-        #ifdef SW_ENABLE_DEPTH_TEST
-        {
-            zRow += dZdy;
-        }
+        #if defined(SW_ENABLE_DEPTH_TEST) && SW_USE_DEPTH_TILES
+            if (depthWritten) sw_depth_tiles_update(RLSW.depthBuffer, xb, y);
         #endif
-
-        #ifdef SW_ENABLE_TEXTURE
-        {
-            uRow += dUdy;
-            vRow += dVdy;
         }
-        #endif
     }
+
+#undef SW_QUAD_BLOCK
 }
 
 #endif // RLSW_TEMPLATE_RASTER_QUAD
@@ -5717,7 +8950,7 @@ static void SW_RASTER_QUAD(const sw_vertex_t *a, const sw_vertex_t *b,
 #define SW_RASTER_LINE       SW_CONCATX(sw_raster_line_, RLSW_TEMPLATE_RASTER_LINE)
 #define SW_RASTER_LINE_THICK SW_CONCATX(sw_raster_line_thick_, RLSW_TEMPLATE_RASTER_LINE)
 
-static void SW_RASTER_LINE(const sw_vertex_t *v0, const sw_vertex_t *v1)
+static void SW_RASTER_LINE(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1)
 {
     // Convert from pixel-center convention (n+0.5) to pixel-origin convention (n)
     float x0 = v0->position[0] - 0.5f;
@@ -5756,15 +8989,15 @@ static void SW_RASTER_LINE(const sw_vertex_t *v0, const sw_vertex_t *v1)
     float aInc = (v1->color[3] - v0->color[3])*stepRcp;
 
     // Initializing the interpolation starting values
-    float x = x0 + xInc*substep;
-    float y = y0 + yInc*substep;
+    float xStart = x0 + xInc*substep;
+    float yStart = y0 + yInc*substep;
 #ifdef SW_ENABLE_DEPTH_TEST
-    float z = v0->position[2] + zInc*substep;
+    float zStart = v0->position[2] + zInc*substep;
 #endif
-    float r = v0->color[0] + rInc*substep;
-    float g = v0->color[1] + gInc*substep;
-    float b = v0->color[2] + bInc*substep;
-    float a = v0->color[3] + aInc*substep;
+    float rStart = v0->color[0] + rInc*substep;
+    float gStart = v0->color[1] + gInc*substep;
+    float bStart = v0->color[2] + bInc*substep;
+    float aStart = v0->color[3] + aInc*substep;
 
     // Start line rasterization
     const int fbWidth = RLSW.colorBuffer->width;
@@ -5775,35 +9008,51 @@ static void SW_RASTER_LINE(const sw_vertex_t *v0, const sw_vertex_t *v1)
 
     int numPixels = (int)(steps - substep) + 1;
 
-    for (int i = 0; i < numPixels; i++)
+    // Pixels are interpolated from the line start, so only
+    // the steps inside the clip rectangle are visited
+    int iStart = 0, iEnd = numPixels;
+    sw_line_step_range(xStart, xInc, raster->clipMin[0], raster->clipMax[0], &iStart, &iEnd);
+    sw_line_step_range(yStart, yInc, raster->clipMin[1], raster->clipMax[1], &iStart, &iEnd);
+
+    for (int i = iStart; i < iEnd; i++)
     {
-        int px = x;
-        int py = y;
+        float step = (float)i;
+        int px = xStart + xInc*step;
+        int py = yStart + yInc*step;
+
+        // Skip pixels outside the clip rectangle
+        if ((px < raster->clipMin[0]) || (px >= raster->clipMax[0]) ||
+            (py < raster->clipMin[1]) || (py >= raster->clipMax[1])) continue;
 
         int baseOffset = py*fbWidth + px;
         uint8_t *cPtr = cPixels + baseOffset*SW_FRAMEBUFFER_COLOR_SIZE;
-    #ifdef SW_ENABLE_DEPTH_TEST
-        uint8_t *dPtr = dPixels + baseOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
-    #endif
 
         #ifdef SW_ENABLE_DEPTH_TEST
         {
+            uint8_t *dPtr = dPixels + baseOffset*SW_FRAMEBUFFER_DEPTH_SIZE;
+            float z = zStart + zInc*step;
+
             // TODO: Implement different depth funcs?
             float depth = SW_FRAMEBUFFER_DEPTH_GET(dPtr, 0);
-            if (z > depth) goto discard;
+            if (z > depth) continue;
 
             // TODO: Implement depth mask
             SW_FRAMEBUFFER_DEPTH_SET(dPtr, z, 0);
         }
         #endif
 
-        float srcColor[4] = {r, g, b, a};
+        float srcColor[4] = {
+            rStart + rInc*step,
+            gStart + gInc*step,
+            bStart + bInc*step,
+            aStart + aInc*step
+        };
 
         #ifdef SW_ENABLE_BLEND
         {
             float dstColor[4];
             SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
-            RLSW.blendFunc(dstColor, srcColor);
+            raster->blendFunc(dstColor, srcColor);
             SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
         }
         #else
@@ -5811,23 +9060,10 @@ static void SW_RASTER_LINE(const sw_vertex_t *v0, const sw_vertex_t *v1)
             SW_FRAMEBUFFER_COLOR_SET(cPtr, srcColor, 0);
         }
         #endif
-
-    discard:
-        x += xInc;
-        y += yInc;
-        #ifdef SW_ENABLE_DEPTH_TEST
-        {
-            z += zInc;
-        }
-        #endif
-        r += rInc;
-        g += gInc;
-        b += bInc;
-        a += aInc;
     }
 }
 
-static void SW_RASTER_LINE_THICK(const sw_vertex_t *v0, const sw_vertex_t *v1)
+static void SW_RASTER_LINE_THICK(const sw_raster_t *raster, const sw_vertex_t *v0, const sw_vertex_t *v1)
 {
     sw_vertex_t tv0, tv1;
 
@@ -5839,38 +9075,38 @@ static void SW_RASTER_LINE_THICK(const sw_vertex_t *v0, const sw_vertex_t *v1)
     int dx = x1 - x0;
     int dy = y1 - y0;
 
-    SW_RASTER_LINE(v0, v1);
+    SW_RASTER_LINE(raster, v0, v1);
 
     if ((dx != 0) && (abs(dy/dx) < 1))
     {
-        int wy = (int)((RLSW.lineWidth - 1.0f)*abs(dx)/sqrtf(dx*dx + dy*dy));
+        int wy = (int)((raster->lineWidth - 1.0f)*abs(dx)/sqrtf(dx*dx + dy*dy));
         wy >>= 1;
         for (int i = 1; i <= wy; i++)
         {
             tv0 = *v0, tv1 = *v1;
             tv0.position[1] -= i;
             tv1.position[1] -= i;
-            SW_RASTER_LINE(&tv0, &tv1);
+            SW_RASTER_LINE(raster, &tv0, &tv1);
             tv0 = *v0, tv1 = *v1;
             tv0.position[1] += i;
             tv1.position[1] += i;
-            SW_RASTER_LINE(&tv0, &tv1);
+            SW_RASTER_LINE(raster, &tv0, &tv1);
         }
     }
     else if (dy != 0)
     {
-        int wx = (int)((RLSW.lineWidth - 1.0f)*abs(dy)/sqrtf(dx*dx + dy*dy));
+        int wx = (int)((raster->lineWidth - 1.0f)*abs(dy)/sqrtf(dx*dx + dy*dy));
         wx >>= 1;
         for (int i = 1; i <= wx; i++)
         {
             tv0 = *v0, tv1 = *v1;
             tv0.position[0] -= i;
             tv1.position[0] -= i;
-            SW_RASTER_LINE(&tv0, &tv1);
+            SW_RASTER_LINE(raster, &tv0, &tv1);
             tv0 = *v0, tv1 = *v1;
             tv0.position[0] += i;
             tv1.position[0] += i;
-            SW_RASTER_LINE(&tv0, &tv1);
+            SW_RASTER_LINE(raster, &tv0, &tv1);
         }
     }
 }
@@ -5890,8 +9126,9 @@ static void SW_RASTER_LINE_THICK(const sw_vertex_t *v0, const sw_vertex_t *v1)
 #define SW_RASTER_POINT_PIXEL SW_CONCATX(sw_raster_point_pixel_, RLSW_TEMPLATE_RASTER_POINT)
 #define SW_RASTER_POINT       SW_CONCATX(sw_raster_point_, RLSW_TEMPLATE_RASTER_POINT)
 
-static void SW_RASTER_POINT_PIXEL(int x, int y, float z, const float color[4])
+static void SW_RASTER_POINT_PIXEL(const sw_raster_t *raster, int x, int y, float z, const float color[4])
 {
+    (void)z;    // NOTE: Only required for depth test
     int offset = y*RLSW.colorBuffer->width + x;
 
     #ifdef SW_ENABLE_DEPTH_TEST
@@ -5913,29 +9150,36 @@ static void SW_RASTER_POINT_PIXEL(int x, int y, float z, const float color[4])
     {
         float dstColor[4];
         SW_FRAMEBUFFER_COLOR_GET(dstColor, cPtr, 0);
-        RLSW.blendFunc(dstColor, color);
+        raster->blendFunc(dstColor, color);
         SW_FRAMEBUFFER_COLOR_SET(cPtr, dstColor, 0);
     }
     #else
     {
+        (void)raster;
         SW_FRAMEBUFFER_COLOR_SET(cPtr, color, 0);
     }
     #endif
 }
 
-static void SW_RASTER_POINT(const sw_vertex_t *v)
+static void SW_RASTER_POINT(const sw_raster_t *raster, const sw_vertex_t *v)
 {
     int cx = v->position[0];
     int cy = v->position[1];
     float cz = v->position[2];
-    int radius = RLSW.pointRadius;
+    int radius = raster->pointRadius;
     const float *color = v->color;
 
-    for (int dy = -radius; dy <= radius; dy++)
+    // Point square limited to the clip rectangle
+    int xMin = sw_clamp_int(cx - radius, raster->clipMin[0], raster->clipMax[0]);
+    int yMin = sw_clamp_int(cy - radius, raster->clipMin[1], raster->clipMax[1]);
+    int xMax = sw_clamp_int(cx + radius + 1, raster->clipMin[0], raster->clipMax[0]);
+    int yMax = sw_clamp_int(cy + radius + 1, raster->clipMin[1], raster->clipMax[1]);
+
+    for (int y = yMin; y < yMax; y++)
     {
-        for (int dx = -radius; dx <= radius; dx++)
+        for (int x = xMin; x < xMax; x++)
         {
-            SW_RASTER_POINT_PIXEL(cx + dx, cy + dy, cz, color);
+            SW_RASTER_POINT_PIXEL(raster, x, y, cz, color);
         }
     }
 }
@@ -0,0 +1,220 @@
+/**********************************************************************************************
+*
+*   rlsw_bench_compressed - rlsw compressed textures decoding and sampling benchmark
+*
+*   DESCRIPTION:
+*       Standalone program measuring DXT/ETC2 blocks decoding throughput (internal block decoder)
+*       and compressed textures sampling (decoded blocks cache) against the same texels uploaded
+*       as RGBA8, rendering a rotated textured quad with nearest and bilinear filtering.
+*       Frames rendered from compressed and RGBA8 textures must be identical
+*
+*   BUILD:
+*       gcc -O2 -march=native -DRLSW_USE_SIMD_INTRINSICS=1 rlsw_bench_compressed.c -o bench_compressed -lm -lpthread
+*
+*       Decoded blocks cache size can be measured defining SW_BLOCK_CACHE_SIZE (i.e. -DSW_BLOCK_CACHE_SIZE=64)
+*
+*   LICENSE: zlib/libpng
+*
+**********************************************************************************************/
+
+#define RLSW_IMPLEMENTATION
+#include "rlsw.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free(), rand(), srand()
+#include <string.h>         // Required for: memcpy(), memcmp()
+#include <time.h>           // Required for: timespec_get()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_WIDTH         1000        // Framebuffer width
+#define BENCH_HEIGHT         700        // Framebuffer height
+#define BENCH_TEXTURE_SIZE  1024        // Sampled textures size
+#define BENCH_DECODE_BLOCKS (1 << 16)   // Blocks decoded per decoding run
+#define BENCH_DECODE_RUNS     10        // Decoding runs per format, best run is reported
+#define BENCH_RENDER_RUNS     30        // Rendering runs per texture, best run is reported
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Compressed format benchmarked
+typedef struct BenchFormat {
+    const char *name;                   // Format name
+    SWinternalformat internalFormat;    // Format used on upload
+    sw_pixelformat_t pixelFormat;       // Format used on decoding
+    int blockSize;                      // Block size (bytes)
+} BenchFormat;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const BenchFormat formats[] = {
+    { "DXT1", SW_COMPRESSED_RGB_S3TC_DXT1, SW_PIXELFORMAT_COMPRESSED_DXT1_RGB, 8 },
+    { "DXT1A", SW_COMPRESSED_RGBA_S3TC_DXT1, SW_PIXELFORMAT_COMPRESSED_DXT1_RGBA, 8 },
+    { "DXT3", SW_COMPRESSED_RGBA_S3TC_DXT3, SW_PIXELFORMAT_COMPRESSED_DXT3_RGBA, 16 },
+    { "DXT5", SW_COMPRESSED_RGBA_S3TC_DXT5, SW_PIXELFORMAT_COMPRESSED_DXT5_RGBA, 16 },
+    { "ETC2", SW_COMPRESSED_RGB8_ETC2, SW_PIXELFORMAT_COMPRESSED_ETC2_RGB, 8 },
+    { "ETC2 EAC", SW_COMPRESSED_RGBA8_ETC2_EAC, SW_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, 16 },
+};
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTime(void);                                            // Get current time (seconds)
+static void DecodeBlocks(unsigned char *pixels, const unsigned char *blocks, int width, int height, const BenchFormat *format); // Decode blocks to RGBA8
+static void DrawTexturedQuad(void);                                     // Draw rotated quad covering the framebuffer
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    const int formatCount = (int)(sizeof(formats)/sizeof(formats[0]));
+
+    if (!swInit(BENCH_WIDTH, BENCH_HEIGHT)) return 1;
+
+    // Random blocks, same for every build, decoded blocks are not required to be meaningful images
+    srand(7);
+    unsigned char *blocks = (unsigned char *)malloc((size_t)BENCH_DECODE_BLOCKS*16);
+    for (int i = 0; i < BENCH_DECODE_BLOCKS*16; i++) blocks[i] = (unsigned char)rand();
+
+    printf("rlsw compressed textures benchmark, blocks cache: %i entries\n\n", SW_BLOCK_CACHE_SIZE);
+
+    // Blocks decoding throughput
+    //--------------------------------------------------------------------------------------
+    printf("    %-10s %12s %14s\n", "decode", "Mblocks/s", "Mtexels/s");
+
+    for (int f = 0; f < formatCount; f++)
+    {
+        unsigned char texels[64] = { 0 };
+        double best = 1e9;
+
+        for (int run = 0; run < BENCH_DECODE_RUNS; run++)
+        {
+            double time = GetTime();
+            for (int i = 0; i < BENCH_DECODE_BLOCKS; i++) sw_block_decode(texels, blocks + (size_t)i*formats[f].blockSize, formats[f].pixelFormat);
+            time = GetTime() - time;
+            if (time < best) best = time;
+        }
+
+        printf("    %-10s %12.1f %14.1f\n", formats[f].name, BENCH_DECODE_BLOCKS/best/1e6, BENCH_DECODE_BLOCKS*16/best/1e6);
+    }
+
+    // Sampling, compressed texture against same texels uploaded as RGBA8
+    //--------------------------------------------------------------------------------------
+    const int size = BENCH_TEXTURE_SIZE;
+    const int dataSize = (size/4)*(size/4)*16;
+    unsigned char *data = (unsigned char *)malloc(dataSize);
+    unsigned char *pixels = (unsigned char *)malloc((size_t)size*size*4);
+    unsigned char *frame = (unsigned char *)malloc((size_t)BENCH_WIDTH*BENCH_HEIGHT*4);
+    unsigned char *frameRef = (unsigned char *)malloc((size_t)BENCH_WIDTH*BENCH_HEIGHT*4);
+    const char *filterNames[2] = { "nearest", "bilinear" };
+    const SWfilter filters[2] = { SW_NEAREST, SW_LINEAR };
+    int mismatches = 0;
+
+    for (int i = 0; i < dataSize; i++) data[i] = (unsigned char)rand();
+
+    unsigned int texture = 0;
+    swGenTextures(1, &texture);
+    swBindTexture(texture);
+    swEnable(SW_TEXTURE_2D);
+
+    printf("\n    %-10s %-10s %12s %12s\n", "sample", "filter", "RGBA8 ms", "format ms");
+
+    for (int f = 0; f < formatCount; f++)
+    {
+        DecodeBlocks(pixels, data, size, size, &formats[f]);
+
+        for (int k = 0; k < 2; k++)
+        {
+            double best[2] = { 1e9, 1e9 };
+
+            // Texture uploaded as RGBA8 first (reference), then compressed
+            for (int compressed = 0; compressed < 2; compressed++)
+            {
+                if (compressed) swCompressedTexImage2D(0, size, size, formats[f].internalFormat, (size/4)*(size/4)*formats[f].blockSize, data);
+                else swTexImage2D(size, size, SW_RGBA, SW_UNSIGNED_BYTE, pixels);
+
+                swTexParameteri(SW_TEXTURE_MIN_FILTER, filters[k]);
+                swTexParameteri(SW_TEXTURE_MAG_FILTER, filters[k]);
+
+                for (int run = 0; run < BENCH_RENDER_RUNS; run++)
+                {
+                    double time = GetTime();
+                    swClear(SW_COLOR_BUFFER_BIT);
+                    DrawTexturedQuad();
+                    swFinish();
+                    time = GetTime() - time;
+                    if (time < best[compressed]) best[compressed] = time;
+                }
+
+                swReadPixels(0, 0, BENCH_WIDTH, BENCH_HEIGHT, SW_RGBA, SW_UNSIGNED_BYTE, compressed? frame : frameRef);
+            }
+
+            bool match = (memcmp(frame, frameRef, (size_t)BENCH_WIDTH*BENCH_HEIGHT*4) == 0);
+            if (!match) mismatches++;
+
+            printf("    %-10s %-10s %12.2f %12.2f%s\n", formats[f].name, filterNames[k], best[0]*1e3, best[1]*1e3, match? "" : "   FRAME MISMATCH");
+        }
+    }
+
+    swDeleteTextures(1, &texture);
+
+    free(frameRef);
+    free(frame);
+    free(pixels);
+    free(data);
+    free(blocks);
+    swClose();
+
+    return (mismatches == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get current time (seconds)
+static double GetTime(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Decode blocks to RGBA8, width and height must be multiple of 4
+static void DecodeBlocks(unsigned char *pixels, const unsigned char *blocks, int width, int height, const BenchFormat *format)
+{
+    unsigned char texels[64] = { 0 };
+    const int blocksX = width/4;
+
+    for (int by = 0; by < height/4; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            sw_block_decode(texels, blocks + (size_t)(by*blocksX + bx)*format->blockSize, format->pixelFormat);
+
+            for (int y = 0; y < 4; y++) memcpy(pixels + ((size_t)(by*4 + y)*width + bx*4)*4, texels + y*16, 16);
+        }
+    }
+}
+
+// Draw rotated quad covering the framebuffer
+static void DrawTexturedQuad(void)
+{
+    swMatrixMode(SW_PROJECTION);
+    swLoadIdentity();
+    swOrtho(-1, 1, -1, 1, -1, 1);
+    swMatrixMode(SW_MODELVIEW);
+    swLoadIdentity();
+    swRotatef(23.0f, 0, 0, 1);
+
+    swColor4ub(255, 255, 255, 255);
+    swBegin(SW_QUADS);
+        swTexCoord2f(-0.3f, -0.2f); swVertex2f(-1.5f, -1.5f);
+        swTexCoord2f(-0.3f, 1.0f); swVertex2f(-1.5f, 1.5f);
+        swTexCoord2f(1.0f, 1.0f); swVertex2f(1.5f, 1.5f);
+        swTexCoord2f(1.0f, -0.2f); swVertex2f(1.5f, -1.5f);
+    swEnd();
+}
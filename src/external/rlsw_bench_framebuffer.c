@@ -0,0 +1,181 @@
+/**********************************************************************************************
+*
+*   rlsw_bench_framebuffer - rlsw framebuffer clear, readback and blit benchmark
+*
+*   DESCRIPTION:
+*       Standalone program measuring framebuffer clear (swClear()), readback (swReadPixels())
+*       and scaled blit (swBlitPixels()) on a 1920x1080 framebuffer, for every output format
+*       with a dedicated row kernel. Every operation output is hashed, SIMD and scalar builds
+*       must print the same hashes
+*
+*   BUILD:
+*       Build twice, with and without SIMD intrinsics, and compare both outputs:
+*
+*           gcc -O2 -march=native -DRLSW_USE_SIMD_INTRINSICS=1 rlsw_bench_framebuffer.c -o bench_simd -lm -lpthread
+*           gcc -O2 -march=native rlsw_bench_framebuffer.c -o bench_scalar -lm -lpthread
+*
+*       Other instruction sets can be measured on the same host with -msse2, -mssse3 or -mavx2
+*       instead of -march=native. Framebuffer format is selected as usual, defining
+*       SW_FRAMEBUFFER_COLOR_TYPE (i.e. -DSW_FRAMEBUFFER_COLOR_TYPE=R5G6B5)
+*
+*   LICENSE: zlib/libpng
+*
+**********************************************************************************************/
+
+#define RLSW_IMPLEMENTATION
+#include "rlsw.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free(), rand(), srand()
+#include <time.h>           // Required for: timespec_get()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_WIDTH         1920        // Framebuffer width
+#define BENCH_HEIGHT        1080        // Framebuffer height
+#define BENCH_RUNS            50        // Runs per operation, best run is reported
+
+#if defined(SW_SIMD_AVX2)
+    #define BENCH_SIMD_NAME     "AVX2"
+#elif defined(SW_SIMD_SSSE3)
+    #define BENCH_SIMD_NAME     "SSSE3"
+#elif defined(SW_SIMD_SSE2)
+    #define BENCH_SIMD_NAME     "SSE2"
+#elif defined(SW_SIMD_NEON)
+    #define BENCH_SIMD_NAME     "NEON"
+#else
+    #define BENCH_SIMD_NAME     "scalar"
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTime(void);                                            // Get current time (seconds)
+static unsigned long long GetDataHash(const void *data, size_t size);   // Get data hash (FNV-1a 64 bit)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    if (!swInit(BENCH_WIDTH, BENCH_HEIGHT)) return 1;
+
+    int width = 0;
+    int height = 0;
+    unsigned char *framebuffer = (unsigned char *)swGetColorBuffer(&width, &height);
+    unsigned char *pixels = (unsigned char *)malloc((size_t)2560*1440*4);
+
+    // Random framebuffer content, same for every build
+    srand(1);
+    for (int i = 0; i < width*height*SW_FRAMEBUFFER_COLOR_SIZE; i++) framebuffer[i] = (unsigned char)rand();
+
+    printf("rlsw framebuffer benchmark: %ix%i, %s, best of %i runs\n\n", width, height, BENCH_SIMD_NAME, BENCH_RUNS);
+    printf("    %-22s %10s   %s\n", "operation", "ms/call", "output hash");
+
+    // Readback and blit, measured first on framebuffer random content
+    //--------------------------------------------------------------------------------------
+    struct {
+        const char *name;
+        int w, h;           // Output size (blit) or 0 for readback
+        SWformat format;
+        SWtype type;
+        int pixelSize;
+    } tests[] = {
+        { "read RGBA", 0, 0, SW_RGBA, SW_UNSIGNED_BYTE, 4 },
+        { "read RGB", 0, 0, SW_RGB, SW_UNSIGNED_BYTE, 3 },
+        { "read R5G6B5", 0, 0, SW_RGB, SW_UNSIGNED_SHORT_5_6_5, 2 },
+        { "blit RGBA 2560x1440", 2560, 1440, SW_RGBA, SW_UNSIGNED_BYTE, 4 },
+        { "blit RGBA 1280x720", 1280, 720, SW_RGBA, SW_UNSIGNED_BYTE, 4 },
+        { "blit RGB 1280x720", 1280, 720, SW_RGB, SW_UNSIGNED_BYTE, 3 },
+    };
+
+    for (int i = 0; i < (int)(sizeof(tests)/sizeof(tests[0])); i++)
+    {
+        double best = 1e9;
+        size_t size = 0;
+
+        for (int run = 0; run < BENCH_RUNS; run++)
+        {
+            double time = GetTime();
+
+            if (tests[i].w == 0)
+            {
+                swReadPixels(0, 0, width, height, tests[i].format, tests[i].type, pixels);
+                size = (size_t)width*height*tests[i].pixelSize;
+            }
+            else
+            {
+                swBlitPixels(0, 0, tests[i].w, tests[i].h, 0, 0, width, height, tests[i].format, tests[i].type, pixels);
+                size = (size_t)tests[i].w*tests[i].h*tests[i].pixelSize;
+            }
+
+            time = GetTime() - time;
+            if (time < best) best = time;
+        }
+
+        printf("    %-22s %10.3f   %016llx\n", tests[i].name, best*1e3, GetDataHash(pixels, size));
+    }
+
+    // Clear, full framebuffer and scissored
+    //--------------------------------------------------------------------------------------
+    const char *clearNames[3] = { "clear color", "clear color+depth", "clear scissor" };
+
+    swClearColor(0.1f, 0.5f, 0.7f, 1.0f);
+
+    for (int i = 0; i < 3; i++)
+    {
+        double best = 1e9;
+
+        if (i == 2)
+        {
+            swEnable(SW_SCISSOR_TEST);
+            swScissor(100, 100, 1600, 800);
+            swClearColor(0.9f, 0.2f, 0.3f, 0.4f);
+        }
+
+        for (int run = 0; run < BENCH_RUNS; run++)
+        {
+            double time = GetTime();
+            swClear((i == 1)? (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT) : SW_COLOR_BUFFER_BIT);
+            time = GetTime() - time;
+            if (time < best) best = time;
+        }
+
+        printf("    %-22s %10.3f   %016llx\n", clearNames[i], best*1e3, GetDataHash(framebuffer, (size_t)width*height*SW_FRAMEBUFFER_COLOR_SIZE));
+    }
+
+    swDisable(SW_SCISSOR_TEST);
+
+    free(pixels);
+    swClose();
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get current time (seconds)
+static double GetTime(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Get data hash (FNV-1a 64 bit)
+static unsigned long long GetDataHash(const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long hash = 14695981039346656037ull;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
@@ -768,6 +768,11 @@ RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Del
 // WARNING: Copy and resize framebuffer functionality only defined for software backend
 RLAPI void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels); // Copy framebuffer pixel data to internal buffer
 RLAPI void rlResizeFramebuffer(int width, int height);                    // Resize internal framebuffer
+// WARNING: Frames output ring functionality only defined for software backend (headless rendering)
+RLAPI unsigned int rlGetFrameRingSize(int width, int height, int frameCount); // Get memory required by a frames output ring (bytes)
+RLAPI bool rlAttachFrameRing(void *memory, unsigned int size, int frameCount); // Attach memory as frames output ring (NULL: detach)
+RLAPI bool rlCreateSharedFrameRing(const char *name, int frameCount);    // Create frames output ring on POSIX shared memory
+RLAPI unsigned int rlPresentFrame(void);                                  // Publish framebuffer into next ring frame, returns frame sequence (0: failed)
 
 // Shaders management
 RLAPI unsigned int rlLoadShader(const char *code, int type);                    // Load (compile) shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
@@ -3262,7 +3267,14 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
-#if defined(GRAPHICS_API_OPENGL_11)
+    // NOTE: Software renderer supports DXT and ETC compressed textures, decoded on sampling
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    if (format > RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: Software renderer does not support PVRT and ASTC compressed texture formats");
+        return id;
+    }
+#elif defined(GRAPHICS_API_OPENGL_11)
     if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
         // TODO: Support texture data decompression
@@ -3331,7 +3343,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
         if (glInternalFormat != 0)
         {
             if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
-#if !defined(GRAPHICS_API_OPENGL_11)
+#if !defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_SOFTWARE)
             else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, dataPtr);
 #endif
 
@@ -3387,16 +3399,18 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);  // Alternative: GL_LINEAR
 
-#if defined(GRAPHICS_API_OPENGL_33)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_SOFTWARE)
     if (mipmapCount > 1)
     {
         // Activate trilinear filtering if mipmaps are available
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
 
+#if defined(GRAPHICS_API_OPENGL_33)
         // Define the maximum number of mipmap levels to be used, 0 is base texture size
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+#endif
 
         // Check if the loaded texture with mipmaps is complete,
         // uncomplete textures will draw in black if mipmap filtering is required
@@ -3672,6 +3686,14 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
         case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
         case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
         case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+    #elif defined(GRAPHICS_API_OPENGL_SOFTWARE)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: *glInternalFormat = GL_ETC1_RGB8_OES; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;
     #endif
         default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
     }
@@ -3711,6 +3733,19 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
+    glBindTexture(GL_TEXTURE_2D, 0);
+#elif defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    // NOTE: Software renderer generates mipmaps for POT and NPOT textures
+    glBindTexture(GL_TEXTURE_2D, id);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    if (glGetError() == GL_NO_ERROR)
+    {
+        *mipmaps = 1 + (int)floor(log((width > height)? width : height)/log(2));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
     glBindTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
@@ -3799,6 +3834,58 @@ void rlResizeFramebuffer(int width, int height)
 #endif
 }
 
+// Get memory required by a frames output ring for given framebuffer size
+// NOTE: Returns 0 if parameters are not valid or size does not fit in 32 bits
+unsigned int rlGetFrameRingSize(int width, int height, int frameCount)
+{
+    unsigned int size = 0;
+
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    size_t ringSize = swGetFrameRingSize(width, height, frameCount);
+    if (ringSize <= 0xffffffff) size = (unsigned int)ringSize;
+#endif
+
+    return size;
+}
+
+// Attach memory as frames output ring, frames are published by rlPresentFrame() in output layout
+// NOTE: Ring must be attached again after rlResizeFramebuffer(), NULL detaches current ring
+bool rlAttachFrameRing(void *memory, unsigned int size, int frameCount)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    result = swAttachFrameRing(memory, size, frameCount);
+#endif
+
+    return result;
+}
+
+// Create frames output ring on POSIX shared memory, consumer processes map it by name
+// NOTE: Requires rlsw compiled with RLSW_USE_SHARED_FRAME_RING
+bool rlCreateSharedFrameRing(const char *name, int frameCount)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    result = swCreateSharedFrameRing(name, frameCount);
+#endif
+
+    return result;
+}
+
+// Publish framebuffer into next frames output ring frame
+unsigned int rlPresentFrame(void)
+{
+    unsigned int sequence = 0;
+
+#if defined(GRAPHICS_API_OPENGL_SOFTWARE)
+    sequence = swPresentFrame();
+#endif
+
+    return sequence;
+}
+
 // Read screen pixel data (color buffer)
 unsigned char *rlReadScreenPixels(int width, int height)
 {
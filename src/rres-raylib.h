@@ -19,6 +19,10 @@
 *       Support data encryption algorithm XChaCha20-Poly1305,
 *       provided by monocypher.h/monocypher.c library
 *
+*   #define RRES_KEY_CACHE_SIZE
+*       Maximum number of encryption keys cached, keys are derived from (password, salt) pairs
+*       Default value: 16
+*
 *   DEPENDENCIES:
 *
 *     - raylib.h: Data types definition and data loading from memory functions
@@ -73,7 +77,22 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Resource data stream, reads ranges of resource data without loading the whole data
+// NOTE: Stream context keeps the reading state, memory used does not depend on resource size
+typedef struct ResourceStream {
+    unsigned int size;              // Resource data size (bytes), chunk properties not considered
+    void *context;                  // Resource stream context, internal data
+} ResourceStream;
+
+// Resources cache statistics
+typedef struct ResourceCacheStats {
+    unsigned int hits;              // Resources loads found in cache
+    unsigned int misses;            // Resources loads not found in cache (loaded from archive)
+    unsigned int evictions;         // Resources evicted from cache
+    unsigned int count;             // Resources cached
+    unsigned int size;              // Resources cached data size (bytes)
+    unsigned int budget;            // Resources cache budget (bytes)
+} ResourceCacheStats;
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -94,11 +113,68 @@ RLAPI char *LoadTextFromResource(rresResourceChunk chunk);      // Load text dat
 RLAPI Image LoadImageFromResource(rresResourceChunk chunk);     // Load Image data from rres resource chunk
 RLAPI Wave LoadWaveFromResource(rresResourceChunk chunk);       // Load Wave data from rres resource chunk
 RLAPI Font LoadFontFromResource(rresResourceMulti multi);       // Load Font data from rres resource multiple chunks
+RLAPI int LoadFontGlyphImagesFromResource(Font *font, rresResourceMulti multi, const int *codepoints, int codepointCount); // Load font glyph images for requested codepoints (all if NULL), returns images loaded
 RLAPI Mesh LoadMeshFromResource(rresResourceMulti multi);       // Load Mesh data from rres resource multiple chunks
 
+// Load texture from rres resource chunk, data is uploaded to GPU directly from chunk data
+// NOTE: Image chunks (RRES_DATA_IMAGE) are uploaded with no intermediate copy, including mipmaps chain
+// and GPU compressed pixel formats, raw image files are decoded and decoded data unloaded after upload
+RLAPI Texture2D LoadTextureFromResource(rresResourceChunk chunk); // Load Texture data from rres resource chunk
+
 // Unpack resource chunk data (decompres/decrypt data)
 // NOTE: Function return 0 on success or other value on failure
 RLAPI int UnpackResourceChunk(rresResourceChunk *chunk);        // Unpack resource chunk data (decompress/decrypt)
+RLAPI int UnpackResourceChunkToBuffer(rresResourceChunk *chunk, void *buffer, unsigned int bufferSize); // Unpack resource chunk data into provided buffer (single pass, no copies)
+RLAPI int LoadResourceChunkToBuffer(rresArchive archive, unsigned int rresId, rresResourceChunk *chunk, void *buffer, unsigned int bufferSize); // Load and unpack resource chunk from archive into provided buffer (LZ4 data decoded while read)
+RLAPI int UnpackResourceMulti(rresResourceMulti *multi);        // Unpack all resource chunks data, can be used as rres async loading processor
+
+// Pack resource chunk data (compress/encrypt data)
+// NOTE: Function matches rresPackProcessor, so chunks added to a rres packer are compressed/encrypted
+// on packer worker threads: rresSetPackProcessor(&packer, PackResourceChunk, 0)
+RLAPI int PackResourceChunk(rresResourceChunk *chunk);          // Pack resource chunk data (compress/encrypt), inverse of UnpackResourceChunk()
+
+// Read resource data ranges from archive without loading the whole resource
+// NOTE 1: Supported resources: uncompressed chunks (i.e. RRES_DATA_RAW), LZ4 compressed chunks (not encrypted)
+// and externally linked files (RRES_DATA_LINK), archive must be kept open while stream is used
+// NOTE 2: Data read is not verified (CRC32 considers whole chunk data), use rresVerifyArchive() if required
+// NOTE 3: LZ4 data is decoded sequentially, reading backwards (more than 64 KB) restarts decoding from data start
+RLAPI ResourceStream OpenResourceStream(rresArchive archive, unsigned int rresId); // Open resource data stream (first resource chunk)
+RLAPI unsigned int ReadResourceStream(ResourceStream stream, unsigned int offset, void *buffer, unsigned int size); // Read resource data range, returns bytes read
+RLAPI void CloseResourceStream(ResourceStream stream);          // Close resource data stream
+
+// Load resources through a cache, shared by (archive, resource id, resource type)
+// NOTE 1: Cached resources are reference counted, every load must be paired with its release function,
+// returned data is owned by the cache and it must not be unloaded
+// NOTE 2: Unreferenced resources are kept cached and evicted (least recently used first) once cached data
+// exceeds the cache budget, referenced resources are never evicted
+// NOTE 3: Cache is not thread-safe, use it from main thread (Font loading requires GPU),
+// resources are identified by archive id (not file handle), resources from a closed archive are never returned
+// for archives opened later and are evicted once unreferenced
+RLAPI Image LoadImageFromResourceCache(rresArchive archive, unsigned int rresId); // Load Image data from cache (loaded from archive if not cached)
+RLAPI Wave LoadWaveFromResourceCache(rresArchive archive, unsigned int rresId);   // Load Wave data from cache (loaded from archive if not cached)
+RLAPI Font LoadFontFromResourceCache(rresArchive archive, unsigned int rresId);   // Load Font data from cache (loaded from archive if not cached)
+RLAPI Mesh LoadMeshFromResourceCache(rresArchive archive, unsigned int rresId);   // Load Mesh data from cache (loaded from archive if not cached)
+RLAPI void ReleaseImageFromResourceCache(rresArchive archive, unsigned int rresId); // Release cached Image reference, Image is kept cached until evicted
+RLAPI void ReleaseWaveFromResourceCache(rresArchive archive, unsigned int rresId);  // Release cached Wave reference, Wave is kept cached until evicted
+RLAPI void ReleaseFontFromResourceCache(rresArchive archive, unsigned int rresId);  // Release cached Font reference, Font is kept cached until evicted
+RLAPI void ReleaseMeshFromResourceCache(rresArchive archive, unsigned int rresId);  // Release cached Mesh reference, Mesh is kept cached until evicted
+RLAPI void SetResourceCacheBudget(unsigned int budget);         // Set resources cache budget in bytes (default: 256 MB)
+RLAPI void ClearResourceCache(void);                            // Unload all unreferenced cached resources
+RLAPI ResourceCacheStats GetResourceCacheStats(void);           // Get resources cache statistics
+
+// Load multiple resources from archive in parallel
+// NOTE 1: Every resource is loaded, verified (CRC32), unpacked and converted on worker threads,
+// results are returned in ids order, resources that fail to load are returned zeroed
+// NOTE 2: Returned array must be freed with MemFree() after unloading its elements
+RLAPI Image *LoadImagesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count); // Load Image data for multiple resource ids
+RLAPI Wave *LoadWavesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count);   // Load Wave data for multiple resource ids
+RLAPI Mesh *LoadMeshesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count);  // Load Mesh data for multiple resource ids
+RLAPI void SetResourceBatchThreads(int threadCount);            // Set threads used on batch loading (default: 0, processors count)
+
+// Manage encryption keys cache
+// NOTE: Keys derived from password (Argon2i key stretching) are cached by (password, salt) to avoid
+// repeating key stretching on every encrypted chunk, cache is wiped when password changes
+RLAPI void ClearResourceKeyCache(void);                         // Wipe derived keys cache and free key stretching work area
 
 // Set base directory for externally linked data
 // NOTE: When resource chunk contains an external link (FourCC: LINK, Type: RRES_DATA_LINK),
@@ -124,6 +200,9 @@ RLAPI void SetBaseDirectory(const char *baseDir);               // Set base dire
 // NOTE: They should be the same supported by the rres packaging tool (rrespacker)
 // https://github.com/phoboslab/qoi
 #include "external/qoi.h"                   // Compression algorithm: QOI (implementation in raylib)
+#ifndef QOI_FREE
+    #define QOI_FREE(p)     RL_FREE(p)      // QOI data is allocated by raylib QOI implementation (RL_MALLOC)
+#endif
 
 #if defined(RRES_SUPPORT_COMPRESSION_LZ4)
     // https://github.com/lz4/lz4
@@ -141,20 +220,188 @@ RLAPI void SetBaseDirectory(const char *baseDir);               // Set base dire
     #include "external/monocypher.c"        // Encryption algorithm implementation: XChaCha20-Poly1305
 #endif
 
+// Vertex data conversion SIMD kernels, baseline instruction set on every supported target (SSE2, NEON)
+// NOTE: Kernels read little-endian data directly, big-endian targets use scalar conversion loops
+#if !defined(RRES_SUPPORT_VERTEX_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || \
+    (defined(__aarch64__) && !defined(__AARCH64EB__)) || defined(_M_ARM64))
+    #define RRES_SUPPORT_VERTEX_SIMD
+#endif
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+    #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        #define RRES_VERTEX_SSE2
+        #include <emmintrin.h>              // Required for: SSE2 intrinsics
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+        #define RRES_VERTEX_NEON
+        #include <arm_neon.h>               // Required for: NEON intrinsics
+    #else
+        #undef RRES_SUPPORT_VERTEX_SIMD
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#if defined(RRES_SUPPORT_ENCRYPTION_AES) || defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+    #define RRES_SUPPORT_KEY_CACHE
+#endif
+
+#ifndef RRES_KEY_CACHE_SIZE
+    #define RRES_KEY_CACHE_SIZE        16       // Maximum number of derived keys cached
+#endif
+
+#define RRES_KEY_STRETCH_BLOCKS     16384       // Key stretching work area blocks (1 KB each): 16 MB
+
+#ifndef RRES_CACHE_BUDGET
+    #define RRES_CACHE_BUDGET   (256*1024*1024)  // Resources cache default budget (bytes)
+#endif
+
+#define RRES_STREAM_WINDOW_SIZE     65536       // Resource stream decoded data window, LZ4 matches distance is up to 64 KB
+#define RRES_STREAM_INPUT_SIZE      16384       // Resource stream compressed data read buffer
+
+// Spin lock for shared state accessed by batch loading worker threads
+// NOTE: Only short critical sections are protected, expensive work (key stretching, hashing) runs unlocked,
+// waiting threads spin reading the lock (no atomic writes) with a CPU pause hint, yielding periodically
+#if defined(_MSC_VER)
+    #include <intrin.h>
+    #define RRES_SPIN_TRY_LOCK(lock)    (_InterlockedExchange(&(lock), 1) == 0)
+    #define RRES_SPIN_UNLOCK(lock)      _InterlockedExchange(&(lock), 0)
+#else
+    #define RRES_SPIN_TRY_LOCK(lock)    (__atomic_exchange_n(&(lock), 1, __ATOMIC_ACQUIRE) == 0)
+    #define RRES_SPIN_UNLOCK(lock)      __atomic_store_n(&(lock), 0, __ATOMIC_RELEASE)
+#endif
+#define RRES_SPIN_LOCK(lock)            while (!RRES_SPIN_TRY_LOCK(lock)) WaitResourceLock(&(lock))
+
+#if defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+    #define RRES_SPIN_PAUSE()           __yield()
+#elif defined(_MSC_VER)
+    #define RRES_SPIN_PAUSE()           _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+    #define RRES_SPIN_PAUSE()           __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+    #define RRES_SPIN_PAUSE()           __asm__ __volatile__("yield")
+#else
+    #define RRES_SPIN_PAUSE()
+#endif
+
+#if defined(_WIN32)
+    __declspec(dllimport) void __stdcall Sleep(unsigned long dwMilliseconds);  // Declared as in windows.h (DWORD), it can not be included with raylib.h
+    #define RRES_SPIN_YIELD()           Sleep(0)
+#else
+    #include <sched.h>                  // Required for: sched_yield()
+    #define RRES_SPIN_YIELD()           sched_yield()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(RRES_SUPPORT_KEY_CACHE)
+// Derived key cache entry
+// NOTE: Password is not stored, only its hash (BLAKE2b) is used to identify the entry
+typedef struct rresKeyCacheEntry {
+    unsigned char passHash[32];         // Password hash
+    unsigned char salt[16];             // Key stretching salt
+    unsigned char key[32];              // Derived encryption key
+    unsigned int lastUse;               // Last use counter, used for LRU replacement (0 for empty entry)
+} rresKeyCacheEntry;
+#endif
+
+// Resource stream source
+typedef enum {
+    RRES_STREAM_CHUNK = 0,              // Uncompressed chunk data, read from archive
+    RRES_STREAM_LINK,                   // External linked file data
+    RRES_STREAM_LZ4,                    // LZ4 compressed chunk data, decoded from archive
+} rresStreamSource;
+
+// Resource stream LZ4 decoder state
+typedef enum {
+    RRES_LZ4_TOKEN = 0,                 // Next element: sequence token
+    RRES_LZ4_LITERALS,                  // Next element: sequence literals
+    RRES_LZ4_OFFSET,                    // Next element: sequence match offset and length
+    RRES_LZ4_MATCH,                     // Next element: sequence match copy
+    RRES_LZ4_END,                       // Data end reached
+    RRES_LZ4_ERROR,                     // Corrupted data
+} rresStreamDecoderState;
+
+// Resource stream context
+// NOTE: LZ4 data decoded is kept in a window (ring buffer), required by matches and to serve ranges,
+// window can also be the whole decoded data buffer (windowMask: 0xffffffff), decoded in a single pass
+typedef struct rresStreamContext {
+    rresArchive archive;                // Archive to read chunk data from
+    rresStreamSource source;            // Stream data source
+    unsigned int dataOffset;            // Data global offset in archive (compressed data for LZ4)
+    unsigned int dataSkip;              // Data header bytes skipped: propCount + props[] (LZ4 decoded data)
+    FILE *file;                         // External linked file
+
+    // LZ4 decoder state
+    unsigned int packedSize;            // Compressed data size
+    unsigned int inputOffset;           // Compressed data read from archive
+    unsigned int inputPosition;         // Compressed data read buffer position
+    unsigned int inputSize;             // Compressed data read buffer size
+    unsigned int decodedSize;           // Data decoded
+    unsigned int literalCount;          // Sequence literals to copy
+    unsigned int matchCount;            // Sequence match bytes to copy
+    unsigned int matchOffset;           // Sequence match offset
+    unsigned char token;                // Sequence token
+    rresStreamDecoderState state;       // Decoder state
+    bool verify;                        // Compute compressed data CRC32 while read
+    unsigned int crc32;                 // Compressed data CRC32 (data read)
+    unsigned char *window;              // Decoded data window
+    unsigned int windowMask;            // Decoded data window size - 1 (power of two)
+    unsigned char input[RRES_STREAM_INPUT_SIZE];    // Compressed data read buffer
+} rresStreamContext;
+
+// Resources cache entry type
+typedef enum {
+    RRES_CACHE_IMAGE = 0,               // Cached Image
+    RRES_CACHE_WAVE,                    // Cached Wave
+    RRES_CACHE_FONT,                    // Cached Font
+    RRES_CACHE_MESH,                    // Cached Mesh
+} rresCacheType;
+
+// Resources cache entry
+// NOTE: Archive is identified by its id, file handles could be reused by archives opened later
+typedef struct rresCacheEntry {
+    unsigned int archive;               // Archive identifier (rresArchive.id)
+    unsigned int id;                    // Resource id
+    rresCacheType type;                 // Resource type loaded
+    unsigned int refCount;              // Resource references, entry can be evicted if 0
+    unsigned int lastUse;               // Last use counter, used for LRU eviction
+    unsigned int size;                  // Resource data size (bytes)
+    union {
+        Image image;
+        Wave wave;
+        Font font;
+        Mesh mesh;
+    } data;                             // Resource data
+} rresCacheEntry;
+
+// Batch loading jobs data
+typedef struct rresBatchLoad {
+    rresArchive archive;                // Archive to load resources from
+    const unsigned int *ids;            // Resource ids to load
+    void *results;                      // Loaded resources, in ids order
+} rresBatchLoad;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *baseDir = NULL;      // Base directory pointer, used on external linked data loading
+static int batchThreadCount = 0;        // Threads used on batch loading (0: processors count)
+static volatile long sharedLock = 0;    // Shared state lock: keys cache and pack salt
+
+static rresCacheEntry *cacheEntries = NULL;     // Resources cache entries
+static unsigned int cacheCapacity = 0;          // Resources cache entries capacity
+static unsigned int cacheCounter = 0;           // Resources cache use counter
+static ResourceCacheStats cacheStats = { 0, 0, 0, 0, 0, RRES_CACHE_BUDGET }; // Resources cache statistics
+
+#if defined(RRES_SUPPORT_KEY_CACHE)
+static rresKeyCacheEntry keyCache[RRES_KEY_CACHE_SIZE] = { 0 };    // Derived keys cache
+static unsigned int keyCacheCounter = 0;        // Key cache use counter
+static void *keyWorkArea = NULL;                // Key stretching work area, reused between key derivations
+static unsigned char packSalt[16] = { 0 };      // Key stretching salt for packed chunks (XChaCha20-Poly1305), shared while password does not change
+static bool packSaltReady = false;              // Key stretching salt for packed chunks generated
+static rresCipherPasswordCallback userPasswordCallback = NULL; // Password change callback set by user, chained
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -164,11 +411,54 @@ static const char *baseDir = NULL;      // Base directory pointer, used on exter
 // NOTE: Chunk data must be provided uncompressed/unencrypted
 static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size);      // Load chunk: RRES_DATA_LINK
 static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size);     // Load chunk: RRES_DATA_RAW
+static const void *GetDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size); // Get chunk: RRES_DATA_RAW (data is not copied)
 static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang); // Load chunk: RRES_DATA_TEXT
 static Image LoadImageFromResourceChunk(rresResourceChunk chunk);                        // Load chunk: RRES_DATA_IMAGE
+static Image GetImageFromResourceChunk(rresResourceChunk chunk);                         // Get chunk: RRES_DATA_IMAGE (data is not copied)
+static float *LoadVertexDataFromResourceChunk(rresResourceChunk chunk, unsigned int count, bool normalized); // Load chunk: RRES_DATA_VERTEX, converted to float
+static unsigned short *LoadVertexIndicesFromResourceChunk(rresResourceChunk chunk);      // Load chunk: RRES_DATA_VERTEX (indices), converted to unsigned short
+static unsigned int GetChunkDataSize(rresResourceChunk chunk);                           // Get chunk data size (bytes), properties not considered
+static void SetChunkUnpackedData(rresResourceChunk *chunk, unsigned char *unpackedData, unsigned int unpackedSize, bool borrowed); // Set chunk data from unpacked memory (propCount + props[] + data)
+static float GetFloatFromHalf(unsigned short value);                                     // Get float value from half-float (16 bit) value
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+static unsigned int ExpandVertexData(float *result, const unsigned char *data, unsigned int count, unsigned int format, bool normalized); // Convert vertex data blocks to float (SIMD), returns values converted
+static unsigned int PackVertexIndices(unsigned short *indices, const unsigned char *data, unsigned int count, unsigned int format, unsigned int *maxIndex); // Convert vertex indices blocks to unsigned short (SIMD), returns indices converted
+#endif
 
 static const char *GetExtensionFromProps(unsigned int ext01, unsigned int ext02);        // Get file extension from RRES_DATA_RAW properties (unsigned int)
 
+// Resources cache
+static rresCacheEntry *LoadResourceCacheEntry(rresArchive archive, unsigned int rresId, rresCacheType type); // Get cache entry, resource loaded if not cached
+static void ReleaseResourceCacheEntry(rresArchive archive, unsigned int rresId, rresCacheType type); // Release cache entry reference
+static void UnloadResourceCacheEntry(rresCacheEntry *entry);                              // Unload cache entry resource data
+static void EvictResourceCache(unsigned int size);                                        // Evict unreferenced resources to fit size in budget
+static unsigned int GetResourceDataSize(rresCacheEntry *entry);                           // Get cache entry resource data size (bytes)
+
+// Resource streams LZ4 decoding
+static void ResetResourceStream(rresStreamContext *ctx);                                  // Reset LZ4 decoder to data start
+static bool FillResourceStreamInput(rresStreamContext *ctx);                              // Refill compressed data read buffer if consumed
+static bool ReadResourceStreamInput(rresStreamContext *ctx, unsigned char *value);        // Read one compressed data byte
+static void DecodeResourceStreamSequences(rresStreamContext *ctx, unsigned int decodedSize); // Decode LZ4 sequences fully available in read buffer
+static void DecodeResourceStream(rresStreamContext *ctx, unsigned int decodedSize);       // Decode LZ4 data up to provided decoded size
+static unsigned int ReadResourceStreamDecoded(rresStreamContext *ctx, unsigned int offset, unsigned char *buffer, unsigned int size); // Read decoded data range
+
+// Batch loading jobs, run by rresRunJobs() on worker threads
+static void LoadImageJob(void *userData, unsigned int index);                            // Load, unpack and convert one Image
+static void LoadWaveJob(void *userData, unsigned int index);                             // Load, unpack and convert one Wave
+static void LoadMeshJob(void *userData, unsigned int index);                             // Load, unpack and convert one Mesh
+
+#if defined(RRES_SUPPORT_KEY_CACHE)
+static void DeriveResourceKey(const unsigned char *salt, unsigned char *key);             // Derive encryption key from password and salt (cached)
+static void ResourcePasswordChanged(const char *pass);                                  // Password change callback, wipes keys cache
+static bool GetRandomBytes(unsigned char *buffer, unsigned int size);                     // Get cryptographically secure random bytes from system
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+static void ComputeResourceMD5(const unsigned char *data, unsigned int size, unsigned int *hash); // Compute MD5 hash (reentrant, same result as raylib ComputeMD5())
+#endif
+#if defined(RRES_SUPPORT_KEY_CACHE)
+static void WaitResourceLock(volatile long *lock);                                       // Wait for spin lock to be released
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -236,12 +526,11 @@ Image LoadImageFromResource(rresResourceChunk chunk)
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)       // Raw image file
     {
+        // NOTE: Image is decoded directly from chunk data, no intermediate copy required
         unsigned int dataSize = 0;
-        unsigned char *data = (unsigned char *)LoadDataFromResourceChunk(chunk, &dataSize);
-
-        image = LoadImageFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
+        const unsigned char *data = (const unsigned char *)GetDataFromResourceChunk(chunk, &dataSize);
 
-        RL_FREE(data);
+        if (data != NULL) image = LoadImageFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_LINK)      // Link to external file
     {
@@ -258,6 +547,32 @@ Image LoadImageFromResource(rresResourceChunk chunk)
     return image;
 }
 
+// Load Texture data from rres resource
+// NOTE: Image chunk data is borrowed, texture is uploaded from chunk data (single transfer)
+Texture2D LoadTextureFromResource(rresResourceChunk chunk)
+{
+    Texture2D texture = { 0 };
+
+    if (rresGetDataType(chunk.info.type) == RRES_DATA_IMAGE)          // Image data
+    {
+        Image image = GetImageFromResourceChunk(chunk);
+
+        if (image.data != NULL) texture = LoadTextureFromImage(image);
+    }
+    else if ((rresGetDataType(chunk.info.type) == RRES_DATA_RAW) ||
+             (rresGetDataType(chunk.info.type) == RRES_DATA_LINK))    // Raw image file or link to external file
+    {
+        // NOTE: Image file must be decoded, decoded image is unloaded once uploaded
+        Image image = LoadImageFromResource(chunk);
+
+        if (image.data != NULL) texture = LoadTextureFromImage(image);
+
+        UnloadImage(image);
+    }
+
+    return texture;
+}
+
 // Load Wave data from rres resource
 Wave LoadWaveFromResource(rresResourceChunk chunk)
 {
@@ -280,12 +595,11 @@ Wave LoadWaveFromResource(rresResourceChunk chunk)
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_RAW)   // Raw wave file
     {
+        // NOTE: Wave is decoded directly from chunk data, no intermediate copy required
         unsigned int dataSize = 0;
-        unsigned char *data = (unsigned char *)LoadDataFromResourceChunk(chunk, &dataSize);
-
-        wave = LoadWaveFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
+        const unsigned char *data = (const unsigned char *)GetDataFromResourceChunk(chunk, &dataSize);
 
-        RL_FREE(data);
+        if (data != NULL) wave = LoadWaveFromMemory(GetExtensionFromProps(chunk.data.props[1], chunk.data.props[2]), data, dataSize);
     }
     else if (rresGetDataType(chunk.info.type) == RRES_DATA_LINK)  // Link to external file
     {
@@ -321,23 +635,36 @@ Font LoadFontFromResource(rresResourceMulti multi)
                 font.glyphCount = multi.chunks[0].data.props[1];         // Number of characters (glyphs)
                 font.glyphPadding = multi.chunks[0].data.props[2];      // Padding around the chars
 
-                font.recs = (Rectangle *)RL_CALLOC(font.glyphCount, sizeof(Rectangle));
-                font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+                // Font glyphs info comes as a data blob, decoded in one pass into recs and glyphs arrays
+                // NOTE: font.glyphs[i].image is not loaded, use LoadFontGlyphImagesFromResource() if required
+                const rresFontGlyphInfo *glyphInfo = (const rresFontGlyphInfo *)multi.chunks[0].data.raw;
+
+                if ((font.glyphCount > 0) && (GetChunkDataSize(multi.chunks[0]) >= font.glyphCount*sizeof(rresFontGlyphInfo)))
+                {
+                    font.recs = (Rectangle *)RL_MALLOC(font.glyphCount*sizeof(Rectangle));
+                    font.glyphs = (GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(GlyphInfo));
+                }
+
+                if ((font.recs != NULL) && (font.glyphs != NULL))
+                {
+                    for (int i = 0; i < font.glyphCount; i++)
+                    {
+                        font.recs[i] = CLITERAL(Rectangle){ (float)glyphInfo[i].x, (float)glyphInfo[i].y, (float)glyphInfo[i].width, (float)glyphInfo[i].height };
 
-                for (int i = 0; i < font.glyphCount; i++)
+                        font.glyphs[i].value = glyphInfo[i].value;
+                        font.glyphs[i].offsetX = glyphInfo[i].offsetX;
+                        font.glyphs[i].offsetY = glyphInfo[i].offsetY;
+                        font.glyphs[i].advanceX = glyphInfo[i].advanceX;
+                    }
+                }
+                else
                 {
-                    // Font glyphs info comes as a data blob
-                    font.recs[i].x = (float)((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].x;
-                    font.recs[i].y = (float)((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].y;
-                    font.recs[i].width = (float)((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].width;
-                    font.recs[i].height = (float)((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].height;
-
-                    font.glyphs[i].value = ((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].value;
-                    font.glyphs[i].offsetX = ((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].offsetX;
-                    font.glyphs[i].offsetY = ((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].offsetY;
-                    font.glyphs[i].advanceX = ((rresFontGlyphInfo *)multi.chunks[0].data.raw)[i].advanceX;
-
-                    // NOTE: font.glyphs[i].image is not loaded
+                    RRES_LOG("RRES: WARNING: FNTG: Chunk data size do not match expected glyphs count\n");
+                    RL_FREE(font.recs);
+                    RL_FREE(font.glyphs);
+                    font.recs = NULL;
+                    font.glyphs = NULL;
+                    font.glyphCount = 0;
                 }
             }
             else RRES_LOG("RRES: %s: WARNING: Data must be decompressed/decrypted\n", multi.chunks[0].info.type);
@@ -348,9 +675,9 @@ Font LoadFontFromResource(rresResourceMulti multi)
         {
             if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
             {
-                Image image = LoadImageFromResourceChunk(multi.chunks[1]);
-                font.texture = LoadTextureFromImage(image);
-                UnloadImage(image);
+                // NOTE: Font atlas is uploaded directly from chunk data
+                Image image = GetImageFromResourceChunk(multi.chunks[1]);
+                if (image.data != NULL) font.texture = LoadTextureFromImage(image);
             }
             else RRES_LOG("RRES: %s: WARNING: Data must be decompressed/decrypted\n", multi.chunks[1].info.type);
         }
@@ -359,12 +686,11 @@ Font LoadFontFromResource(rresResourceMulti multi)
     {
         if (rresGetDataType(multi.chunks[0].info.type) == RRES_DATA_RAW)      // Raw font file
         {
+            // NOTE: Font is decoded directly from chunk data, no intermediate copy required
             unsigned int dataSize = 0;
-            unsigned char *rawData = (unsigned char *)LoadDataFromResourceChunk(multi.chunks[0], &dataSize);
+            const unsigned char *rawData = (const unsigned char *)GetDataFromResourceChunk(multi.chunks[0], &dataSize);
 
-            font = LoadFontFromMemory(GetExtensionFromProps(multi.chunks[0].data.props[1], multi.chunks[0].data.props[2]), rawData, dataSize, 32, NULL, 0);
-
-            RL_FREE(rawData);
+            if (rawData != NULL) font = LoadFontFromMemory(GetExtensionFromProps(multi.chunks[0].data.props[1], multi.chunks[0].data.props[2]), rawData, dataSize, 32, NULL, 0);
         }
         if (rresGetDataType(multi.chunks[0].info.type) == RRES_DATA_LINK)     // Link to external font file
         {
@@ -385,9 +711,78 @@ Font LoadFontFromResource(rresResourceMulti multi)
     return font;
 }
 
+// Load font glyph images for requested codepoints, cropped from font atlas image chunk
+// NOTE 1: Glyph images are only required for CPU font rendering (i.e. ImageText()), loading them
+// lazily avoids one allocation per glyph on fonts with many glyphs (i.e. CJK fonts)
+// NOTE 2: If codepoints is NULL all glyph images are loaded, already loaded images are kept
+// NOTE 3: Glyph images are unloaded with font, UnloadFont()
+int LoadFontGlyphImagesFromResource(Font *font, rresResourceMulti multi, const int *codepoints, int codepointCount)
+{
+    int loaded = 0;
+    Image atlas = { 0 };
+
+    if ((font != NULL) && (font->glyphs != NULL) && (multi.count >= 2) && (rresGetDataType(multi.chunks[1].info.type) == RRES_DATA_IMAGE))
+    {
+        atlas = GetImageFromResourceChunk(multi.chunks[1]);
+
+        if ((atlas.data != NULL) && (atlas.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        {
+            RRES_LOG("RRES: WARNING: FNTG: Glyph images can not be loaded from compressed font atlas\n");
+            atlas.data = NULL;
+        }
+    }
+
+    if (atlas.data != NULL)
+    {
+        // Atlas image is borrowed from chunk data, only base mipmap level is considered
+        atlas.mipmaps = 1;
+
+        // Glyphs are usually sorted by codepoint, allowing binary search
+        bool sorted = true;
+        for (int i = 1; (i < font->glyphCount) && sorted; i++) sorted = (font->glyphs[i - 1].value < font->glyphs[i].value);
+
+        int count = (codepoints != NULL)? codepointCount : font->glyphCount;
+
+        for (int i = 0; i < count; i++)
+        {
+            int index = -1;
+
+            if (codepoints == NULL) index = i;
+            else if (sorted)
+            {
+                for (int low = 0, high = font->glyphCount - 1; low <= high; )
+                {
+                    int middle = low + (high - low)/2;
+
+                    if (font->glyphs[middle].value == codepoints[i]) { index = middle; break; }
+                    else if (font->glyphs[middle].value < codepoints[i]) low = middle + 1;
+                    else high = middle - 1;
+                }
+            }
+            else
+            {
+                for (int k = 0; k < font->glyphCount; k++)
+                {
+                    if (font->glyphs[k].value == codepoints[i]) { index = k; break; }
+                }
+            }
+
+            if ((index >= 0) && (font->glyphs[index].image.data == NULL))
+            {
+                font->glyphs[index].image = ImageFromImage(atlas, font->recs[index]);
+                if (font->glyphs[index].image.data != NULL) loaded++;
+            }
+        }
+    }
+
+    return loaded;
+}
+
 // Load Mesh data from rres resource
-// NOTE: We try to load vertex data following raylib structure constraints,
+// NOTE 1: We try to load vertex data following raylib structure constraints,
 // in case data does not fit raylib Mesh structure, it is not loaded
+// NOTE 2: Quantized (BYTE/SHORT) and half-float (HFLOAT) vertex formats are expanded to float,
+// integer texcoords/normals/tangents are considered normalized, integer positions are loaded as is
 Mesh LoadMeshFromResource(rresResourceMulti multi)
 {
     Mesh mesh = { 0 };
@@ -397,7 +792,7 @@ Mesh LoadMeshFromResource(rresResourceMulti multi)
     // Mesh resource consist of (n) chunks:
     for (unsigned int i = 0; i < multi.count; i++)
     {
-        if ((multi.chunks[0].info.compType == RRES_COMP_NONE) && (multi.chunks[0].info.cipherType == RRES_CIPHER_NONE))
+        if ((multi.chunks[i].info.compType == RRES_COMP_NONE) && (multi.chunks[i].info.cipherType == RRES_CIPHER_NONE))
         {
             // NOTE: raylib only supports vertex arrays with same vertex count,
             // rres.chunks[0] defined vertexCount will be the reference for the following chunks
@@ -410,40 +805,31 @@ Mesh LoadMeshFromResource(rresResourceMulti multi)
                 // In case vertex count do not match we skip that resource chunk
                 if ((multi.chunks[i].data.props[1] != RRES_VERTEX_ATTRIBUTE_INDEX) && (multi.chunks[i].data.props[0] != (unsigned int)mesh.vertexCount)) continue;
 
-                // NOTE: We are only loading raylib supported rresVertexFormat and raylib expected components count
+                // NOTE: We are only loading raylib expected components count, vertex data is converted to raylib expected format
                 switch (multi.chunks[i].data.props[1])    // Check rresVertexAttribute value
                 {
                     case RRES_VERTEX_ATTRIBUTE_POSITION:
                     {
                         // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.vertices = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.vertices, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
+                        if (multi.chunks[i].data.props[2] == 3) mesh.vertices = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*3, false);
+
+                        if (mesh.vertices == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute position not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_TEXCOORD1:
                     {
                         // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
+                        if (multi.chunks[i].data.props[2] == 2) mesh.texcoords = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*2, true);
+
+                        if (mesh.texcoords == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord1 not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_TEXCOORD2:
                     {
                         // raylib expects 2 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 2) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.texcoords2 = (float *)RL_CALLOC(mesh.vertexCount*2, sizeof(float));
-                            memcpy(mesh.texcoords2, multi.chunks[i].data.raw, mesh.vertexCount*2*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
+                        if (multi.chunks[i].data.props[2] == 2) mesh.texcoords2 = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*2, true);
+
+                        if (mesh.texcoords2 == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute texcoord2 not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_TEXCOORD3:
@@ -459,44 +845,56 @@ Mesh LoadMeshFromResource(rresResourceMulti multi)
                     case RRES_VERTEX_ATTRIBUTE_NORMAL:
                     {
                         // raylib expects 3 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 3) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.normals = (float *)RL_CALLOC(mesh.vertexCount*3, sizeof(float));
-                            memcpy(mesh.normals, multi.chunks[i].data.raw, mesh.vertexCount*3*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
+                        if (multi.chunks[i].data.props[2] == 3) mesh.normals = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*3, true);
+
+                        if (mesh.normals == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute normal not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_TANGENT:
                     {
                         // raylib expects 4 components per vertex and float vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_FLOAT))
-                        {
-                            mesh.tangents = (float *)RL_CALLOC(mesh.vertexCount*4, sizeof(float));
-                            memcpy(mesh.tangents, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(float));
-                        }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
+                        if (multi.chunks[i].data.props[2] == 4) mesh.tangents = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*4, true);
+
+                        if (mesh.tangents == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute tangent not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_COLOR:
                     {
                         // raylib expects 4 components per vertex and unsigned char vertex format
-                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UBYTE))
+                        if ((multi.chunks[i].data.props[2] == 4) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_UBYTE) &&
+                            (GetChunkDataSize(multi.chunks[i]) >= (unsigned int)mesh.vertexCount*4))
                         {
                             mesh.colors = (unsigned char *)RL_CALLOC(mesh.vertexCount*4, sizeof(unsigned char));
                             memcpy(mesh.colors, multi.chunks[i].data.raw, mesh.vertexCount*4*sizeof(unsigned char));
                         }
-                        else RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
+                        else if (multi.chunks[i].data.props[2] == 4)
+                        {
+                            // Other vertex formats are converted to normalized float and quantized to unsigned char
+                            float *colors = LoadVertexDataFromResourceChunk(multi.chunks[i], mesh.vertexCount*4, true);
+
+                            if (colors != NULL)
+                            {
+                                mesh.colors = (unsigned char *)RL_CALLOC(mesh.vertexCount*4, sizeof(unsigned char));
+                                for (int k = 0; k < mesh.vertexCount*4; k++)
+                                {
+                                    float value = (colors[k] < 0.0f)? 0.0f : ((colors[k] > 1.0f)? 1.0f : colors[k]);
+                                    mesh.colors[k] = (unsigned char)(value*255.0f + 0.5f);
+                                }
+
+                                RL_FREE(colors);
+                            }
+                        }
+
+                        if (mesh.colors == NULL) RRES_LOG("RRES: WARNING: MESH: Vertex attribute color not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
                     case RRES_VERTEX_ATTRIBUTE_INDEX:
                     {
                         // raylib expects 1 components per index and unsigned short vertex format
-                        if ((multi.chunks[i].data.props[2] == 1) && (multi.chunks[i].data.props[3] == RRES_VERTEX_FORMAT_USHORT))
-                        {
-                            mesh.indices = (unsigned short *)RL_CALLOC(multi.chunks[i].data.props[0], sizeof(unsigned short));
-                            memcpy(mesh.indices, multi.chunks[i].data.raw, multi.chunks[i].data.props[0]*sizeof(unsigned short));
-                        }
+                        // NOTE: 8 bit and 32 bit indices are converted, 32 bit indices must address less than 65536 vertex
+                        if (multi.chunks[i].data.props[2] == 1) mesh.indices = LoadVertexIndicesFromResourceChunk(multi.chunks[i]);
+
+                        if (mesh.indices != NULL) mesh.triangleCount = multi.chunks[i].data.props[0]/3;
                         else RRES_LOG("RRES: WARNING: MESH: Vertex attribute index not valid, componentCount/vertexFormat do not fit\n");
 
                     } break;
@@ -507,6 +905,9 @@ Mesh LoadMeshFromResource(rresResourceMulti multi)
         else RRES_LOG("RRES: WARNING: Vertex provided data must be decompressed/decrypted\n");
     }
 
+    // Non-indexed meshes define triangles by consecutive vertex
+    if ((mesh.indices == NULL) && (mesh.triangleCount == 0)) mesh.triangleCount = mesh.vertexCount/3;
+
     return mesh;
 }
 
@@ -514,10 +915,21 @@ Mesh LoadMeshFromResource(rresResourceMulti multi)
 // In case data could not be processed by rres.h, it is just copied in chunk.data.raw for processing here
 // NOTE 1: Function return 0 on success or an error code on failure
 // NOTE 2: Data corruption CRC32 check has already been performed by rresLoadResourceMulti() on rres.h
+// NOTE 3: Unpacked data (propCount + props[] + data) is decoded into one single allocation owned by the chunk
 int UnpackResourceChunk(rresResourceChunk *chunk)
+{
+    return UnpackResourceChunkToBuffer(chunk, NULL, 0);
+}
+
+// Unpack compressed/encrypted data from resource chunk into provided buffer
+// Data is decrypted and decompressed in a single pass into buffer, that contains (propCount + props[] + data),
+// chunk.data.props and chunk.data.raw point into buffer and they are not freed by rresUnloadResourceChunk()
+// NOTE 1: Buffer must be 4-byte aligned and at least chunk.info.baseSize bytes, it can be reused between chunks
+// NOTE 2: If buffer is NULL, memory is allocated for the unpacked data, owned by the chunk
+// NOTE 3: Packed data owned by the chunk is decrypted in-place and freed once unpacked
+int UnpackResourceChunkToBuffer(rresResourceChunk *chunk, void *buffer, unsigned int bufferSize)
 {
     int result = 0;
-    bool updateProps = false;
 
     // Result error codes:
     //  0 - No error, decompression/decryption successful
@@ -525,200 +937,251 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
     //  2 - Invalid password on decryption
     //  3 - Compression algorithm not supported
     //  4 - Error on data decompression
+    //  5 - Provided buffer is too small for unpacked data
 
     // NOTE 1: If data is compressed/encrypted the properties are not loaded by rres.h because
     // it's up to the user to process the data; *chunk must be properly updated by this function
     // NOTE 2: rres-raylib should support the same algorithms and libraries used by rrespacker tool
-    void *unpackedData = NULL;
+    if ((chunk->info.compType == RRES_COMP_NONE) && (chunk->info.cipherType == RRES_CIPHER_NONE)) return result;
+
+    unsigned char *packedData = (unsigned char *)chunk->data.raw;
+    unsigned int packedSize = chunk->info.packedSize;
+    bool packedOwned = ((chunk->info.reserved & RRES_CHUNK_RAW_BORROWED) == 0);
+
+    unsigned char *unpackedData = (unsigned char *)buffer;  // Unpacked data: propCount + props[] + data
+    unsigned int unpackedSize = chunk->info.baseSize;
+    unsigned char *pixels = NULL;                           // QOI decoded pixels, props are not part of QOI data
+    unsigned char *scratch = NULL;                          // Decryption output for borrowed compressed data
+
+    // Load statistics for unpacking stages, recorded by chunk data type and compression (if enabled)
+    bool statsEnabled = (rresIsLoadStatsEnabled() != 0);
+    rresLoadStats stats = { 0 };
+    stats.dataType = rresGetDataType(chunk->info.type);
+    stats.compType = chunk->info.compType;
+    double time = statsEnabled? rresGetLoadStatsTime() : 0.0;
+
+    if ((buffer != NULL) && (bufferSize < chunk->info.baseSize)) result = 5;
+    else if ((buffer == NULL) && ((chunk->info.compType == RRES_COMP_NONE) || (chunk->info.compType == RRES_COMP_LZ4)))
+    {
+        // Data is decrypted/decompressed directly into its final memory
+        unpackedData = (unsigned char *)RRES_MALLOC(chunk->info.baseSize);
+        if (unpackedData == NULL) result = 5;
+        else stats.bytesAllocated += chunk->info.baseSize;
+    }
 
     // STEP 1. Data decryption
+    // NOTE: Output is the final unpacked memory if data is not compressed,
+    // packed data itself if owned by the chunk (in-place) or scratch memory otherwise
     //-------------------------------------------------------------------------------------
-    unsigned char *decryptedData = NULL;
+    unsigned char *decryptedData = packedData;
+    unsigned int decryptedSize = packedSize;
 
-    switch (chunk->info.cipherType)
+    if ((result == 0) && (chunk->info.cipherType != RRES_CIPHER_NONE))
     {
-        case RRES_CIPHER_NONE: decryptedData = (unsigned char *)chunk->data.raw; break;
-#if defined(RRES_SUPPORT_ENCRYPTION_AES)
-        case RRES_CIPHER_AES:
-        {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
-
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 16, 1);
-            if (decryptedData != NULL) memcpy(decryptedData, chunk->data.raw, chunk->info.packedSize - 16 - 16);
-
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
-
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 16), 16);
-
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(), // User password
-                .salt = salt,                           // Salt for the password
-                .pass_size = (uint32_t)strlen(rresGetCipherPassword()), // Password length
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
-
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
-
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
+        unsigned char *target = packedData;
 
-            // Required variables for decryption and message authentication
-            unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
-
-            // Retrieve MD5 from chunk packed data
-            // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
-            memcpy(md5, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 4*sizeof(unsigned int));
-
-            // Message decryption, requires key
-            struct AES_ctx ctx = { 0 };
-            AES_init_ctx(&ctx, key);
-            AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)decryptedData, chunk->info.packedSize - 16 - 16);   // AES Counter mode, stream cipher
+        if (chunk->info.compType == RRES_COMP_NONE) target = unpackedData;
+        else if (!packedOwned)
+        {
+            target = scratch = (unsigned char *)RRES_MALLOC(packedSize);
+            stats.bytesAllocated += packedSize;
+        }
 
-            // Verify MD5 to check if data decryption worked
-            unsigned int decryptMD5[4] = { 0 };
-            unsigned int *md5Ptr = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16);
-            for (int i = 0; i < 4; i++) decryptMD5[i] = md5Ptr[i];
+        // Security check, packed data must contain the appended encryption data and decrypted data must fit
+        // on unpacked memory when decrypted there (not compressed data), corrupted chunks could overflow it
+        unsigned int appendedSize = 0;
+        if (chunk->info.cipherType == RRES_CIPHER_AES) appendedSize = 16 + 16;
+        else if (chunk->info.cipherType == RRES_CIPHER_XCHACHA20_POLY1305) appendedSize = 16 + 24 + 16;
 
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(key, 32);
+        if (packedSize < appendedSize)
+        {
+            result = 2;    // Message corrupted
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+        else if ((target == unpackedData) && ((packedSize - appendedSize) > chunk->info.baseSize))
+        {
+            result = 5;    // Decrypted data does not fit on unpacked memory
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Decrypted data size exceeds chunk base size\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
 
-            if (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0)    // Decrypted successfully!
-            {
-                chunk->info.packedSize -= (16 + 16);    // We remove additional data size from packed size (salt[16] + MD5[16])
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (AES)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-            else
+        if (result == 0) switch (chunk->info.cipherType)
+        {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+            case RRES_CIPHER_AES:
             {
-                result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
+                // WARNING: Implementation dependant!
+                // rrespacker tool appends (salt[16] + MD5[16]) to encrypted data for convenience,
+                // Actually, chunk->info.packedSize considers those additional elements
+                decryptedSize = packedSize - 16 - 16;
+
+                // Required variables for key stretching
+                uint8_t key[32] = { 0 };                    // Encryption key
+                uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+                // Retrieve salt from chunk packed data
+                // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
+                memcpy(salt, packedData + (packedSize - 16 - 16), 16);
+
+                // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+                // NOTE: Keys are cached by (password, salt), key stretching only runs on first use
+                double kdfTime = statsEnabled? rresGetLoadStatsTime() : 0.0;
+                DeriveResourceKey(salt, key);
+                if (statsEnabled) stats.kdfTime += (rresGetLoadStatsTime() - kdfTime);
+
+                // Wipe key generation secrets, they are no longer needed
+                crypto_wipe(salt, 16);
+
+                // Required variables for decryption and message authentication
+                unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
+
+                // Retrieve MD5 from chunk packed data
+                // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
+                memcpy(md5, packedData + (packedSize - 16), 4*sizeof(unsigned int));
+
+                // Message decryption, requires key
+                // NOTE: AES Counter mode is a stream cipher, it works in-place
+                if (target != packedData)
+                {
+                    memcpy(target, packedData, decryptedSize);
+                    stats.bytesCopied += decryptedSize;
+                }
 
-        } break;
-#endif
-#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
-        case RRES_CIPHER_XCHACHA20_POLY1305:
-        {
-            // WARNING: Implementation dependant!
-            // rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
-            // Actually, chunk->info.packedSize considers those additional elements
-
-            // Get some memory for the possible message output
-            decryptedData = (unsigned char *)RL_CALLOC(chunk->info.packedSize - 16 - 24 - 16, 1);
-
-            // Required variables for key stretching
-            uint8_t key[32] = { 0 };                    // Encryption key
-            uint8_t salt[16] = { 0 };                   // Key stretching salt
-
-            // Retrieve salt from chunk packed data
-            // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
-            memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24 - 16), 16);
-
-            // Key stretching configuration
-            crypto_argon2_config config = {
-                .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
-                .nb_blocks = 16384,                     // Blocks: 16 MB
-                .nb_passes = 3,                         // Iterations
-                .nb_lanes  = 1                          // Single-threaded
-            };
-            crypto_argon2_inputs inputs = {
-                .pass = (const uint8_t *)rresGetCipherPassword(), // User password
-                .salt = salt,  // Salt for the password
-                .pass_size = (uint32_t)strlen(rresGetCipherPassword()), // Password length
-                .salt_size = 16
-            };
-            crypto_argon2_extras extras = { 0 };        // Extra parameters unused
-
-            void *workArea = RL_MALLOC(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
-
-            // Wipe key generation secrets, they are no longer needed
-            crypto_wipe(salt, 16);
-            RL_FREE(workArea);
+                struct AES_ctx ctx = { 0 };
+                AES_init_ctx(&ctx, key);
+                AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)target, decryptedSize);
 
-            // Required variables for decryption and message authentication
-            uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
-            uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+                // Verify MD5 to check if data decryption worked
+                unsigned int decryptMD5[4] = { 0 };
+                ComputeResourceMD5((const unsigned char *)target, decryptedSize, decryptMD5);
 
-            // Retrieve nonce and MAC from chunk packed data
-            // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
-            memcpy(nonce, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24), 24);
-            memcpy(mac, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 16);
+                if (memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0)    // Decrypted successfully!
+                {
+                    RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (AES)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                }
+                else
+                {
+                    // Restore packed data if it was decrypted in-place (AES CTR is symmetric)
+                    if (target == packedData)
+                    {
+                        AES_init_ctx(&ctx, key);
+                        AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)target, decryptedSize);
+                    }
 
-            // Message decryption requires key, nonce and MAC
-            int decryptResult = crypto_aead_unlock(decryptedData, mac, key, nonce, NULL, 0, (unsigned char *)chunk->data.raw, (chunk->info.packedSize - 16 - 24 - 16));
+                    result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
+                    RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                }
 
-            // Wipe secrets if they are no longer needed
-            crypto_wipe(nonce, 24);
-            crypto_wipe(key, 32);
+                // Wipe secrets if they are no longer needed
+                crypto_wipe(key, 32);
+                crypto_wipe(&ctx, sizeof(struct AES_ctx));
 
-            if (decryptResult == 0)    // Decrypted successfully!
-            {
-                chunk->info.packedSize -= (16 + 24 + 16);    // We remove additional data size from packed size
-                RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (XChaCha20)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-            else if (decryptResult == -1)
+            } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+            case RRES_CIPHER_XCHACHA20_POLY1305:
             {
-                result = 2;   // Wrong password or message corrupted
-                RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
-            }
-        } break;
+                // WARNING: Implementation dependant!
+                // rrespacker tool appends (salt[16] + nonce[24] + MAC[16]) to encrypted data for convenience,
+                // Actually, chunk->info.packedSize considers those additional elements
+                decryptedSize = packedSize - 16 - 24 - 16;
+
+                // Required variables for key stretching
+                uint8_t key[32] = { 0 };                    // Encryption key
+                uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+                // Retrieve salt from chunk packed data
+                // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
+                memcpy(salt, packedData + (packedSize - 16 - 24 - 16), 16);
+
+                // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+                // NOTE: Keys are cached by (password, salt), key stretching only runs on first use
+                double kdfTime = statsEnabled? rresGetLoadStatsTime() : 0.0;
+                DeriveResourceKey(salt, key);
+                if (statsEnabled) stats.kdfTime += (rresGetLoadStatsTime() - kdfTime);
+
+                // Wipe key generation secrets, they are no longer needed
+                crypto_wipe(salt, 16);
+
+                // Required variables for decryption and message authentication
+                uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
+                uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+
+                // Retrieve nonce and MAC from chunk packed data
+                // nonce and MAC are stored at the end of packed data, after salt: salt[16] + nonce[24] + MAC[16]
+                memcpy(nonce, packedData + (packedSize - 16 - 24), 24);
+                memcpy(mac, packedData + (packedSize - 16), 16);
+
+                // Message decryption requires key, nonce and MAC
+                // NOTE: MAC is verified before decryption, packed data is not modified on failure
+                int decryptResult = crypto_aead_unlock(target, mac, key, nonce, NULL, 0, packedData, decryptedSize);
+
+                // Wipe secrets if they are no longer needed
+                crypto_wipe(nonce, 24);
+                crypto_wipe(key, 32);
+
+                if (decryptResult == 0)    // Decrypted successfully!
+                {
+                    RRES_LOG("RRES: %c%c%c%c: Data decrypted successfully (XChaCha20)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                }
+                else
+                {
+                    result = 2;   // Wrong password or message corrupted
+                    RRES_LOG("RRES: WARNING: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                }
+            } break;
 #endif
-        default:
-        {
-            result = 1;    // Decryption algorithm not supported
-            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            default:
+            {
+                result = 1;    // Decryption algorithm not supported
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
 
-        } break;
-    }
+            } break;
+        }
 
-    if ((result == 0) && (chunk->info.cipherType != RRES_CIPHER_NONE))
-    {
-        // Data is not encrypted any more, register it
-        chunk->info.cipherType = RRES_CIPHER_NONE;
-        updateProps = true;
+        decryptedData = target;
+
+        // Data decrypted in-place is not encrypted any more, register it
+        // NOTE: Chunk stays consistent (compressed only) if following decompression fails
+        if ((result == 0) && (target == packedData))
+        {
+            chunk->info.cipherType = RRES_CIPHER_NONE;
+            chunk->info.packedSize = decryptedSize;
+        }
+
+        if (statsEnabled) stats.decryptTime = rresGetLoadStatsTime() - time - stats.kdfTime;
     }
 
     // STEP 2: Data decompression (if decryption was successful)
     //-------------------------------------------------------------------------------------
-    unsigned char *uncompData = NULL;
-
     if (result == 0)
     {
+        if (statsEnabled) time = rresGetLoadStatsTime();
+
         switch (chunk->info.compType)
         {
-            case RRES_COMP_NONE: unpackedData = decryptedData; break;
+            case RRES_COMP_NONE: break;     // Data already decrypted into unpacked memory
             case RRES_COMP_DEFLATE:
             {
                 int uncompDataSize = 0;
 
                 // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
-                uncompData = DecompressData(decryptedData, chunk->info.packedSize, &uncompDataSize);
+                unsigned char *uncompData = DecompressData(decryptedData, decryptedSize, &uncompDataSize);
 
                 if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
                 {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
+                    // NOTE: raylib DEFLATE decompressor allocates its own output,
+                    // it's adopted as unpacked memory unless a buffer was provided
+                    if (buffer == NULL) unpackedData = uncompData;
+                    else if ((unsigned int)uncompDataSize <= bufferSize)
+                    {
+                        memcpy(unpackedData, uncompData, uncompDataSize);
+                        stats.bytesCopied += uncompDataSize;
+                    }
+                    else result = 5;
+
+                    stats.bytesAllocated += uncompDataSize;
+
+                    if (buffer != NULL) RL_FREE(uncompData);
                     RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (DEFLATE)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
                 }
                 else
@@ -733,14 +1196,11 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
 #if defined(RRES_SUPPORT_COMPRESSION_LZ4)
             case RRES_COMP_LZ4:
             {
-                int uncompDataSize = 0;
-                uncompData = (unsigned char *)RRES_CALLOC(chunk->info.baseSize, 1);
-                uncompDataSize = LZ4_decompress_safe((char *)decryptedData, (char *)uncompData, chunk->info.packedSize, chunk->info.baseSize);
+                // Data is decompressed directly into unpacked memory
+                int uncompDataSize = LZ4_decompress_safe((char *)decryptedData, (char *)unpackedData, decryptedSize, chunk->info.baseSize);
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
+                if ((unpackedData != NULL) && (uncompDataSize > 0))     // Decompression successful
                 {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
                     RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (LZ4)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
                 }
                 else
@@ -750,22 +1210,45 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
                 }
 
                 // WARNING: Decompression could be successful but not the original message size returned
-                if (uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
+                if ((unsigned int)uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
             } break;
 #endif
             case RRES_COMP_QOI:
             {
-                int uncompDataSize = 0;
                 qoi_desc desc = { 0 };
 
                 // TODO: WARNING: Possible issue with allocators: QOI_MALLOC() vs RRES_MALLOC()
-                uncompData = (unsigned char *)qoi_decode(decryptedData, chunk->info.packedSize, &desc, 0);
-                uncompDataSize = (desc.width*desc.height*desc.channels) + 20;   // Add the 20 bytes of (propCount + props[4])
+                pixels = (unsigned char *)qoi_decode(decryptedData, decryptedSize, &desc, 0);
+                unpackedSize = (desc.width*desc.height*desc.channels) + 20;   // Add the 20 bytes of (propCount + props[4])
 
-                if ((uncompData != NULL) && (uncompDataSize > 0))     // Decompression successful
+                if (pixels != NULL)     // Decompression successful
                 {
-                    unpackedData = uncompData;
-                    chunk->info.packedSize = uncompDataSize;
+                    stats.bytesAllocated += (unpackedSize - 20);
+
+                    // NOTE: QOI data only contains pixels, image properties are retrieved from QOI description,
+                    // decoded pixels are adopted as chunk raw data unless a buffer was provided
+                    unsigned int props[5] = { 4, desc.width, desc.height, (desc.channels == 4)? RRES_PIXELFORMAT_UNCOMP_R8G8B8A8 : RRES_PIXELFORMAT_UNCOMP_R8G8B8, 1 };
+
+                    if (buffer != NULL)
+                    {
+                        if (unpackedSize <= bufferSize)
+                        {
+                            memcpy(unpackedData, props, 20);
+                            memcpy(unpackedData + 20, pixels, unpackedSize - 20);
+                            stats.bytesCopied += unpackedSize;
+                        }
+                        else result = 5;
+
+                        QOI_FREE(pixels);
+                        pixels = NULL;
+                    }
+                    else
+                    {
+                        chunk->data.propCount = 4;
+                        chunk->data.props = (unsigned int *)RRES_CALLOC(4, sizeof(unsigned int));
+                        memcpy(chunk->data.props, props + 1, 4*sizeof(unsigned int));
+                    }
+
                     RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (QOI)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
                 }
                 else
@@ -774,7 +1257,7 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
                     RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
                 }
 
-                if ((unsigned int)uncompDataSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
+                if (unpackedSize != chunk->info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
             } break;
             default:
             {
@@ -782,174 +1265,2125 @@ int UnpackResourceChunk(rresResourceChunk *chunk)
                 RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
             } break;
         }
-    }
 
-    if ((result == 0) && (chunk->info.compType != RRES_COMP_NONE))
-    {
-        // Data is not encrypted any more, register it
-        chunk->info.compType = RRES_COMP_NONE;
-        updateProps = true;
+        if (statsEnabled) stats.decompressTime = rresGetLoadStatsTime() - time;
     }
 
-    // Update chunk->data.propCount and chunk->data.props if required
-    if (updateProps && (unpackedData != NULL))
+    RRES_FREE(scratch);
+
+    // STEP 3: Update chunk data (if decompression/decryption was successful)
+    // NOTE: Properties and data are referenced from unpacked memory, no additional copy required
+    //-------------------------------------------------------------------------------------
+    if (result == 0)
     {
-        // Data is decompressed/decrypted into chunk->data.raw but data.propCount and data.props[] are still empty,
-        // they must be filled with the just updated chunk->data.raw (that contains everything)
-        chunk->data.propCount = ((int *)unpackedData)[0];
+        if (packedOwned) RRES_FREE(packedData);
 
-        if (chunk->data.propCount > 0)
+        if (pixels != NULL)
         {
-            chunk->data.props = (unsigned int *)RRES_CALLOC(chunk->data.propCount, sizeof(int));
-            for (unsigned int i = 0; i < chunk->data.propCount; i++) chunk->data.props[i] = ((int *)unpackedData)[1 + i];
+            chunk->data.raw = pixels;       // QOI decoded pixels, props already assigned
+            chunk->info.reserved &= ~(RRES_CHUNK_RAW_BORROWED | RRES_CHUNK_PROPS_BORROWED | RRES_CHUNK_DATA_BLOCK);
+            chunk->info.cipherType = RRES_CIPHER_NONE;
+            chunk->info.compType = RRES_COMP_NONE;
+            chunk->info.packedSize = unpackedSize;
         }
-
-        // Move chunk->data.raw pointer (chunk->data.propCount*sizeof(int)) positions
-        void *raw = RRES_CALLOC(chunk->info.baseSize - 20, 1);
-        if (raw != NULL) memcpy(raw, ((unsigned char *)unpackedData) + 20, chunk->info.baseSize - 20);
-        RRES_FREE(chunk->data.raw);
-        chunk->data.raw = raw;
-        RL_FREE(unpackedData);
+        else SetChunkUnpackedData(chunk, unpackedData, unpackedSize, (buffer != NULL));
+    }
+    else if (buffer == NULL)
+    {
+        if (unpackedData != NULL) RRES_FREE(unpackedData);
+        if (pixels != NULL) QOI_FREE(pixels);
     }
 
+    rresAddLoadStats(stats);
+
     return result;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-
-// Load data chunk: RRES_DATA_LINK
-static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+// Load resource chunk from archive and unpack its data into provided buffer
+// LZ4 compressed data (not encrypted) is decoded while read from archive by blocks, packed data is never
+// loaded as a whole; other chunks are loaded by rresLoadResourceChunkFromArchive() and unpacked
+// NOTE 1: Buffer follows UnpackResourceChunkToBuffer() rules, if NULL memory is allocated for the unpacked data
+// NOTE 2: Returns UnpackResourceChunkToBuffer() error codes or 6 if chunk could not be loaded,
+// chunk must be unloaded with rresUnloadResourceChunk() in any case
+int LoadResourceChunkToBuffer(rresArchive archive, unsigned int rresId, rresResourceChunk *chunk, void *buffer, unsigned int bufferSize)
 {
-    char fullFilePath[2048] = { 0 };
-    void *data = NULL;
-    *size = 0;
-
-    // Get external link filepath
-    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
-    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+    int result = 0;
 
-    // Get base directory to append filepath if not provided by user
-    if (baseDir == NULL) baseDir = GetApplicationDirectory();
+    // Result error codes: UnpackResourceChunkToBuffer() codes plus
+    //  6 - Chunk could not be loaded: not found, read failed or data corrupted (CRC32)
 
-    strcpy(fullFilePath, baseDir);
-    strcat(fullFilePath, linkFilePath);
+    unsigned int offset = rresGetResourceOffset(archive, rresId);
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    rresResourceChunkInfo info = rresLoadResourceChunkInfoFromArchive(archive, rresId);
+#endif
 
-    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+    memset(chunk, 0, sizeof(rresResourceChunk));
 
-    if (FileExists(fullFilePath))
+    if (offset == 0)
     {
-        // Load external file as raw data
-        // NOTE: We check if file is a text file to allow automatic line-endings processing
-        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
+        result = 6;
+        RRES_LOG("RRES: WARNING: Resource could not be found: 0x%08x\n", rresId);
+    }
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    else if ((archive.mapping == NULL) && (info.compType == RRES_COMP_LZ4) && (info.cipherType == RRES_CIPHER_NONE))
+    {
+        // NOTE: Mapped archives are not streamed, packed data is already referenced with no copy
+        unsigned char *unpackedData = (unsigned char *)buffer;  // Unpacked data: propCount + props[] + data
+
+        bool statsEnabled = (rresIsLoadStatsEnabled() != 0);
+        rresLoadStats stats = { 0 };
+        stats.dataType = rresGetDataType(info.type);
+        stats.compType = info.compType;
+        stats.chunkCount = 1;
+
+        if ((buffer != NULL) && (bufferSize < info.baseSize)) result = 5;
+        else if (buffer == NULL)
         {
-            data = LoadFileText(fullFilePath);
-            *size = TextLength((char *)data);
+            unpackedData = (unsigned char *)RRES_MALLOC(info.baseSize);
+            if (unpackedData == NULL) result = 5;
+            else stats.bytesAllocated += info.baseSize;
         }
-        else data = LoadFileData(fullFilePath, (int *)size);
 
-        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
-    }
-    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
+        if (result == 0)
+        {
+            // Compressed data is read in blocks into stream input buffer and decoded into unpacked memory,
+            // used as decoder window (not wrapped), CRC32 is computed on the blocks read
+            rresStreamContext ctx = { 0 };
+            ctx.archive = archive;
+            ctx.source = RRES_STREAM_LZ4;
+            ctx.dataOffset = offset + sizeof(rresResourceChunkInfo);
+            ctx.packedSize = info.packedSize;
+            ctx.verify = (archive.verifyMode != RRES_VERIFY_NEVER);
+            ctx.window = unpackedData;
+            ctx.windowMask = 0xffffffff;
+            ResetResourceStream(&ctx);
+
+            double time = statsEnabled? rresGetLoadStatsTime() : 0.0;
+            DecodeResourceStream(&ctx, info.baseSize);
+            if (statsEnabled) stats.decompressTime = rresGetLoadStatsTime() - time;
+
+            // Security check, all compressed data must be consumed by decoder
+            if ((ctx.state == RRES_LZ4_ERROR) || (ctx.decodedSize == 0) || (ctx.inputOffset != ctx.packedSize) || (ctx.inputPosition != ctx.inputSize))
+            {
+                result = 4;    // Decompression process failed
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data decompression failed\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+            }
+            else if (ctx.verify && (ctx.crc32 != info.crc32))
+            {
+                result = 6;
+                RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+            }
+            else
+            {
+                RRES_LOG("RRES: %c%c%c%c: Data decompressed successfully (LZ4, streamed)\n", info.type[0], info.type[1], info.type[2], info.type[3]);
 
-    return data;
-}
+                // WARNING: Decompression could be successful but not the original message size returned
+                if (ctx.decodedSize != info.baseSize) RRES_LOG("RRES: WARNING: Decompressed data could be corrupted, unexpected size\n");
+            }
+        }
 
-// Load data chunk: RRES_DATA_RAW
-// NOTE: This chunk can be used raw files embedding or other binary blobs
-static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
-{
-    void *rawData = NULL;
+        if (result == 0)
+        {
+            chunk->info = info;
+            chunk->info.reserved = 0;
+            SetChunkUnpackedData(chunk, unpackedData, info.baseSize, (buffer != NULL));
+        }
+        else if ((buffer == NULL) && (unpackedData != NULL)) RRES_FREE(unpackedData);
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
-    {
-        rawData = RL_CALLOC(chunk.data.props[0], 1);
-        if (rawData != NULL) memcpy(rawData, chunk.data.raw, chunk.data.props[0]);
-        *size = chunk.data.props[0];
+        rresAddLoadStats(stats);
+    }
+#endif
+    else
+    {
+        *chunk = rresLoadResourceChunkFromArchive(archive, rresId);
+
+        if ((chunk->data.raw == NULL) && (chunk->info.packedSize > 0)) result = 6;
+        else result = UnpackResourceChunkToBuffer(chunk, buffer, bufferSize);
+    }
+
+    return result;
+}
+
+// Unpack all resource chunks data (decompress/decrypt)
+// NOTE: Function matches rresLoadProcessor, so resources requested with rresRequestLoad()
+// can be unpacked on the loading thread: rresSetLoadProcessor(UnpackResourceMulti)
+int UnpackResourceMulti(rresResourceMulti *multi)
+{
+    int result = 0;
+
+    for (unsigned int i = 0; (i < multi->count) && (result == 0); i++) result = UnpackResourceChunk(&multi->chunks[i]);
+
+    return result;
+}
+
+// Pack resource chunk data (compress/encrypt)
+// Chunk data is compressed and then encrypted, output layout matches the one expected by UnpackResourceChunk()
+// NOTE 1: Function return 0 on success or an error code on failure, chunk is not modified on failure
+// NOTE 2: Chunk data must be provided as one block (propCount + props[] + raw), as added to rres packer
+// NOTE 3: QOI compression is only applied to RGB/RGBA images without mipmaps, other chunks are left uncompressed
+int PackResourceChunk(rresResourceChunk *chunk)
+{
+    int result = 0;
+
+    // Result error codes:
+    //  0 - No error, compression/encryption successful
+    //  1 - Encryption algorithm not supported
+    //  2 - Encryption failed, password not provided or random data not available
+    //  3 - Compression algorithm not supported
+    //  4 - Error on data compression
+    //  5 - Chunk data not provided as one block
+
+    if ((chunk->info.compType == RRES_COMP_NONE) && (chunk->info.cipherType == RRES_CIPHER_NONE)) return result;
+    if ((chunk->info.reserved & RRES_CHUNK_DATA_BLOCK) == 0) return 5;
+
+    unsigned char *blockData = (unsigned char *)chunk->data.raw - sizeof(int) - chunk->data.propCount*sizeof(int);
+    unsigned int blockSize = chunk->info.baseSize;
+    unsigned char compType = chunk->info.compType;
+
+    // WARNING: Implementation dependant!
+    // Encryption appends (salt[16] + MD5[16]) for AES and (salt[16] + nonce[24] + MAC[16]) for XChaCha20-Poly1305,
+    // packed data memory considers those additional elements
+    unsigned int trailerSize = 0;
+
+    switch (chunk->info.cipherType)
+    {
+        case RRES_CIPHER_NONE: break;
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+        case RRES_CIPHER_AES: trailerSize = 16 + 16; break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+        case RRES_CIPHER_XCHACHA20_POLY1305: trailerSize = 16 + 24 + 16; break;
+#endif
+        default:
+        {
+            result = 1;    // Encryption algorithm not supported
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        } break;
+    }
+
+    // QOI data only contains pixels, image properties are retrieved from QOI description on unpacking
+    if ((result == 0) && (compType == RRES_COMP_QOI) && ((rresGetDataType(chunk->info.type) != RRES_DATA_IMAGE) || (chunk->data.propCount < 4) ||
+        ((chunk->data.props[2] != RRES_PIXELFORMAT_UNCOMP_R8G8B8) && (chunk->data.props[2] != RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)) || (chunk->data.props[3] > 1)))
+    {
+        compType = RRES_COMP_NONE;
+        RRES_LOG("RRES: WARNING: %c%c%c%c: QOI compression requires RGB/RGBA image data, chunk not compressed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+    }
+
+    // STEP 1: Data compression
+    // NOTE: Packed memory is allocated with space for encryption additional elements
+    //-------------------------------------------------------------------------------------
+    unsigned char *packedData = NULL;
+    unsigned int packedSize = blockSize;
+
+    if (result == 0)
+    {
+        switch (compType)
+        {
+            case RRES_COMP_NONE:
+            {
+                if (trailerSize > 0)
+                {
+                    packedData = (unsigned char *)RRES_MALLOC(blockSize + trailerSize);
+                    if (packedData != NULL) memcpy(packedData, blockData, blockSize);
+                    else result = 4;
+                }
+            } break;
+            case RRES_COMP_DEFLATE:
+            {
+                int compDataSize = 0;
+
+                // TODO: WARNING: Possible issue with allocators: RL_CALLOC() vs RRES_CALLOC()
+                unsigned char *compData = CompressData(blockData, blockSize, &compDataSize);
+
+                if ((compData != NULL) && (compDataSize > 0)) packedData = (unsigned char *)RRES_MALLOC(compDataSize + trailerSize);
+
+                if (packedData != NULL)
+                {
+                    memcpy(packedData, compData, compDataSize);
+                    packedSize = compDataSize;
+                }
+                else result = 4;
+
+                RL_FREE(compData);
+            } break;
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+            case RRES_COMP_LZ4:
+            {
+                int compDataBound = LZ4_compressBound(blockSize);
+                packedData = (unsigned char *)RRES_MALLOC(compDataBound + trailerSize);
+
+                int compDataSize = (packedData != NULL)? LZ4_compress_default((const char *)blockData, (char *)packedData, blockSize, compDataBound) : 0;
+
+                if (compDataSize > 0) packedSize = compDataSize;
+                else result = 4;
+            } break;
+#endif
+            case RRES_COMP_QOI:
+            {
+                qoi_desc desc = { 0 };
+                desc.width = chunk->data.props[0];
+                desc.height = chunk->data.props[1];
+                desc.channels = (chunk->data.props[2] == RRES_PIXELFORMAT_UNCOMP_R8G8B8A8)? 4 : 3;
+                desc.colorspace = QOI_SRGB;
+
+                int compDataSize = 0;
+
+                // TODO: WARNING: Possible issue with allocators: QOI_MALLOC() vs RRES_MALLOC()
+                unsigned char *compData = (unsigned char *)qoi_encode(chunk->data.raw, &desc, &compDataSize);
+
+                if ((compData != NULL) && (compDataSize > 0)) packedData = (unsigned char *)RRES_MALLOC(compDataSize + trailerSize);
+
+                if (packedData != NULL)
+                {
+                    memcpy(packedData, compData, compDataSize);
+                    packedSize = compDataSize;
+                }
+                else result = 4;
+
+                if (compData != NULL) QOI_FREE(compData);
+            } break;
+            default:
+            {
+                result = 3;
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            } break;
+        }
+
+        if (result == 4) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data compression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+    }
+
+    // STEP 2: Data encryption (if compression was successful)
+    // NOTE: Data is encrypted in-place, additional elements are appended after encrypted data
+    //-------------------------------------------------------------------------------------
+    if ((result == 0) && (chunk->info.cipherType != RRES_CIPHER_NONE))
+    {
+        if (rresGetCipherPassword() == NULL)
+        {
+            result = 2;
+            RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption requires a password\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+
+        switch ((result == 0)? chunk->info.cipherType : RRES_CIPHER_NONE)
+        {
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+            case RRES_CIPHER_AES:
+            {
+                // Required variables for key stretching
+                uint8_t key[32] = { 0 };                    // Encryption key
+                uint8_t salt[16] = { 0 };                   // Key stretching salt
+
+                // NOTE: AES CTR is used with a zero nonce, so every chunk requires its own key (random salt),
+                // reusing a key would reuse the key stream
+                if (GetRandomBytes(salt, 16))
+                {
+                    DeriveResourceKey(salt, key);
+
+                    // Compute MD5 of data to verify decryption
+                    unsigned int md5[4] = { 0 };
+                    ComputeResourceMD5((const unsigned char *)packedData, packedSize, md5);
+
+                    struct AES_ctx ctx = { 0 };
+                    AES_init_ctx(&ctx, key);
+                    AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)packedData, packedSize);
+
+                    // Append salt and MD5 to encrypted data: salt[16] + MD5[16]
+                    memcpy(packedData + packedSize, salt, 16);
+                    memcpy(packedData + packedSize + 16, md5, 16);
+                    packedSize += trailerSize;
+
+                    // Wipe secrets if they are no longer needed
+                    crypto_wipe(key, 32);
+                    crypto_wipe(&ctx, sizeof(struct AES_ctx));
+                }
+                else result = 2;
+            } break;
+#endif
+#if defined(RRES_SUPPORT_ENCRYPTION_XCHACHA20)
+            case RRES_CIPHER_XCHACHA20_POLY1305:
+            {
+                // Required variables for key stretching
+                uint8_t key[32] = { 0 };                    // Encryption key
+                uint8_t salt[16] = { 0 };                   // Key stretching salt
+                uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to every chunk
+                uint8_t mac[16] = { 0 };                    // Message Authentication Code generated on encryption
+
+                // NOTE: Salt is shared by chunks while password does not change, so the derived key is cached
+                // for packing and unpacking, every chunk uses a random nonce
+                RRES_SPIN_LOCK(sharedLock);
+                bool saltReady = packSaltReady || GetRandomBytes(packSalt, 16);
+                packSaltReady = saltReady;
+                memcpy(salt, packSalt, 16);
+                RRES_SPIN_UNLOCK(sharedLock);
+
+                if (saltReady && GetRandomBytes(nonce, 24))
+                {
+                    DeriveResourceKey(salt, key);
+
+                    crypto_aead_lock(packedData, mac, key, nonce, NULL, 0, packedData, packedSize);
+
+                    // Append salt, nonce and MAC to encrypted data: salt[16] + nonce[24] + MAC[16]
+                    memcpy(packedData + packedSize, salt, 16);
+                    memcpy(packedData + packedSize + 16, nonce, 24);
+                    memcpy(packedData + packedSize + 16 + 24, mac, 16);
+                    packedSize += trailerSize;
+
+                    // Wipe secrets if they are no longer needed
+                    crypto_wipe(key, 32);
+                }
+                else result = 2;
+
+                crypto_wipe(salt, 16);
+            } break;
+#endif
+            default: break;
+        }
+
+        if ((result == 2) && (rresGetCipherPassword() != NULL)) RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data encryption failed, random data not available\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        else if (result == 0) RRES_LOG("RRES: %c%c%c%c: Data encrypted successfully\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+    }
+
+    // STEP 3: Update chunk data (if compression/encryption was successful)
+    // NOTE: Packed data replaces the data block, properties are part of packed data
+    //-------------------------------------------------------------------------------------
+    if (result == 0)
+    {
+        chunk->info.compType = compType;
+
+        if (packedData != NULL)
+        {
+            RRES_FREE(blockData);
+
+            chunk->data.propCount = 0;
+            chunk->data.props = NULL;
+            chunk->data.raw = packedData;
+            chunk->info.reserved &= ~(RRES_CHUNK_RAW_BORROWED | RRES_CHUNK_PROPS_BORROWED | RRES_CHUNK_DATA_BLOCK);
+        }
+
+        chunk->info.packedSize = packedSize;
+    }
+    else RRES_FREE(packedData);
+
+    return result;
+}
+
+// Open resource data stream
+// NOTE: Only first resource chunk is streamed, externally linked file is opened and kept open
+ResourceStream OpenResourceStream(rresArchive archive, unsigned int rresId)
+{
+    ResourceStream stream = { 0 };
+
+    unsigned int offset = rresGetResourceOffset(archive, rresId);
+    rresResourceChunkInfo info = rresLoadResourceChunkInfoFromArchive(archive, rresId);
+
+    if (offset == 0)
+    {
+        RRES_LOG("RRES: WARNING: Resource could not be found for streaming: 0x%08x\n", rresId);
+        return stream;
+    }
+
+    // NOTE: Decoded data window is allocated with context
+    rresStreamContext *ctx = (rresStreamContext *)RL_CALLOC(1, sizeof(rresStreamContext) + RRES_STREAM_WINDOW_SIZE);
+    if (ctx == NULL) return stream;
+
+    ctx->archive = archive;
+    ctx->window = (unsigned char *)(ctx + 1);
+    ctx->windowMask = RRES_STREAM_WINDOW_SIZE - 1;
+
+    if (rresGetDataType(info.type) == RRES_DATA_LINK)
+    {
+        // Linked file path is loaded from chunk, data is read from external file
+        rresResourceChunk chunk = rresLoadResourceChunkFromArchive(archive, rresId);
+
+        if ((UnpackResourceChunk(&chunk) == 0) && (chunk.data.propCount > 0) && (chunk.data.raw != NULL))
+        {
+            char fullFilePath[2048] = { 0 };
+            unsigned int linkLength = chunk.data.props[0];
+
+            // Get base directory to append filepath if not provided by user
+            if (baseDir == NULL) baseDir = GetApplicationDirectory();
+
+            unsigned int baseLength = (unsigned int)strlen(baseDir);
+            if ((baseLength + linkLength) < sizeof(fullFilePath))
+            {
+                memcpy(fullFilePath, baseDir, baseLength);
+                memcpy(fullFilePath + baseLength, chunk.data.raw, linkLength);
+            }
+
+            ctx->file = fopen(fullFilePath, "rb");
+
+            if ((ctx->file != NULL) && (fseek(ctx->file, 0, SEEK_END) == 0))
+            {
+                long fileSize = ftell(ctx->file);
+
+                ctx->source = RRES_STREAM_LINK;
+                stream.size = (fileSize > 0)? (unsigned int)fileSize : 0;
+                stream.context = ctx;
+            }
+            else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be opened for streaming\n", fullFilePath);
+        }
+
+        rresUnloadResourceChunk(chunk);
+    }
+    else if ((info.cipherType == RRES_CIPHER_NONE) && (info.compType == RRES_COMP_NONE))
+    {
+        // Data follows propCount and props[]
+        unsigned int propCount = 0;
+        rresReadArchiveData(archive, offset + sizeof(rresResourceChunkInfo), &propCount, sizeof(int));
+
+        if (((unsigned long long)sizeof(int) + propCount*sizeof(int)) <= info.baseSize)
+        {
+            ctx->source = RRES_STREAM_CHUNK;
+            ctx->dataOffset = offset + sizeof(rresResourceChunkInfo) + sizeof(int) + propCount*sizeof(int);
+            stream.size = info.baseSize - sizeof(int) - propCount*sizeof(int);
+            stream.context = ctx;
+        }
+    }
+#if defined(RRES_SUPPORT_COMPRESSION_LZ4)
+    else if ((info.cipherType == RRES_CIPHER_NONE) && (info.compType == RRES_COMP_LZ4))
+    {
+        // Compressed data contains propCount and props[], they are decoded to get data start
+        unsigned int propCount = 0;
+
+        ctx->source = RRES_STREAM_LZ4;
+        ctx->dataOffset = offset + sizeof(rresResourceChunkInfo);
+        ctx->packedSize = info.packedSize;
+        ResetResourceStream(ctx);
+
+        if ((ReadResourceStreamDecoded(ctx, 0, (unsigned char *)&propCount, sizeof(int)) == sizeof(int)) &&
+            (((unsigned long long)sizeof(int) + propCount*sizeof(int)) <= info.baseSize))
+        {
+            ctx->dataSkip = sizeof(int) + propCount*sizeof(int);
+            stream.size = info.baseSize - ctx->dataSkip;
+            stream.context = ctx;
+        }
+    }
+#endif
+    else RRES_LOG("RRES: WARNING: %c%c%c%c: Chunk data can not be streamed, only uncompressed or LZ4 compressed data is supported\n", info.type[0], info.type[1], info.type[2], info.type[3]);
+
+    if (stream.context == NULL)
+    {
+        if (ctx->file != NULL) fclose(ctx->file);
+        RL_FREE(ctx);
+    }
+
+    return stream;
+}
+
+// Read resource data range from stream
+// NOTE: Range is clamped to resource data size, returns bytes read
+unsigned int ReadResourceStream(ResourceStream stream, unsigned int offset, void *buffer, unsigned int size)
+{
+    unsigned int bytesRead = 0;
+    rresStreamContext *ctx = (rresStreamContext *)stream.context;
+
+    if ((ctx != NULL) && (buffer != NULL) && (offset < stream.size))
+    {
+        if (size > (stream.size - offset)) size = stream.size - offset;
+
+        switch (ctx->source)
+        {
+            case RRES_STREAM_CHUNK:
+            {
+                if (rresReadArchiveData(ctx->archive, ctx->dataOffset + offset, buffer, size)) bytesRead = size;
+            } break;
+            case RRES_STREAM_LINK:
+            {
+                if (fseek(ctx->file, (long)offset, SEEK_SET) == 0) bytesRead = (unsigned int)fread(buffer, 1, size, ctx->file);
+            } break;
+            case RRES_STREAM_LZ4:
+            {
+                bytesRead = ReadResourceStreamDecoded(ctx, ctx->dataSkip + offset, (unsigned char *)buffer, size);
+            } break;
+            default: break;
+        }
+    }
+
+    return bytesRead;
+}
+
+// Close resource data stream
+void CloseResourceStream(ResourceStream stream)
+{
+    rresStreamContext *ctx = (rresStreamContext *)stream.context;
+
+    if (ctx != NULL)
+    {
+        if (ctx->file != NULL) fclose(ctx->file);
+        RL_FREE(ctx);
+    }
+}
+
+// Load Image data from cache
+Image LoadImageFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    Image image = { 0 };
+    rresCacheEntry *entry = LoadResourceCacheEntry(archive, rresId, RRES_CACHE_IMAGE);
+
+    if (entry != NULL) image = entry->data.image;
+
+    return image;
+}
+
+// Load Wave data from cache
+Wave LoadWaveFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    Wave wave = { 0 };
+    rresCacheEntry *entry = LoadResourceCacheEntry(archive, rresId, RRES_CACHE_WAVE);
+
+    if (entry != NULL) wave = entry->data.wave;
+
+    return wave;
+}
+
+// Load Font data from cache
+Font LoadFontFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    Font font = { 0 };
+    rresCacheEntry *entry = LoadResourceCacheEntry(archive, rresId, RRES_CACHE_FONT);
+
+    if (entry != NULL) font = entry->data.font;
+
+    return font;
+}
+
+// Load Mesh data from cache
+Mesh LoadMeshFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    Mesh mesh = { 0 };
+    rresCacheEntry *entry = LoadResourceCacheEntry(archive, rresId, RRES_CACHE_MESH);
+
+    if (entry != NULL) mesh = entry->data.mesh;
+
+    return mesh;
+}
+
+// Release cached Image reference
+void ReleaseImageFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    ReleaseResourceCacheEntry(archive, rresId, RRES_CACHE_IMAGE);
+}
+
+// Release cached Wave reference
+void ReleaseWaveFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    ReleaseResourceCacheEntry(archive, rresId, RRES_CACHE_WAVE);
+}
+
+// Release cached Font reference
+void ReleaseFontFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    ReleaseResourceCacheEntry(archive, rresId, RRES_CACHE_FONT);
+}
+
+// Release cached Mesh reference
+void ReleaseMeshFromResourceCache(rresArchive archive, unsigned int rresId)
+{
+    ReleaseResourceCacheEntry(archive, rresId, RRES_CACHE_MESH);
+}
+
+// Set resources cache budget in bytes
+void SetResourceCacheBudget(unsigned int budget)
+{
+    cacheStats.budget = budget;
+
+    EvictResourceCache(0);
+}
+
+// Unload all unreferenced cached resources
+void ClearResourceCache(void)
+{
+    for (unsigned int i = 0; i < cacheStats.count; )
+    {
+        if (cacheEntries[i].refCount == 0)
+        {
+            UnloadResourceCacheEntry(&cacheEntries[i]);
+            cacheEntries[i] = cacheEntries[--cacheStats.count];
+        }
+        else i++;
+    }
+
+    if (cacheStats.count == 0)
+    {
+        RL_FREE(cacheEntries);
+        cacheEntries = NULL;
+        cacheCapacity = 0;
+    }
+}
+
+// Get resources cache statistics
+ResourceCacheStats GetResourceCacheStats(void)
+{
+    return cacheStats;
+}
+
+// Load Image data for multiple resource ids from archive
+Image *LoadImagesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count)
+{
+    Image *images = NULL;
+
+    if ((ids != NULL) && (count > 0))
+    {
+        images = (Image *)RL_CALLOC(count, sizeof(Image));
+
+        rresBatchLoad batch = { archive, ids, images };
+        rresRunJobs(LoadImageJob, &batch, count, batchThreadCount);
+    }
+
+    return images;
+}
+
+// Load Wave data for multiple resource ids from archive
+Wave *LoadWavesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count)
+{
+    Wave *waves = NULL;
+
+    if ((ids != NULL) && (count > 0))
+    {
+        waves = (Wave *)RL_CALLOC(count, sizeof(Wave));
+
+        rresBatchLoad batch = { archive, ids, waves };
+        rresRunJobs(LoadWaveJob, &batch, count, batchThreadCount);
+    }
+
+    return waves;
+}
+
+// Load Mesh data for multiple resource ids from archive
+// NOTE: Meshes are not uploaded to GPU, UploadMesh() must be called from main thread
+Mesh *LoadMeshesFromResourceBatch(rresArchive archive, const unsigned int *ids, int count)
+{
+    Mesh *meshes = NULL;
+
+    if ((ids != NULL) && (count > 0))
+    {
+        meshes = (Mesh *)RL_CALLOC(count, sizeof(Mesh));
+
+        rresBatchLoad batch = { archive, ids, meshes };
+        rresRunJobs(LoadMeshJob, &batch, count, batchThreadCount);
+    }
+
+    return meshes;
+}
+
+// Set threads used on batch loading
+void SetResourceBatchThreads(int threadCount)
+{
+    batchThreadCount = (threadCount > 0)? threadCount : 0;
+}
+
+// Wipe derived keys cache and free key stretching work area
+void ClearResourceKeyCache(void)
+{
+#if defined(RRES_SUPPORT_KEY_CACHE)
+    RRES_SPIN_LOCK(sharedLock);
+
+    crypto_wipe(keyCache, sizeof(keyCache));
+    crypto_wipe(packSalt, 16);
+    keyCacheCounter = 0;
+    packSaltReady = false;
+
+    void *workArea = keyWorkArea;
+    keyWorkArea = NULL;
+
+    RRES_SPIN_UNLOCK(sharedLock);
+
+    if (workArea != NULL)
+    {
+        crypto_wipe(workArea, RRES_KEY_STRETCH_BLOCKS*1024);
+        RL_FREE(workArea);
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(RRES_SUPPORT_KEY_CACHE)
+// Derive encryption key from password and salt
+// NOTE 1: Argon2i key stretching is expensive (16 MB, 3 passes), derived keys are cached
+// by (password hash, salt) and the work area is kept allocated for following derivations
+// NOTE 2: Key stretching runs unlocked, if work area is in use by another thread a temporary one is used
+static void DeriveResourceKey(const unsigned char *salt, unsigned char *key)
+{
+    const char *pass = rresGetCipherPassword();
+    unsigned char passHash[32] = { 0 };
+    crypto_blake2b(passHash, 32, (const uint8_t *)pass, strlen(pass));
+
+    bool cached = false;
+    void *workArea = NULL;
+
+    RRES_SPIN_LOCK(sharedLock);
+
+    // Register password change callback to wipe cache, callback set by user is kept and chained
+    rresCipherPasswordCallback callback = rresGetCipherPasswordCallback();
+    if (callback != ResourcePasswordChanged)
+    {
+        userPasswordCallback = callback;
+        rresSetCipherPasswordCallback(ResourcePasswordChanged);
+    }
+
+    for (int i = 0; i < RRES_KEY_CACHE_SIZE; i++)
+    {
+        if ((keyCache[i].lastUse > 0) && (memcmp(keyCache[i].salt, salt, 16) == 0) && (crypto_verify32(keyCache[i].passHash, passHash) == 0))
+        {
+            keyCache[i].lastUse = ++keyCacheCounter;
+            memcpy(key, keyCache[i].key, 32);
+            cached = true;
+            break;
+        }
+    }
+
+    // Take key stretching work area ownership while in use
+    if (!cached)
+    {
+        workArea = keyWorkArea;
+        keyWorkArea = NULL;
+    }
+
+    RRES_SPIN_UNLOCK(sharedLock);
+
+    if (!cached)
+    {
+        // Key stretching configuration
+        crypto_argon2_config config = {
+            .algorithm = CRYPTO_ARGON2_I,           // Algorithm: Argon2i
+            .nb_blocks = RRES_KEY_STRETCH_BLOCKS,   // Blocks: 16 MB
+            .nb_passes = 3,                         // Iterations
+            .nb_lanes  = 1                          // Single-threaded
+        };
+        crypto_argon2_inputs inputs = {
+            .pass = (const uint8_t *)pass,          // User password
+            .salt = salt,                           // Salt for the password
+            .pass_size = (uint32_t)strlen(pass),    // Password length
+            .salt_size = 16
+        };
+        crypto_argon2_extras extras = { 0 };        // Extra parameters unused
+
+        if (workArea == NULL) workArea = RL_MALLOC(config.nb_blocks*1024);     // Key stretching work area
+
+        crypto_argon2(key, 32, workArea, config, inputs, extras);
+
+        RRES_SPIN_LOCK(sharedLock);
+
+        // Replace least recently used entry
+        rresKeyCacheEntry *entry = &keyCache[0];
+        for (int i = 1; i < RRES_KEY_CACHE_SIZE; i++) if (keyCache[i].lastUse < entry->lastUse) entry = &keyCache[i];
+
+        memcpy(entry->key, key, 32);
+        memcpy(entry->passHash, passHash, 32);
+        memcpy(entry->salt, salt, 16);
+        entry->lastUse = ++keyCacheCounter;
+
+        // Return work area to be reused, a temporary one is freed if another is already kept
+        if (keyWorkArea == NULL)
+        {
+            keyWorkArea = workArea;
+            workArea = NULL;
+        }
+
+        RRES_SPIN_UNLOCK(sharedLock);
+
+        if (workArea != NULL)
+        {
+            crypto_wipe(workArea, config.nb_blocks*1024);
+            RL_FREE(workArea);
+        }
+    }
+
+    crypto_wipe(passHash, 32);
+}
+
+// Password change callback, wipes keys cache and notifies callback set by user
+static void ResourcePasswordChanged(const char *pass)
+{
+    ClearResourceKeyCache();
+
+    if (userPasswordCallback != NULL) userPasswordCallback(pass);
+}
+
+// Get cryptographically secure random bytes from system
+// NOTE: Required to generate encryption salt and nonce on packing
+static bool GetRandomBytes(unsigned char *buffer, unsigned int size)
+{
+    bool result = false;
+
+#if defined(_WIN32)
+    // NOTE: rand_s() is declared here, it requires _CRT_RAND_S defined before stdlib.h
+    extern int __cdecl rand_s(unsigned int *randomValue);
+
+    unsigned int i = 0;
+    for (unsigned int value = 0; (i < size) && (rand_s(&value) == 0); i += 4)
+    {
+        memcpy(buffer + i, &value, ((size - i) < 4)? (size - i) : 4);
+    }
+
+    result = (i >= size);
+#else
+    FILE *randomFile = fopen("/dev/urandom", "rb");
+
+    if (randomFile != NULL)
+    {
+        result = (fread(buffer, size, 1, randomFile) == 1);
+        fclose(randomFile);
+    }
+#endif
+
+    return result;
+}
+#endif
+
+#if defined(RRES_SUPPORT_ENCRYPTION_AES)
+// Compute MD5 hash of data, result is returned in hash (4 words)
+// NOTE: Same algorithm and result layout as raylib ComputeMD5() but without static result buffer,
+// so it can be called concurrently by batch loading worker threads without locking
+static void ComputeResourceMD5(const unsigned char *data, unsigned int size, unsigned int *hash)
+{
+    static const unsigned int r[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
+
+    static const unsigned int k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+
+    hash[0] = 0x67452301;
+    hash[1] = 0xefcdab89;
+    hash[2] = 0x98badcfe;
+    hash[3] = 0x10325476;
+
+    // Process full 64 bytes blocks from data, last one or two blocks are padded
+    // and include message size in bits (little-endian, 64 bit)
+    unsigned long long bitSize = (unsigned long long)size*8;
+    unsigned int blockCount = ((size + 8)/64) + 1;
+    unsigned char tail[128] = { 0 };
+    unsigned int tailOffset = (size/64)*64;
+
+    memcpy(tail, data + tailOffset, size - tailOffset);
+    tail[size - tailOffset] = 0x80;
+    for (int i = 0; i < 8; i++) tail[(blockCount*64 - tailOffset) - 8 + i] = (unsigned char)(bitSize >> (8*i));
+
+    for (unsigned int block = 0; block < blockCount; block++)
+    {
+        const unsigned char *chunk = ((block*64) < tailOffset)? (data + block*64) : (tail + (block*64 - tailOffset));
+        unsigned int w[16] = { 0 };
+
+        for (int i = 0; i < 16; i++) w[i] = (unsigned int)chunk[i*4] | ((unsigned int)chunk[i*4 + 1] << 8) | ((unsigned int)chunk[i*4 + 2] << 16) | ((unsigned int)chunk[i*4 + 3] << 24);
+
+        unsigned int a = hash[0];
+        unsigned int b = hash[1];
+        unsigned int c = hash[2];
+        unsigned int d = hash[3];
+
+        for (int i = 0; i < 64; i++)
+        {
+            unsigned int f = 0;
+            int g = 0;
+
+            if (i < 16) { f = (b & c) | ((~b) & d); g = i; }
+            else if (i < 32) { f = (d & b) | ((~d) & c); g = (5*i + 1)%16; }
+            else if (i < 48) { f = b ^ c ^ d; g = (3*i + 5)%16; }
+            else { f = c ^ (b | (~d)); g = (7*i)%16; }
+
+            unsigned int temp = d;
+            d = c;
+            c = b;
+            f += a + k[i] + w[g];
+            b += (f << r[i]) | (f >> (32 - r[i]));
+            a = temp;
+        }
+
+        hash[0] += a;
+        hash[1] += b;
+        hash[2] += c;
+        hash[3] += d;
+    }
+}
+#endif
+
+#if defined(RRES_SUPPORT_KEY_CACHE)
+// Wait for spin lock to be released, lock is only read while waiting
+static void WaitResourceLock(volatile long *lock)
+{
+    for (int spins = 1; *lock != 0; spins++)
+    {
+        if ((spins%64) == 0) RRES_SPIN_YIELD();
+        else RRES_SPIN_PAUSE();
+    }
+}
+#endif
+
+// Load data chunk: RRES_DATA_LINK
+static void *LoadDataFromResourceLink(rresResourceChunk chunk, unsigned int *size)
+{
+    char fullFilePath[2048] = { 0 };
+    void *data = NULL;
+    *size = 0;
+
+    // Get external link filepath
+    char *linkFilePath = (char *)RL_CALLOC(chunk.data.props[0], 1);
+    if (linkFilePath != NULL) memcpy(linkFilePath, chunk.data.raw, chunk.data.props[0]);
+
+    // Get base directory to append filepath if not provided by user
+    if (baseDir == NULL) baseDir = GetApplicationDirectory();
+
+    strcpy(fullFilePath, baseDir);
+    strcat(fullFilePath, linkFilePath);
+
+    RRES_LOG("RRES: %c%c%c%c: Data file linked externally: %s\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3], linkFilePath);
+
+    if (FileExists(fullFilePath))
+    {
+        // Load external file as raw data
+        // NOTE: We check if file is a text file to allow automatic line-endings processing
+        if (IsFileExtension(linkFilePath, ".txt;.md;.vs;.fs;.info;.c;.h;.json;.xml;.glsl"))     // Text file
+        {
+            data = LoadFileText(fullFilePath);
+            *size = TextLength((char *)data);
+        }
+        else data = LoadFileData(fullFilePath, (int *)size);
+
+        if ((data != NULL) && (*size > 0)) RRES_LOG("RRES: %c%c%c%c: External linked file loaded successfully\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    }
+    else RRES_LOG("RRES: WARNING: [%s] Linked external file could not be found\n", linkFilePath);
+
+    return data;
+}
+
+// Load data chunk: RRES_DATA_RAW
+// NOTE: This chunk can be used raw files embedding or other binary blobs
+static void *LoadDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
+{
+    void *rawData = NULL;
+    const void *data = GetDataFromResourceChunk(chunk, size);
+
+    if (data != NULL)
+    {
+        rawData = RL_CALLOC(*size, 1);
+        if (rawData != NULL) memcpy(rawData, data, *size);
+    }
+
+    return rawData;
+}
+
+// Get data chunk: RRES_DATA_RAW
+// NOTE: Returned pointer references chunk data (borrowed), it's valid while chunk is loaded;
+// for chunks loaded from mapped archives it points directly to the file data
+static const void *GetDataFromResourceChunk(rresResourceChunk chunk, unsigned int *size)
+{
+    const void *data = NULL;
+    *size = 0;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        data = chunk.data.raw;
+        *size = chunk.data.props[0];
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return data;
+}
+
+// Load data chunk: RRES_DATA_TEXT
+// NOTE: This chunk can be used for shaders or other text data elements (materials?)
+static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+{
+    char *text = NULL;
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        text = (char *)RL_CALLOC(chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
+        if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+
+        // TODO: We got some extra text properties, in case they could be useful for users:
+        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
+        *codeLang = chunk.data.props[2];
+        //chunks.props[3]:cultureCode could be useful for localized text
+    }
+    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+
+    return text;
+}
+
+// Load data chunk: RRES_DATA_IMAGE
+// NOTE: Many data types use images data in some way (font, material...)
+static Image LoadImageFromResourceChunk(rresResourceChunk chunk)
+{
+    Image image = GetImageFromResourceChunk(chunk);
+
+    if (image.data != NULL)
+    {
+        unsigned int size = chunk.info.baseSize - 20;
+
+        image.data = RL_CALLOC(size, 1);
+        if (image.data != NULL) memcpy(image.data, chunk.data.raw, size);
+    }
+
+    return image;
+}
+
+// Get data chunk: RRES_DATA_IMAGE
+// NOTE: Returned image data references chunk data (borrowed), it must not be unloaded,
+// it can be uploaded to GPU directly with no intermediate copy
+static Image GetImageFromResourceChunk(rresResourceChunk chunk)
+{
+    Image image = { 0 };
+
+    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    {
+        image.width = chunk.data.props[0];
+        image.height = chunk.data.props[1];
+        int format = chunk.data.props[2];
+
+        // Assign equivalent pixel formats for our engine
+        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
+        switch (format)
+        {
+            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
+            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
+            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
+            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
+            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
+            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+            default: break;
+        }
+
+        image.mipmaps = (chunk.data.props[3] > 0)? chunk.data.props[3] : 1;
+
+        // Image data size can be computed from image properties, all mipmap levels are stored consecutively
+        unsigned int size = 0;
+        for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+        {
+            size += GetPixelDataSize(width, height, image.format);
+            width = (width > 1)? width/2 : 1;
+            height = (height > 1)? height/2 : 1;
+        }
+
+        // NOTE: Computed image data must match the data size of the chunk processed (minus propCount + props[4] size)
+        if ((size > 0) && (size == (chunk.info.baseSize - 20))) image.data = chunk.data.raw;
+        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
     }
     else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return rawData;
+    return image;
+}
+
+// Load data chunk: RRES_DATA_VERTEX
+// NOTE 1: Vertex data is expanded to float from any rresVertexFormat, (count) values are loaded,
+// normalized integer values are mapped to [0.0f..1.0f] (unsigned) or [-1.0f..1.0f] (signed)
+// NOTE 2: Data is read byte by byte (little-endian), chunk data is not required to be aligned,
+// 8/16 bit formats are converted in blocks by SIMD kernels if supported, scalar loops convert remaining values
+static float *LoadVertexDataFromResourceChunk(rresResourceChunk chunk, unsigned int count, bool normalized)
+{
+    float *result = NULL;
+    const unsigned char *data = (const unsigned char *)chunk.data.raw;
+    unsigned int format = chunk.data.props[3];
+    unsigned int formatSize = 0;
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        case RRES_VERTEX_FORMAT_BYTE: formatSize = 1; break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        case RRES_VERTEX_FORMAT_SHORT:
+        case RRES_VERTEX_FORMAT_HFLOAT: formatSize = 2; break;
+        case RRES_VERTEX_FORMAT_UINT:
+        case RRES_VERTEX_FORMAT_INT:
+        case RRES_VERTEX_FORMAT_FLOAT: formatSize = 4; break;
+        default: break;
+    }
+
+    if ((formatSize > 0) && (count > 0) && (GetChunkDataSize(chunk) >= count*formatSize)) result = (float *)RL_MALLOC(count*sizeof(float));
+
+    if (result != NULL)
+    {
+        unsigned int start = 0;     // Values already converted by SIMD kernels
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+        start = ExpandVertexData(result, data, count, format, normalized);
+#endif
+        switch (format)
+        {
+            case RRES_VERTEX_FORMAT_UBYTE:
+            {
+                float scale = normalized? 1.0f/255.0f : 1.0f;
+                for (unsigned int i = start; i < count; i++) result[i] = data[i]*scale;
+            } break;
+            case RRES_VERTEX_FORMAT_BYTE:
+            {
+                float scale = normalized? 1.0f/127.0f : 1.0f;
+                for (unsigned int i = start; i < count; i++)
+                {
+                    float value = (signed char)data[i]*scale;
+                    result[i] = (normalized && (value < -1.0f))? -1.0f : value;
+                }
+            } break;
+            case RRES_VERTEX_FORMAT_USHORT:
+            {
+                float scale = normalized? 1.0f/65535.0f : 1.0f;
+                for (unsigned int i = start; i < count; i++) result[i] = (unsigned short)(data[i*2] | (data[i*2 + 1] << 8))*scale;
+            } break;
+            case RRES_VERTEX_FORMAT_SHORT:
+            {
+                float scale = normalized? 1.0f/32767.0f : 1.0f;
+                for (unsigned int i = start; i < count; i++)
+                {
+                    float value = (short)(data[i*2] | (data[i*2 + 1] << 8))*scale;
+                    result[i] = (normalized && (value < -1.0f))? -1.0f : value;
+                }
+            } break;
+            case RRES_VERTEX_FORMAT_UINT:
+            {
+                double scale = normalized? 1.0/4294967295.0 : 1.0;
+                for (unsigned int i = 0; i < count; i++) result[i] = (float)(((unsigned int)data[i*4] | ((unsigned int)data[i*4 + 1] << 8) | ((unsigned int)data[i*4 + 2] << 16) | ((unsigned int)data[i*4 + 3] << 24))*scale);
+            } break;
+            case RRES_VERTEX_FORMAT_INT:
+            {
+                double scale = normalized? 1.0/2147483647.0 : 1.0;
+                for (unsigned int i = 0; i < count; i++)
+                {
+                    double value = (int)((unsigned int)data[i*4] | ((unsigned int)data[i*4 + 1] << 8) | ((unsigned int)data[i*4 + 2] << 16) | ((unsigned int)data[i*4 + 3] << 24))*scale;
+                    result[i] = (float)((normalized && (value < -1.0))? -1.0 : value);
+                }
+            } break;
+            case RRES_VERTEX_FORMAT_HFLOAT:
+            {
+                for (unsigned int i = start; i < count; i++) result[i] = GetFloatFromHalf((unsigned short)(data[i*2] | (data[i*2 + 1] << 8)));
+            } break;
+            case RRES_VERTEX_FORMAT_FLOAT: memcpy(result, data, count*sizeof(float)); break;
+            default: break;
+        }
+    }
+
+    return result;
+}
+
+// Load data chunk: RRES_DATA_VERTEX (indices)
+// NOTE: raylib Mesh indices are unsigned short, 32 bit indices are only loaded if all indices fit
+static unsigned short *LoadVertexIndicesFromResourceChunk(rresResourceChunk chunk)
+{
+    unsigned short *indices = NULL;
+    const unsigned char *data = (const unsigned char *)chunk.data.raw;
+    unsigned int count = chunk.data.props[0];
+    unsigned int format = chunk.data.props[3];
+    unsigned int size = GetChunkDataSize(chunk);
+
+    if (count == 0) RRES_LOG("RRES: WARNING: MESH: Vertex indices count not valid\n");
+    else if ((format == RRES_VERTEX_FORMAT_UBYTE) && (size >= count))
+    {
+        indices = (unsigned short *)RL_MALLOC(count*sizeof(unsigned short));
+
+        if (indices != NULL)
+        {
+            unsigned int start = 0;     // Indices already converted by SIMD kernels
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+            start = PackVertexIndices(indices, data, count, format, NULL);
+#endif
+            for (unsigned int i = start; i < count; i++) indices[i] = data[i];
+        }
+    }
+    else if ((format == RRES_VERTEX_FORMAT_USHORT) && (size >= count*2))
+    {
+        indices = (unsigned short *)RL_MALLOC(count*sizeof(unsigned short));
+        if (indices != NULL) memcpy(indices, data, count*sizeof(unsigned short));
+    }
+    else if (((format == RRES_VERTEX_FORMAT_UINT) || (format == RRES_VERTEX_FORMAT_INT)) && (size >= count*4))
+    {
+        indices = (unsigned short *)RL_MALLOC(count*sizeof(unsigned short));
+
+        if (indices != NULL)
+        {
+            unsigned int maxIndex = 0;
+            unsigned int start = 0;     // Indices already converted by SIMD kernels
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+            start = PackVertexIndices(indices, data, count, format, &maxIndex);
+#endif
+            for (unsigned int i = start; i < count; i++)
+            {
+                unsigned int index = (unsigned int)data[i*4] | ((unsigned int)data[i*4 + 1] << 8) | ((unsigned int)data[i*4 + 2] << 16) | ((unsigned int)data[i*4 + 3] << 24);
+                maxIndex |= index;
+                indices[i] = (unsigned short)index;
+            }
+
+            if (maxIndex > 0xffff)
+            {
+                RRES_LOG("RRES: WARNING: MESH: Vertex indices do not fit 16 bit, not supported by raylib Mesh\n");
+                RL_FREE(indices);
+                indices = NULL;
+            }
+        }
+    }
+
+    return indices;
+}
+
+// Get chunk data size (bytes), properties not considered
+static unsigned int GetChunkDataSize(rresResourceChunk chunk)
+{
+    unsigned int propsSize = (chunk.data.propCount + 1)*sizeof(unsigned int);
+
+    return (chunk.info.baseSize > propsSize)? (chunk.info.baseSize - propsSize) : 0;
+}
+
+// Set chunk data from unpacked memory (propCount + props[] + data), chunk is registered as not compressed/encrypted
+// NOTE: Properties and data are referenced from unpacked memory, owned by the chunk unless borrowed (user buffer)
+static void SetChunkUnpackedData(rresResourceChunk *chunk, unsigned char *unpackedData, unsigned int unpackedSize, bool borrowed)
+{
+    unsigned int propCount = ((unsigned int *)unpackedData)[0];
+    if ((sizeof(int) + propCount*sizeof(int)) > unpackedSize) propCount = 0;
+
+    chunk->data.propCount = propCount;
+    chunk->data.props = (propCount > 0)? ((unsigned int *)unpackedData + 1) : NULL;
+    chunk->data.raw = unpackedData + sizeof(int) + propCount*sizeof(int);
+
+    // Register unpacked memory ownership
+    chunk->info.reserved &= ~(RRES_CHUNK_RAW_BORROWED | RRES_CHUNK_PROPS_BORROWED | RRES_CHUNK_DATA_BLOCK);
+    if (borrowed) chunk->info.reserved |= (RRES_CHUNK_RAW_BORROWED | RRES_CHUNK_PROPS_BORROWED);
+    else chunk->info.reserved |= RRES_CHUNK_DATA_BLOCK;
+
+    // Data is not compressed/encrypted any more, register it
+    chunk->info.cipherType = RRES_CIPHER_NONE;
+    chunk->info.compType = RRES_COMP_NONE;
+    chunk->info.packedSize = unpackedSize;
+}
+
+// Get float value from half-float (16 bit) value
+static float GetFloatFromHalf(unsigned short value)
+{
+    unsigned int sign = (value & 0x8000u) << 16;
+    unsigned int exponent = (value >> 10) & 0x1f;
+    unsigned int mantissa = value & 0x3ff;
+    float result = 0.0f;
+
+    if (exponent == 0)              // Zero or subnormal value
+    {
+        result = mantissa*(1.0f/16777216.0f);
+        if (sign) result = -result;
+    }
+    else
+    {
+        unsigned int bits = 0;
+
+        if (exponent == 0x1f) bits = sign | 0x7f800000u | (mantissa << 13);       // Inf or NaN
+        else bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+        memcpy(&result, &bits, sizeof(float));
+    }
+
+    return result;
+}
+
+#if defined(RRES_SUPPORT_VERTEX_SIMD)
+#if defined(RRES_VERTEX_SSE2)
+// Get float values from half-float values (4 lanes, zero-extended), matching GetFloatFromHalf()
+static __m128 GetFloatFromHalfSSE2(__m128i value)
+{
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x8000)), 16);
+    __m128i bits = _mm_and_si128(value, _mm_set1_epi32(0x7fff));
+    __m128i subnormal = _mm_cmplt_epi32(bits, _mm_set1_epi32(0x0400));
+    __m128i infnan = _mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7bff));
+    __m128 small = _mm_mul_ps(_mm_cvtepi32_ps(bits), _mm_set1_ps(1.0f/16777216.0f));
+
+    // Rebias exponent (15 -> 127), Inf/NaN exponent (0x1f) rebiased twice to reach 0xff
+    __m128i normal = _mm_add_epi32(_mm_slli_epi32(bits, 13), _mm_set1_epi32(112 << 23));
+    normal = _mm_add_epi32(normal, _mm_and_si128(infnan, _mm_set1_epi32(112 << 23)));
+
+    __m128i result = _mm_or_si128(_mm_and_si128(subnormal, _mm_castps_si128(small)), _mm_andnot_si128(subnormal, normal));
+
+    return _mm_castsi128_ps(_mm_or_si128(result, sign));
+}
+#elif defined(RRES_VERTEX_NEON)
+// Get float values from half-float values (4 lanes, zero-extended), matching GetFloatFromHalf()
+// NOTE: vcvt_f32_f16() is not used, it quiets signaling NaN values
+static float32x4_t GetFloatFromHalfNEON(uint32x4_t value)
+{
+    uint32x4_t sign = vshlq_n_u32(vandq_u32(value, vdupq_n_u32(0x8000)), 16);
+    uint32x4_t bits = vandq_u32(value, vdupq_n_u32(0x7fff));
+    uint32x4_t subnormal = vcltq_u32(bits, vdupq_n_u32(0x0400));
+    uint32x4_t infnan = vcgtq_u32(bits, vdupq_n_u32(0x7bff));
+    float32x4_t small = vmulq_f32(vcvtq_f32_u32(bits), vdupq_n_f32(1.0f/16777216.0f));
+
+    // Rebias exponent (15 -> 127), Inf/NaN exponent (0x1f) rebiased twice to reach 0xff
+    uint32x4_t normal = vaddq_u32(vshlq_n_u32(bits, 13), vdupq_n_u32(112 << 23));
+    normal = vaddq_u32(normal, vandq_u32(infnan, vdupq_n_u32(112 << 23)));
+
+    return vreinterpretq_f32_u32(vorrq_u32(vbslq_u32(subnormal, vreinterpretq_u32_f32(small), normal), sign));
+}
+#endif
+
+// Convert vertex data blocks to float (SIMD), 8/16 bit formats: UBYTE, BYTE, USHORT, SHORT, HFLOAT
+// NOTE: Only full blocks of 16 values are converted, same operations as scalar loops (results are bit-exact),
+// remaining values and other formats are converted by scalar loops, returns number of values converted
+static unsigned int ExpandVertexData(float *result, const unsigned char *data, unsigned int count, unsigned int format, bool normalized)
+{
+    unsigned int blockCount = count - count%16;
+    unsigned int i = 0;
+
+#if defined(RRES_VERTEX_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        {
+            const __m128 scale = _mm_set1_ps(normalized? 1.0f/255.0f : 1.0f);
+
+            for (; i < blockCount; i += 16)
+            {
+                __m128i values = _mm_loadu_si128((const __m128i *)(data + i));
+                __m128i lo = _mm_unpacklo_epi8(values, zero);
+                __m128i hi = _mm_unpackhi_epi8(values, zero);
+
+                _mm_storeu_ps(result + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+                _mm_storeu_ps(result + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+                _mm_storeu_ps(result + i + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+                _mm_storeu_ps(result + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_BYTE:
+        {
+            // NOTE: Clamp to -1.0f only affects normalized values, -128.0f is a no-op otherwise
+            const __m128 scale = _mm_set1_ps(normalized? 1.0f/127.0f : 1.0f);
+            const __m128 minValue = _mm_set1_ps(normalized? -1.0f : -128.0f);
+
+            for (; i < blockCount; i += 16)
+            {
+                __m128i values = _mm_loadu_si128((const __m128i *)(data + i));
+                __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(values, values), 8);      // Sign extend to 16 bit
+                __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(values, values), 8);
+
+                _mm_storeu_ps(result + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16)), scale), minValue));
+                _mm_storeu_ps(result + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16)), scale), minValue));
+                _mm_storeu_ps(result + i + 8, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16)), scale), minValue));
+                _mm_storeu_ps(result + i + 12, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16)), scale), minValue));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        {
+            const __m128 scale = _mm_set1_ps(normalized? 1.0f/65535.0f : 1.0f);
+
+            for (; i < blockCount; i += 8)
+            {
+                __m128i values = _mm_loadu_si128((const __m128i *)(data + i*2));
+
+                _mm_storeu_ps(result + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)), scale));
+                _mm_storeu_ps(result + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)), scale));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_SHORT:
+        {
+            // NOTE: Clamp to -1.0f only affects normalized values, -32768.0f is a no-op otherwise
+            const __m128 scale = _mm_set1_ps(normalized? 1.0f/32767.0f : 1.0f);
+            const __m128 minValue = _mm_set1_ps(normalized? -1.0f : -32768.0f);
+
+            for (; i < blockCount; i += 8)
+            {
+                __m128i values = _mm_loadu_si128((const __m128i *)(data + i*2));
+
+                _mm_storeu_ps(result + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16)), scale), minValue));
+                _mm_storeu_ps(result + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16)), scale), minValue));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_HFLOAT:
+        {
+            for (; i < blockCount; i += 8)
+            {
+                __m128i values = _mm_loadu_si128((const __m128i *)(data + i*2));
+
+                _mm_storeu_ps(result + i, GetFloatFromHalfSSE2(_mm_unpacklo_epi16(values, zero)));
+                _mm_storeu_ps(result + i + 4, GetFloatFromHalfSSE2(_mm_unpackhi_epi16(values, zero)));
+            }
+        } break;
+        default: break;
+    }
+#elif defined(RRES_VERTEX_NEON)
+    switch (format)
+    {
+        case RRES_VERTEX_FORMAT_UBYTE:
+        {
+            const float32x4_t scale = vdupq_n_f32(normalized? 1.0f/255.0f : 1.0f);
+
+            for (; i < blockCount; i += 16)
+            {
+                uint8x16_t values = vld1q_u8(data + i);
+                uint16x8_t lo = vmovl_u8(vget_low_u8(values));
+                uint16x8_t hi = vmovl_u8(vget_high_u8(values));
+
+                vst1q_f32(result + i, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+                vst1q_f32(result + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+                vst1q_f32(result + i + 8, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+                vst1q_f32(result + i + 12, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_BYTE:
+        {
+            // NOTE: Clamp to -1.0f only affects normalized values, -128.0f is a no-op otherwise
+            const float32x4_t scale = vdupq_n_f32(normalized? 1.0f/127.0f : 1.0f);
+            const float32x4_t minValue = vdupq_n_f32(normalized? -1.0f : -128.0f);
+
+            for (; i < blockCount; i += 16)
+            {
+                int8x16_t values = vreinterpretq_s8_u8(vld1q_u8(data + i));
+                int16x8_t lo = vmovl_s8(vget_low_s8(values));
+                int16x8_t hi = vmovl_s8(vget_high_s8(values));
+
+                vst1q_f32(result + i, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))), scale), minValue));
+                vst1q_f32(result + i + 4, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))), scale), minValue));
+                vst1q_f32(result + i + 8, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))), scale), minValue));
+                vst1q_f32(result + i + 12, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi))), scale), minValue));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_USHORT:
+        {
+            const float32x4_t scale = vdupq_n_f32(normalized? 1.0f/65535.0f : 1.0f);
+
+            for (; i < blockCount; i += 8)
+            {
+                uint16x8_t values = vreinterpretq_u16_u8(vld1q_u8(data + i*2));
+
+                vst1q_f32(result + i, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))), scale));
+                vst1q_f32(result + i + 4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))), scale));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_SHORT:
+        {
+            // NOTE: Clamp to -1.0f only affects normalized values, -32768.0f is a no-op otherwise
+            const float32x4_t scale = vdupq_n_f32(normalized? 1.0f/32767.0f : 1.0f);
+            const float32x4_t minValue = vdupq_n_f32(normalized? -1.0f : -32768.0f);
+
+            for (; i < blockCount; i += 8)
+            {
+                int16x8_t values = vreinterpretq_s16_u8(vld1q_u8(data + i*2));
+
+                vst1q_f32(result + i, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(values))), scale), minValue));
+                vst1q_f32(result + i + 4, vmaxq_f32(vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(values))), scale), minValue));
+            }
+        } break;
+        case RRES_VERTEX_FORMAT_HFLOAT:
+        {
+            for (; i < blockCount; i += 8)
+            {
+                uint16x8_t values = vreinterpretq_u16_u8(vld1q_u8(data + i*2));
+
+                vst1q_f32(result + i, GetFloatFromHalfNEON(vmovl_u16(vget_low_u16(values))));
+                vst1q_f32(result + i + 4, GetFloatFromHalfNEON(vmovl_u16(vget_high_u16(values))));
+            }
+        } break;
+        default: break;
+    }
+#endif
+
+    return i;
 }
 
-// Load data chunk: RRES_DATA_TEXT
-// NOTE: This chunk can be used for shaders or other text data elements (materials?)
-static char *LoadTextFromResourceChunk(rresResourceChunk chunk, unsigned int *codeLang)
+// Convert vertex indices blocks to unsigned short (SIMD), formats: UBYTE (widened), UINT/INT (narrowed)
+// NOTE: Only full blocks of 16 indices are converted, remaining indices are converted by scalar loops,
+// 32 bit indices are accumulated (OR) into maxIndex to check they fit 16 bit, returns number of indices converted
+static unsigned int PackVertexIndices(unsigned short *indices, const unsigned char *data, unsigned int count, unsigned int format, unsigned int *maxIndex)
 {
-    char *text = NULL;
+    unsigned int blockCount = count - count%16;
+    unsigned int i = 0;
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+#if defined(RRES_VERTEX_SSE2)
+    if (format == RRES_VERTEX_FORMAT_UBYTE)
     {
-        text = (char *)RL_CALLOC(chunk.data.props[0] + 1, 1);   // We add NULL terminator, just in case
-        if (text != NULL) memcpy(text, chunk.data.raw, chunk.data.props[0]);
+        for (; i < blockCount; i += 16)
+        {
+            __m128i values = _mm_loadu_si128((const __m128i *)(data + i));
 
-        // TODO: We got some extra text properties, in case they could be useful for users:
-        // chunk.props[1]:rresTextEncoding, chunk.props[2]:rresCodeLang, chunk. props[3]:cultureCode
-        *codeLang = chunk.data.props[2];
-        //chunks.props[3]:cultureCode could be useful for localized text
+            _mm_storeu_si128((__m128i *)(indices + i), _mm_unpacklo_epi8(values, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i *)(indices + i + 8), _mm_unpackhi_epi8(values, _mm_setzero_si128()));
+        }
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
+    else if ((format == RRES_VERTEX_FORMAT_UINT) || (format == RRES_VERTEX_FORMAT_INT))
+    {
+        __m128i accum = _mm_setzero_si128();
+        unsigned int lanes[4] = { 0 };
 
-    return text;
+        for (; i < blockCount; i += 8)
+        {
+            __m128i lo = _mm_loadu_si128((const __m128i *)(data + i*4));
+            __m128i hi = _mm_loadu_si128((const __m128i *)(data + i*4 + 16));
+
+            accum = _mm_or_si128(accum, _mm_or_si128(lo, hi));
+
+            // NOTE: SSE2 has no unsigned saturation pack from 32 bit, low 16 bit are sign extended
+            // so the signed saturation pack keeps them unchanged
+            lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+            hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+            _mm_storeu_si128((__m128i *)(indices + i), _mm_packs_epi32(lo, hi));
+        }
+
+        _mm_storeu_si128((__m128i *)lanes, accum);
+        *maxIndex |= lanes[0] | lanes[1] | lanes[2] | lanes[3];
+    }
+#elif defined(RRES_VERTEX_NEON)
+    if (format == RRES_VERTEX_FORMAT_UBYTE)
+    {
+        for (; i < blockCount; i += 16)
+        {
+            uint8x16_t values = vld1q_u8(data + i);
+
+            vst1q_u16(indices + i, vmovl_u8(vget_low_u8(values)));
+            vst1q_u16(indices + i + 8, vmovl_u8(vget_high_u8(values)));
+        }
+    }
+    else if ((format == RRES_VERTEX_FORMAT_UINT) || (format == RRES_VERTEX_FORMAT_INT))
+    {
+        uint32x4_t accum = vdupq_n_u32(0);
+
+        for (; i < blockCount; i += 8)
+        {
+            uint32x4_t lo = vreinterpretq_u32_u8(vld1q_u8(data + i*4));
+            uint32x4_t hi = vreinterpretq_u32_u8(vld1q_u8(data + i*4 + 16));
+
+            accum = vorrq_u32(accum, vorrq_u32(lo, hi));
+            vst1q_u16(indices + i, vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+        }
+
+        *maxIndex |= vgetq_lane_u32(accum, 0) | vgetq_lane_u32(accum, 1) | vgetq_lane_u32(accum, 2) | vgetq_lane_u32(accum, 3);
+    }
+#endif
+
+    return i;
 }
+#endif
 
-// Load data chunk: RRES_DATA_IMAGE
-// NOTE: Many data types use images data in some way (font, material...)
-static Image LoadImageFromResourceChunk(rresResourceChunk chunk)
+// Load, unpack and convert one Image (batch loading job)
+static void LoadImageJob(void *userData, unsigned int index)
 {
-    Image image = { 0 };
+    rresBatchLoad *batch = (rresBatchLoad *)userData;
+    rresResourceChunk chunk = { 0 };
 
-    if ((chunk.info.compType == RRES_COMP_NONE) && (chunk.info.cipherType == RRES_CIPHER_NONE))
+    if (LoadResourceChunkToBuffer(batch->archive, batch->ids[index], &chunk, NULL, 0) == 0) ((Image *)batch->results)[index] = LoadImageFromResource(chunk);
+
+    rresUnloadResourceChunk(chunk);
+}
+
+// Load, unpack and convert one Wave (batch loading job)
+static void LoadWaveJob(void *userData, unsigned int index)
+{
+    rresBatchLoad *batch = (rresBatchLoad *)userData;
+    rresResourceChunk chunk = { 0 };
+
+    if (LoadResourceChunkToBuffer(batch->archive, batch->ids[index], &chunk, NULL, 0) == 0) ((Wave *)batch->results)[index] = LoadWaveFromResource(chunk);
+
+    rresUnloadResourceChunk(chunk);
+}
+
+// Load, unpack and convert one Mesh (batch loading job)
+static void LoadMeshJob(void *userData, unsigned int index)
+{
+    rresBatchLoad *batch = (rresBatchLoad *)userData;
+    rresResourceMulti multi = rresLoadResourceMultiFromArchive(batch->archive, batch->ids[index]);
+
+    if ((multi.count > 0) && (UnpackResourceMulti(&multi) == 0)) ((Mesh *)batch->results)[index] = LoadMeshFromResource(multi);
+
+    rresUnloadResourceMulti(multi);
+}
+
+// Get cache entry, resource is loaded (and unpacked) from archive if not cached
+// NOTE: Unreferenced resources are evicted before adding the new one, returned entry is valid until next cache call
+static rresCacheEntry *LoadResourceCacheEntry(rresArchive archive, unsigned int rresId, rresCacheType type)
+{
+    rresCacheEntry *entry = NULL;
+
+    for (unsigned int i = 0; i < cacheStats.count; i++)
     {
-        image.width = chunk.data.props[0];
-        image.height = chunk.data.props[1];
-        int format = chunk.data.props[2];
+        if ((cacheEntries[i].archive == archive.id) && (cacheEntries[i].id == rresId) && (cacheEntries[i].type == type))
+        {
+            entry = &cacheEntries[i];
+            entry->refCount++;
+            entry->lastUse = ++cacheCounter;
+            cacheStats.hits++;
+            break;
+        }
+    }
 
-        // Assign equivalent pixel formats for our engine
-        // NOTE: In this case rresPixelFormat defined values match raylib PixelFormat values
-        switch (format)
+    if ((entry == NULL) && (archive.file != NULL))
+    {
+        rresCacheEntry loaded = { 0 };
+        bool valid = false;
+
+        cacheStats.misses++;
+
+        rresResourceMulti multi = rresLoadResourceMultiFromArchive(archive, rresId);
+
+        if ((multi.count > 0) && (UnpackResourceMulti(&multi) == 0))
         {
-            case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE; break;
-            case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G6B5: image.format = PIXELFORMAT_UNCOMPRESSED_R5G6B5; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: image.format = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1; break;
-            case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: image.format = PIXELFORMAT_UNCOMPRESSED_R4G4B4A4; break;
-            case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32: image.format = PIXELFORMAT_UNCOMPRESSED_R32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32; break;
-            case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: image.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGB: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_DXT1_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT3_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_DXT5_RGBA: image.format = PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ETC1_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_RGB: image.format = PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
-            case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA: image.format = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGB: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
-            case RRES_PIXELFORMAT_COMP_PVRT_RGBA: image.format = PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
-            case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA: image.format = PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+            switch (type)
+            {
+                case RRES_CACHE_IMAGE: loaded.data.image = LoadImageFromResource(multi.chunks[0]); valid = (loaded.data.image.data != NULL); break;
+                case RRES_CACHE_WAVE: loaded.data.wave = LoadWaveFromResource(multi.chunks[0]); valid = (loaded.data.wave.data != NULL); break;
+                case RRES_CACHE_FONT: loaded.data.font = LoadFontFromResource(multi); valid = (loaded.data.font.glyphs != NULL); break;
+                case RRES_CACHE_MESH: loaded.data.mesh = LoadMeshFromResource(multi); valid = (loaded.data.mesh.vertices != NULL); break;
+                default: break;
+            }
+        }
+
+        rresUnloadResourceMulti(multi);
+
+        if (valid)
+        {
+            loaded.archive = archive.id;
+            loaded.id = rresId;
+            loaded.type = type;
+            loaded.refCount = 1;
+            loaded.lastUse = ++cacheCounter;
+            loaded.size = GetResourceDataSize(&loaded);
+
+            EvictResourceCache(loaded.size);
+
+            if (cacheStats.count == cacheCapacity)
+            {
+                unsigned int capacity = (cacheCapacity > 0)? cacheCapacity*2 : 64;
+                rresCacheEntry *entries = (rresCacheEntry *)RL_REALLOC(cacheEntries, capacity*sizeof(rresCacheEntry));
+
+                if (entries != NULL)
+                {
+                    cacheEntries = entries;
+                    cacheCapacity = capacity;
+                }
+            }
+
+            if (cacheStats.count < cacheCapacity)
+            {
+                entry = &cacheEntries[cacheStats.count++];
+                *entry = loaded;
+                cacheStats.size += loaded.size;
+            }
+            else UnloadResourceCacheEntry(&loaded);
+        }
+        else RRES_LOG("RRES: WARNING: Resource could not be loaded into cache: 0x%08x\n", rresId);
+    }
+
+    return entry;
+}
+
+// Release cache entry reference
+// NOTE: Entry is matched by resource type as well, same resource could be cached as multiple types
+static void ReleaseResourceCacheEntry(rresArchive archive, unsigned int rresId, rresCacheType type)
+{
+    for (unsigned int i = 0; i < cacheStats.count; i++)
+    {
+        if ((cacheEntries[i].archive == archive.id) && (cacheEntries[i].id == rresId) &&
+            (cacheEntries[i].type == type) && (cacheEntries[i].refCount > 0))
+        {
+            cacheEntries[i].refCount--;
+            break;
+        }
+    }
+
+    // Referenced resources could have exceeded budget
+    EvictResourceCache(0);
+}
+
+// Unload cache entry resource data
+static void UnloadResourceCacheEntry(rresCacheEntry *entry)
+{
+    switch (entry->type)
+    {
+        case RRES_CACHE_IMAGE: UnloadImage(entry->data.image); break;
+        case RRES_CACHE_WAVE: UnloadWave(entry->data.wave); break;
+        case RRES_CACHE_FONT: UnloadFont(entry->data.font); break;
+        case RRES_CACHE_MESH: UnloadMesh(entry->data.mesh); break;
+        default: break;
+    }
+
+    if (entry->size <= cacheStats.size) cacheStats.size -= entry->size;
+    else cacheStats.size = 0;
+}
+
+// Evict unreferenced resources (least recently used first) until size fits in budget
+static void EvictResourceCache(unsigned int size)
+{
+    while (((unsigned long long)cacheStats.size + size) > cacheStats.budget)
+    {
+        int index = -1;
+
+        for (unsigned int i = 0; i < cacheStats.count; i++)
+        {
+            if ((cacheEntries[i].refCount == 0) && ((index < 0) || (cacheEntries[i].lastUse < cacheEntries[index].lastUse))) index = i;
+        }
+
+        if (index < 0) break;   // Only referenced resources cached
+
+        UnloadResourceCacheEntry(&cacheEntries[index]);
+        cacheEntries[index] = cacheEntries[--cacheStats.count];
+        cacheStats.evictions++;
+    }
+}
+
+// Get cache entry resource data size (bytes)
+// NOTE: Font texture data size is considered, it is kept in GPU memory
+static unsigned int GetResourceDataSize(rresCacheEntry *entry)
+{
+    unsigned int size = 0;
+
+    switch (entry->type)
+    {
+        case RRES_CACHE_IMAGE:
+        {
+            Image image = entry->data.image;
+
+            for (int i = 0, width = image.width, height = image.height; i < ((image.mipmaps > 0)? image.mipmaps : 1); i++)
+            {
+                size += GetPixelDataSize(width, height, image.format);
+                width = (width > 1)? width/2 : 1;
+                height = (height > 1)? height/2 : 1;
+            }
+        } break;
+        case RRES_CACHE_WAVE: size = entry->data.wave.frameCount*entry->data.wave.channels*(entry->data.wave.sampleSize/8); break;
+        case RRES_CACHE_FONT:
+        {
+            Font font = entry->data.font;
+
+            size = font.glyphCount*(sizeof(GlyphInfo) + sizeof(Rectangle)) + GetPixelDataSize(font.texture.width, font.texture.height, font.texture.format);
+            for (int i = 0; i < font.glyphCount; i++) size += GetPixelDataSize(font.glyphs[i].image.width, font.glyphs[i].image.height, font.glyphs[i].image.format);
+        } break;
+        case RRES_CACHE_MESH:
+        {
+            Mesh mesh = entry->data.mesh;
+
+            if (mesh.vertices != NULL) size += mesh.vertexCount*3*sizeof(float);
+            if (mesh.texcoords != NULL) size += mesh.vertexCount*2*sizeof(float);
+            if (mesh.texcoords2 != NULL) size += mesh.vertexCount*2*sizeof(float);
+            if (mesh.normals != NULL) size += mesh.vertexCount*3*sizeof(float);
+            if (mesh.tangents != NULL) size += mesh.vertexCount*4*sizeof(float);
+            if (mesh.colors != NULL) size += mesh.vertexCount*4*sizeof(unsigned char);
+            if (mesh.indices != NULL) size += mesh.triangleCount*3*sizeof(unsigned short);
+        } break;
+        default: break;
+    }
+
+    return size;
+}
+
+// Reset LZ4 decoder to data start
+static void ResetResourceStream(rresStreamContext *ctx)
+{
+    ctx->inputOffset = 0;
+    ctx->inputPosition = 0;
+    ctx->inputSize = 0;
+    ctx->decodedSize = 0;
+    ctx->literalCount = 0;
+    ctx->matchCount = 0;
+    ctx->matchOffset = 0;
+    ctx->token = 0;
+    ctx->state = RRES_LZ4_TOKEN;
+    ctx->crc32 = 0;
+}
+
+// Refill compressed data read buffer from archive if consumed
+// NOTE: Returns false if no more compressed data is available
+static bool FillResourceStreamInput(rresStreamContext *ctx)
+{
+    bool result = true;
+
+    if (ctx->inputPosition == ctx->inputSize)
+    {
+        unsigned int size = ctx->packedSize - ctx->inputOffset;
+        if (size > RRES_STREAM_INPUT_SIZE) size = RRES_STREAM_INPUT_SIZE;
+
+        if ((size > 0) && rresReadArchiveData(ctx->archive, ctx->dataOffset + ctx->inputOffset, ctx->input, size))
+        {
+            if (ctx->verify) ctx->crc32 = rresUpdateCRC32(ctx->crc32, ctx->input, size);
+
+            ctx->inputOffset += size;
+            ctx->inputPosition = 0;
+            ctx->inputSize = size;
+        }
+        else result = false;
+    }
+
+    return result;
+}
+
+// Read one compressed data byte
+static bool ReadResourceStreamInput(rresStreamContext *ctx, unsigned char *value)
+{
+    bool result = FillResourceStreamInput(ctx);
+
+    if (result) *value = ctx->input[ctx->inputPosition++];
+
+    return result;
+}
+
+// Decode LZ4 sequences fully available in read buffer, literals and matches copied directly
+// NOTE: Decoding stops (context updated up to last sequence decoded) at a sequence not fully available in read buffer,
+// exceeding provided decoded size or wrapping around window, it's decoded by state machine in that case;
+// last sequence (literals only) and corrupted sequences are also left to state machine
+static void DecodeResourceStreamSequences(rresStreamContext *ctx, unsigned int decodedSize)
+{
+    // NOTE: Context is kept in local variables while decoding, window writes could alias it
+    const unsigned char *input = ctx->input;
+    const unsigned int end = ctx->inputSize;
+    unsigned char *window = ctx->window;
+    const unsigned int windowMask = ctx->windowMask;
+    unsigned int inputPosition = ctx->inputPosition;
+    unsigned int outputSize = ctx->decodedSize;
+    unsigned char token = ctx->token;
+
+    while ((outputSize < decodedSize) && (inputPosition < end))
+    {
+        // Decoded data space: up to provided decoded size, not wrapping around window
+        unsigned int windowPosition = outputSize & windowMask;
+        unsigned int space = decodedSize - outputSize;
+        if ((space - 1) > (windowMask - windowPosition)) space = windowMask - windowPosition + 1;
+
+        unsigned int position = inputPosition;
+        unsigned char sequenceToken = input[position++];
+        unsigned int literalCount = sequenceToken >> 4;
+        unsigned int matchCount = (sequenceToken & 15) + 4;
+        unsigned char *output = window + windowPosition;
+
+        // Short sequences (most common), literals and match copied in fixed size blocks
+        if ((literalCount < 15) && (matchCount < 19) && ((end - position) >= 32) && (space >= 64))
+        {
+            unsigned int matchOffset = input[position + literalCount] | (input[position + literalCount + 1] << 8);
+
+            if ((matchOffset >= 16) && (matchOffset <= (windowPosition + literalCount)))
+            {
+                memcpy(output, input + position, 16);
+                output += literalCount;
+                memcpy(output, output - matchOffset, 16);
+                memcpy(output + 16, output - matchOffset + 16, 2);
+
+                inputPosition = position + literalCount + 2;
+                outputSize += (literalCount + matchCount);
+                token = sequenceToken;
+                continue;
+            }
+        }
+
+        unsigned char value = 255;
+
+        if (literalCount == 15)
+        {
+            do
+            {
+                if (position == end) break;
+                value = input[position++];
+                literalCount += value;
+            } while (value == 255);
+
+            if (value == 255) break;
+        }
+
+        // Literals and match offset must be available
+        if ((end - position) < (literalCount + 2)) break;
+
+        const unsigned char *literals = input + position;
+        unsigned int literalsAvailable = end - position;
+        position += literalCount;
+
+        unsigned int matchOffset = input[position] | (input[position + 1] << 8);
+        position += 2;
+        value = 255;
+
+        if (matchCount == 19)
+        {
+            do
+            {
+                if (position == end) break;
+                value = input[position++];
+                matchCount += value;
+            } while (value == 255);
+
+            if (value == 255) break;
+        }
+
+        if (space < (literalCount + matchCount)) break;
+        if ((matchOffset == 0) || (matchOffset > (windowPosition + literalCount))) break;    // Match before window start (or wrapped)
+
+        // Literals and match are copied in fixed size blocks if decoded data space after sequence can be overwritten
+        // NOTE: Match can overlap data being copied (offset < length), copied byte by byte in that case
+        bool overwrite = ((space - literalCount - matchCount) >= 16);
+
+        if (overwrite && (literalsAvailable >= (literalCount + 16))) for (unsigned int i = 0; i < literalCount; i += 16) memcpy(output + i, literals + i, 16);
+        else memcpy(output, literals, literalCount);
+        output += literalCount;
+
+        const unsigned char *match = output - matchOffset;
+        if (overwrite && (matchOffset >= 16)) for (unsigned int i = 0; i < matchCount; i += 16) memcpy(output + i, match + i, 16);
+        else if (matchOffset >= matchCount) memcpy(output, match, matchCount);
+        else for (unsigned int i = 0; i < matchCount; i++) output[i] = match[i];
+
+        inputPosition = position;
+        outputSize += (literalCount + matchCount);
+        token = sequenceToken;
+    }
+
+    ctx->inputPosition = inputPosition;
+    ctx->decodedSize = outputSize;
+    ctx->token = token;
+}
+
+// Decode LZ4 data up to provided decoded size
+// NOTE: LZ4 block format: sequences of (token, literals length, literals, match offset, match length),
+// last sequence only contains literals; decoding can stop at any byte and continue later
+static void DecodeResourceStream(rresStreamContext *ctx, unsigned int decodedSize)
+{
+    unsigned char value = 0;
+
+    while ((ctx->decodedSize < decodedSize) && (ctx->state != RRES_LZ4_END) && (ctx->state != RRES_LZ4_ERROR))
+    {
+        switch (ctx->state)
+        {
+            case RRES_LZ4_TOKEN:
+            {
+                // Sequences fully available in read buffer are decoded at once, no state transitions
+                DecodeResourceStreamSequences(ctx, decodedSize);
+                if (ctx->decodedSize == decodedSize) break;
+
+                if (!ReadResourceStreamInput(ctx, &ctx->token)) { ctx->state = RRES_LZ4_END; break; }
+
+                ctx->literalCount = ctx->token >> 4;
+                if (ctx->literalCount == 15)
+                {
+                    do
+                    {
+                        if (!ReadResourceStreamInput(ctx, &value)) { ctx->state = RRES_LZ4_ERROR; break; }
+                        ctx->literalCount += value;
+                    } while (value == 255);
+                }
+
+                if (ctx->state != RRES_LZ4_ERROR) ctx->state = RRES_LZ4_LITERALS;
+            } break;
+            case RRES_LZ4_LITERALS:
+            {
+                // Literals are copied from read buffer in blocks
+                while ((ctx->literalCount > 0) && (ctx->decodedSize < decodedSize))
+                {
+                    if (!FillResourceStreamInput(ctx)) { ctx->state = RRES_LZ4_ERROR; break; }
+
+                    unsigned int count = ctx->inputSize - ctx->inputPosition;
+                    unsigned int windowPosition = ctx->decodedSize & ctx->windowMask;
+
+                    if (count > ctx->literalCount) count = ctx->literalCount;
+                    if (count > (decodedSize - ctx->decodedSize)) count = decodedSize - ctx->decodedSize;
+                    if (count > (ctx->windowMask - windowPosition)) count = ctx->windowMask - windowPosition + 1;
+
+                    memcpy(ctx->window + windowPosition, ctx->input + ctx->inputPosition, count);
+                    ctx->inputPosition += count;
+                    ctx->literalCount -= count;
+                    ctx->decodedSize += count;
+                }
+
+                if ((ctx->literalCount == 0) && (ctx->state != RRES_LZ4_ERROR)) ctx->state = RRES_LZ4_OFFSET;
+            } break;
+            case RRES_LZ4_OFFSET:
+            {
+                unsigned char offsetBytes[2] = { 0 };
+
+                // Last sequence ends after literals
+                if (!ReadResourceStreamInput(ctx, &offsetBytes[0])) { ctx->state = RRES_LZ4_END; break; }
+                if (!ReadResourceStreamInput(ctx, &offsetBytes[1])) { ctx->state = RRES_LZ4_ERROR; break; }
+
+                ctx->matchOffset = offsetBytes[0] | (offsetBytes[1] << 8);
+                ctx->matchCount = (ctx->token & 15) + 4;
+
+                if ((ctx->token & 15) == 15)
+                {
+                    do
+                    {
+                        if (!ReadResourceStreamInput(ctx, &value)) { ctx->state = RRES_LZ4_ERROR; break; }
+                        ctx->matchCount += value;
+                    } while (value == 255);
+                }
+
+                if ((ctx->matchOffset == 0) || (ctx->matchOffset > ctx->decodedSize)) ctx->state = RRES_LZ4_ERROR;
+                else if (ctx->state != RRES_LZ4_ERROR) ctx->state = RRES_LZ4_MATCH;
+            } break;
+            case RRES_LZ4_MATCH:
+            {
+                // NOTE: Match can overlap data being copied (offset < length), copied in runs of up to offset bytes,
+                // run source can still overlap its destination around window end (oldest data), so it's moved
+                while ((ctx->matchCount > 0) && (ctx->decodedSize < decodedSize))
+                {
+                    unsigned int windowPosition = ctx->decodedSize & ctx->windowMask;
+                    unsigned int matchPosition = (ctx->decodedSize - ctx->matchOffset) & ctx->windowMask;
+                    unsigned int count = ctx->matchCount;
+
+                    if (count > ctx->matchOffset) count = ctx->matchOffset;
+                    if (count > (decodedSize - ctx->decodedSize)) count = decodedSize - ctx->decodedSize;
+                    if (count > (ctx->windowMask - windowPosition)) count = ctx->windowMask - windowPosition + 1;
+                    if (count > (ctx->windowMask - matchPosition)) count = ctx->windowMask - matchPosition + 1;
+
+                    memmove(ctx->window + windowPosition, ctx->window + matchPosition, count);
+                    ctx->decodedSize += count;
+                    ctx->matchCount -= count;
+                }
+
+                if (ctx->matchCount == 0) ctx->state = RRES_LZ4_TOKEN;
+            } break;
             default: break;
         }
+    }
+}
 
-        image.mipmaps = chunk.data.props[3];
+// Read decoded data range, offset considers decoded data start (propCount + props[] + data)
+// NOTE: Data is decoded forward in steps of half window, so requested data is kept in window while copied
+static unsigned int ReadResourceStreamDecoded(rresStreamContext *ctx, unsigned int offset, unsigned char *buffer, unsigned int size)
+{
+    unsigned int bytesRead = 0;
 
-        // Image data size can be computed from image properties
-        unsigned int size = GetPixelDataSize(image.width, image.height, image.format);
+    // Data before window can not be recovered, decoding restarts from data start
+    if ((ctx->decodedSize > RRES_STREAM_WINDOW_SIZE) && (offset < (ctx->decodedSize - RRES_STREAM_WINDOW_SIZE))) ResetResourceStream(ctx);
 
-        // NOTE: Computed image data must match the data size of the chunk processed (minus propCount + props[4] size)
-        if (size == (chunk.info.baseSize - 20))
+    while (bytesRead < size)
+    {
+        unsigned int position = offset + bytesRead;
+
+        if (position < ctx->decodedSize)
+        {
+            // Copy data available in window
+            unsigned int windowPosition = position & ctx->windowMask;
+            unsigned int count = ctx->decodedSize - position;
+
+            if (count > (size - bytesRead)) count = size - bytesRead;
+            if (count > (ctx->windowMask - windowPosition)) count = ctx->windowMask - windowPosition + 1;
+
+            memcpy(buffer + bytesRead, ctx->window + windowPosition, count);
+            bytesRead += count;
+        }
+        else
         {
-            image.data = RL_CALLOC(size, 1);
-            if (image.data != NULL) memcpy(image.data, chunk.data.raw, size);
+            unsigned int decodedSize = ctx->decodedSize;
+            unsigned int target = position + (((size - bytesRead) < (RRES_STREAM_WINDOW_SIZE/2))? (size - bytesRead) : (RRES_STREAM_WINDOW_SIZE/2));
+
+            DecodeResourceStream(ctx, target);
+
+            if (ctx->decodedSize == decodedSize) break;     // Data end reached or corrupted data
         }
-        else RRES_LOG("RRES: WARNING: IMGE: Chunk data size do not match expected image data size\n");
     }
-    else RRES_LOG("RRES: %c%c%c%c: WARNING: Data must be decompressed/decrypted\n", chunk.info.type[0], chunk.info.type[1], chunk.info.type[2], chunk.info.type[3]);
 
-    return image;
+    if (ctx->state == RRES_LZ4_ERROR) RRES_LOG("RRES: WARNING: Resource stream LZ4 data could be corrupted\n");
+
+    return bytesRead;
 }
 
 // Get file extension from RRES_DATA_RAW properties (unsigned int)
@@ -9,6 +9,26 @@
 *       If not defined, the library is in header only mode and can be included in other headers
 *       or source files without problems. But only ONE file should hold the implementation
 *
+*   #define RRES_SUPPORT_MMAP
+*       Support memory mapped archives with rresOpenArchiveMapped(), chunks loaded from a mapped
+*       archive reference the mapped file data instead of copying it (zero-copy)
+*       NOTE: Enabled by default on POSIX platforms (Linux, macOS, BSD)
+*
+*   #define RRES_SUPPORT_CRC32_HW
+*       Support hardware accelerated CRC32 computation, selected at runtime if supported by the CPU:
+*       x86/x64 carry-less multiplication (PCLMULQDQ + SSE4.1) and ARMv8 CRC32 instructions,
+*       if not supported, CRC32 is computed with slicing-by-8 tables (8 bytes per step)
+*       NOTE: Enabled by default on x86/x64 (GCC, Clang, MSVC) and AArch64 (GCC, Clang)
+*
+*   #define RRES_PACK_FLUSH_SIZE
+*       Pending resource chunks data size that triggers packing and writing on rresAddPackerChunk(),
+*       it limits the memory used by the packer, chunks are packed in parallel on every flush
+*       Default value: 64 MB
+*
+*   #define RRES_MAX_LOAD_STATS
+*       Maximum load statistics entries, one entry for every (data type, compression type) loaded
+*       Default value: 64
+*
 *   FEATURES:
 *
 *     - Multi-resource files: Some files could end-up generating multiple connected resources in
@@ -79,7 +99,11 @@
 *
 *     - rres file maximum chunks: 65535 (16bit chunk count in rresFileHeader)
 *     - rres file maximum size: 4GB (chunk offset and Central Directory Offset is 32bit, so it can not address more than 4GB
-*     - Chunk search by ID is done one by one, starting at first chunk and accessed with fread() function
+*     - Chunk search by ID is done one by one, starting at first chunk and accessed with fread() function,
+*       to load multiple resources from the same file, rresOpenArchive() indexes resources once (from CDIR if available)
+*     - Resources loading from an archive is thread-safe, rresRunJobs() is provided to load multiple resources in parallel
+*     - rres files can be written with rresPacker, chunks of a multi-chunk resource must be added consecutively,
+*       chunks data compression/encryption is provided by the engine-specific library as a pack processor
 *     - Endianness: rres does not care about endianness, data is stored as desired by the host platform (most probably Little Endian)
 *       Endianness won't affect chunk data but it will affect rresFileHeader and rresResourceChunkInfo
 *     - CRC32 hash is used to to generate the rres file identifier from filename
@@ -98,9 +122,9 @@
 *
 *   rres library dependencies has been keep to the minimum. It depends only some libc functionality:
 *
-*     - stdlib.h: Required for memory allocation: malloc(), calloc(), free()
+*     - stdlib.h: Required for memory allocation: malloc(), calloc(), free(), qsort()
 *                 NOTE: Allocators can be redefined with macros RRES_MALLOC, RRES_CALLOC, RRES_FREE
-*     - stdio.h:  Required for file access functionality: FILE, fopen(), fseek(), fread(), fclose()
+*     - stdio.h:  Required for file access functionality: FILE, fopen(), fseek(), fread(), fwrite(), fclose()
 *     - string.h: Required for memory data management: memcpy(), memcmp()
 *
 *   VERSION HISTORY:
@@ -170,18 +194,27 @@
 #endif
 
 // Simple log system to avoid printf() calls if required
-// NOTE: Avoiding those calls, also avoids const strings memory usage
-#define RRES_SUPPORT_LOG_INFO
-#if defined(RRES_SUPPORT_LOG_INFO)
-    #define RRES_LOG(...) printf(__VA_ARGS__)
-#else
-    #define RRES_LOG(...)
+// NOTE: Avoiding those calls, also avoids const strings memory usage,
+// log can also be redirected or disabled defining RRES_LOG(...) before including rres.h
+#ifndef RRES_LOG
+    #define RRES_SUPPORT_LOG_INFO
+    #if defined(RRES_SUPPORT_LOG_INFO)
+        #define RRES_LOG(...) printf(__VA_ARGS__)
+    #else
+        #define RRES_LOG(...)
+    #endif
 #endif
 
 // On Windows, MAX_PATH is limited to 256 by default,
 // on Linux, it could go up to 4096
 #define RRES_MAX_FILENAME_SIZE      1024
 
+// Resource chunk data ownership flags, kept at runtime in rresResourceChunkInfo.reserved
+// NOTE: Field is <reserved> on file, it's only set for chunks loaded from a mapped archive or unpacked
+#define RRES_CHUNK_RAW_BORROWED     0x01    // Chunk data.raw points to memory not owned by the chunk (must not be freed)
+#define RRES_CHUNK_PROPS_BORROWED   0x02    // Chunk data.props points to memory not owned by the chunk (must not be freed)
+#define RRES_CHUNK_DATA_BLOCK       0x04    // Chunk data is one allocation (propCount + props[] + raw), props/raw point into it
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -228,6 +261,22 @@ typedef struct rresResourceMulti {
     rresResourceChunk *chunks;      // Resource chunks
 } rresResourceMulti;
 
+// rres archive, rres file kept open with an index of its resources
+// NOTE: Index is an open-addressing hash table mapping every resource id to
+// the global offset of its first resource chunk, linked chunks are reached with nextOffset
+typedef struct rresArchive {
+    void *file;                     // Archive file handle (FILE *), NULL if archive could not be opened
+    rresFileHeader header;          // Archive file header
+    unsigned int count;             // Indexed resources count
+    unsigned int capacity;          // Index hash table capacity (power of two)
+    unsigned int *ids;              // Index hash table: resource ids
+    unsigned int *offsets;          // Index hash table: resource first chunk global offset (0 for empty slots)
+    unsigned char *mapping;         // Archive file data mapped in memory (NULL if archive is not mapped)
+    unsigned int mappingSize;       // Archive file data mapped size
+    unsigned int verifyMode;        // Chunks data CRC32 verification on load (rresVerifyMode)
+    unsigned int id;                // Archive identifier, unique for every archive opened (0 if archive could not be opened)
+} rresArchive;
+
 // Useful data types for specific chunk types
 //----------------------------------------------------------------------
 // CDIR: rres central directory entry
@@ -239,11 +288,28 @@ typedef struct rresDirEntry {
     char fileName[RRES_MAX_FILENAME_SIZE];  // Resource original fileName (NULL terminated and padded to 4-byte alignment)
 } rresDirEntry;
 
+// CDIR: rres central directory compact entry
+// NOTE: Entry fileName is stored in central directory fileNames arena
+typedef struct rresDirEntryCompact {
+    unsigned int id;                // Resource id
+    unsigned int offset;            // Resource global offset in file
+    unsigned int nameOffset;        // Resource fileName offset in fileNames arena
+    unsigned int nameLength;        // Resource fileName length (NULL terminator not considered)
+} rresDirEntryCompact;
+
 // CDIR: rres central directory
-// NOTE: This data conforms the rresResourceChunkData
+// NOTE 1: This data conforms the rresResourceChunkData
+// NOTE 2: Loaded central directory keeps a hash table of entries by exact fileName (CRC32),
+// if table is not available (capacity = 0), entries are searched one by one
+// NOTE 3: Compact central directory stores fileNames in one arena and entries sorted by fileName
+// (binary search), entries and table are not used (NULL), memory scales with fileNames length
 typedef struct rresCentralDir {
     unsigned int count;             // Central directory entries count
     rresDirEntry *entries;          // Central directory entries
+    unsigned int capacity;          // Lookup hash table capacity (power of two)
+    unsigned int *table;            // Lookup hash table: entry index + 1 (0 for empty slots)
+    rresDirEntryCompact *compactEntries; // Central directory compact entries, sorted by fileName (compact mode)
+    char *names;                    // Central directory fileNames arena, NULL terminated (compact mode)
 } rresCentralDir;
 
 // FNTG: rres font glyphs info (32 bytes)
@@ -259,6 +325,68 @@ typedef struct rresFontGlyphInfo {
     int advanceX;                   // Glyph advance X for next character
 } rresFontGlyphInfo;
 
+// rres load statistics, accumulated by (data type, compression type)
+// NOTE: Chunk data operations are accounted by chunk data type, file level operations
+// (file open, seeks, file header/chunk info/central directory reads) are accounted as RRES_DATA_NULL
+typedef struct rresLoadStats {
+    unsigned int dataType;          // Resource data type (rresResourceDataType)
+    unsigned int compType;          // Resource compression type (rresCompressionType)
+    unsigned int chunkCount;        // Resource chunks loaded
+    unsigned int fileOpens;         // Files opened
+    unsigned int fileSeeks;         // File seeks (positioned reads)
+    unsigned long long bytesRead;   // Bytes read from file (or mapped memory)
+    unsigned long long bytesAllocated; // Bytes allocated
+    unsigned long long bytesCopied; // Bytes copied between memory buffers
+    double crcTime;                 // CRC32 verification time (seconds)
+    double kdfTime;                 // Key derivation time (seconds)
+    double decryptTime;             // Data decryption time (seconds)
+    double decompressTime;          // Data decompression time (seconds)
+} rresLoadStats;
+
+// Callback to be notified when cipher password changes
+// NOTE: Useful for engine libraries to wipe data derived from password (i.e. cached keys)
+typedef void (*rresCipherPasswordCallback)(const char *pass);
+
+// Callback to run one job, index is the job index in [0..jobCount)
+// NOTE: Useful for engine libraries to load multiple resources in parallel
+typedef void (*rresJobCallback)(void *userData, unsigned int index);
+
+// Callback to process resource chunks on loading thread, once loaded
+// NOTE: Useful for engine libraries to unpack (decompress/decrypt) data out of the main thread,
+// it should return 0 on success or an error code on failure
+typedef int (*rresLoadProcessor)(rresResourceMulti *multi);
+
+// Callback to pack resource chunks on packer worker threads, before writing
+// NOTE: Chunk data is provided unpacked as one block (propCount + props[] + raw), chunk.info.compType and
+// chunk.info.cipherType set the algorithms requested; packed data must be assigned to chunk.data.raw
+// (RRES_MALLOC) with chunk.info.packedSize updated, it should return 0 on success or an error code on failure
+typedef int (*rresPackProcessor)(rresResourceChunk *chunk);
+
+// rres packer, rres file being written
+// NOTE 1: Added chunks are kept pending until flushed, then they are packed in parallel and written in order,
+// chunks of the same resource (fileName) must be added consecutively to be linked (nextOffset),
+// last added chunk is only written once next chunk is added or packer is closed (it could be linked)
+// NOTE 2: Central directory entries are generated on adding (compact mode), entry offset is assigned on writing
+typedef struct rresPacker {
+    void *file;                     // Packer file handle (FILE *), NULL if file could not be created
+    unsigned int offset;            // Next resource chunk global offset in file
+    unsigned int chunkCount;        // Written resource chunks count
+    unsigned int addedId;           // Last added resource chunk id
+    unsigned int writtenId;         // Last written resource chunk id
+    unsigned int pendingCount;      // Pending resource chunks count (added, not written)
+    unsigned int pendingCapacity;   // Pending resource chunks capacity
+    unsigned int pendingSize;       // Pending resource chunks data size
+    rresResourceChunk *pending;     // Pending resource chunks, data owned by packer
+    rresCentralDir dir;             // Central directory generated (compact mode, entries in adding order)
+    unsigned int dirWritten;        // Central directory entries with offset assigned
+    unsigned int dirCapacity;       // Central directory entries capacity
+    unsigned int namesSize;         // Central directory fileNames arena size
+    unsigned int namesCapacity;     // Central directory fileNames arena capacity
+    rresPackProcessor processor;    // Callback to pack chunks data (NULL: chunks can not be compressed/encrypted)
+    unsigned int threadCount;       // Threads used to pack chunks (0: processors count)
+    int result;                     // Packer result (rresErrorType), chunks are not written after an error
+} rresPacker;
+
 //----------------------------------------------------------------------------------
 // Enums Definition
 // The following enums are useful to fill some fields of the rresResourceChunkInfo
@@ -373,15 +501,24 @@ typedef enum rresEncryptionType {
     // TODO: Add additional encryption algorithm if required
 } rresEncryptionType;
 
-// TODO: rres error codes (not used at this moment)
-// NOTE: Error codes when processing rres files
+// rres error codes
+// NOTE: Error codes when processing rres files, only returned by packer and stats export functions at this moment
 typedef enum rresErrorType {
     RRES_SUCCESS = 0,                       // rres file loaded/saved successfully
     RRES_ERROR_FILE_NOT_FOUND,              // rres file can not be opened (spelling issues, file actually does not exist...)
     RRES_ERROR_FILE_FORMAT,                 // rres file format not a supported (wrong header, wrong identifier)
     RRES_ERROR_MEMORY_ALLOC,                // Memory could not be allocated for operation
+    RRES_ERROR_FILE_WRITE,                  // rres file can not be written (disk full, file size limit: 4 GB)
+    RRES_ERROR_PACK_DATA,                   // Resource chunk data can not be packed (compression/encryption failed)
 } rresErrorType;
 
+// Archive chunks data verification mode
+// NOTE: Trusted archives (i.e. already verified with rresVerifyArchive()) can skip CRC32 verification on load
+typedef enum rresVerifyMode {
+    RRES_VERIFY_ALWAYS = 0,                 // Verify chunk data CRC32 on every load (default)
+    RRES_VERIFY_NEVER,                      // Skip chunk data CRC32 verification on load
+} rresVerifyMode;
+
 // Enums required by specific resource types for its properties
 //----------------------------------------------------------------------------------
 // TEXT: Text encoding property values
@@ -503,12 +640,64 @@ RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, un
 RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName, unsigned int *chunkCount); // Load all resource chunks info
 
 RRESAPI rresCentralDir rresLoadCentralDirectory(const char *fileName);              // Load central directory resource chunk from file
+RRESAPI rresCentralDir rresLoadCentralDirectoryCompact(const char *fileName);       // Load central directory resource chunk from file (compact mode)
 RRESAPI void rresUnloadCentralDirectory(rresCentralDir dir);                        // Unload central directory resource chunk
+RRESAPI unsigned int rresGetDirEntryId(rresCentralDir dir, unsigned int index);     // Get central directory entry resource id (0 if index not valid)
+RRESAPI const char *rresGetDirEntryFileName(rresCentralDir dir, unsigned int index); // Get central directory entry fileName, not copied (NULL if index not valid)
+
+// Load resource(s) from an opened rres archive
+// NOTE: Archive reads header and central directory once and indexes resources by id,
+// if central directory is not available, resource chunks are indexed with one linear scan
+RRESAPI rresArchive rresOpenArchive(const char *fileName);                          // Open rres file and index its resources (file is kept open)
+RRESAPI rresArchive rresOpenArchiveMapped(const char *fileName);                    // Open rres file mapped in memory, chunks loaded reference file data (zero-copy)
+RRESAPI void rresCloseArchive(rresArchive archive);                                 // Close rres file and unload resources index
+RRESAPI rresResourceChunk rresLoadResourceChunkFromArchive(rresArchive archive, unsigned int rresId);  // Load one resource chunk for provided id
+RRESAPI rresResourceMulti rresLoadResourceMultiFromArchive(rresArchive archive, unsigned int rresId);  // Load resource for provided id (multiple resource chunks)
+RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfoFromArchive(rresArchive archive, unsigned int rresId); // Load resource chunk info for provided id
+RRESAPI void rresSetArchiveVerifyMode(rresArchive *archive, int mode);              // Set archive chunks data CRC32 verification on load (rresVerifyMode)
+RRESAPI int rresVerifyArchive(rresArchive archive);                                 // Verify all archive chunks data CRC32, returns corrupted chunks count
+RRESAPI unsigned int rresGetResourceOffset(rresArchive archive, unsigned int rresId); // Get resource first chunk global offset in archive (0 if not found)
+RRESAPI int rresReadArchiveData(rresArchive archive, unsigned int offset, void *data, unsigned int size); // Read archive data at global offset (thread-safe), returns 1 on success
+
+// Run jobs concurrently on worker threads
+// NOTE: Archive resources can be loaded from multiple threads, archive file reads do not share the file position
+RRESAPI void rresRunJobs(rresJobCallback job, void *userData, unsigned int jobCount, unsigned int threadCount); // Run jobs on threads (threadCount 0: processors count), returns when all jobs are done
+
+// Load resources asynchronously from an opened archive on a background loading thread
+// NOTE: Requests return a ticket immediately (0 on failure) and higher priority requests are loaded first,
+// archive must be kept open until requested resources are taken or canceled
+RRESAPI unsigned int rresRequestLoad(rresArchive archive, unsigned int rresId, int priority); // Request resource load (multiple resource chunks), returns load ticket
+RRESAPI int rresIsLoadReady(unsigned int ticket);                                   // Check if requested resource has been loaded (1) or not yet (0)
+RRESAPI rresResourceMulti rresTakeResult(unsigned int ticket);                      // Take loaded resource and release ticket (empty if not ready)
+RRESAPI int rresCancelLoad(unsigned int ticket);                                    // Cancel load request and release ticket, returns 1 if ticket was valid
+RRESAPI void rresSetLoadProcessor(rresLoadProcessor processor);                     // Set callback to process loaded resources on loading thread
+RRESAPI void rresStopLoads(void);                                                   // Stop loading thread, pending requests are canceled and resources not taken unloaded
+
+// Pack resources into a new rres file
+// NOTE: Chunks data is copied on adding, pending chunks are packed (compressed/encrypted) by the pack processor
+// on worker threads and written once pending data reaches RRES_PACK_FLUSH_SIZE, on flush or on close
+RRESAPI rresPacker rresOpenPacker(const char *fileName);                            // Create rres file to pack resources (file is kept open)
+RRESAPI unsigned int rresAddPackerChunk(rresPacker *packer, const char *fileName, int type, const unsigned int *props, unsigned int propCount, const void *data, unsigned int size, int compType, int cipherType); // Add resource chunk, returns resource id (0 on failure)
+RRESAPI int rresFlushPacker(rresPacker *packer);                                    // Pack pending chunks in parallel and write them, returns rresErrorType
+RRESAPI int rresClosePacker(rresPacker *packer);                                    // Write pending chunks, central directory and file header, returns rresErrorType
+RRESAPI void rresSetPackProcessor(rresPacker *packer, rresPackProcessor processor, unsigned int threadCount); // Set callback to pack chunks data and threads used (0: processors count)
+
+// Record load statistics: file accesses, bytes read/allocated/copied and time spent by load stage
+// NOTE: Statistics are disabled by default, when enabled load functions measure time and lock on every chunk,
+// engine libraries record unpacking stages (key derivation, decryption, decompression) with rresAddLoadStats()
+RRESAPI void rresEnableLoadStats(int enable);                                       // Enable/disable load statistics recording (disabled by default)
+RRESAPI int rresIsLoadStatsEnabled(void);                                           // Check if load statistics recording is enabled
+RRESAPI void rresAddLoadStats(rresLoadStats stats);                                 // Add load statistics to (stats.dataType, stats.compType) entry
+RRESAPI rresLoadStats rresGetLoadStats(int dataType, int compType);                 // Get load statistics for data type and compression type (-1: any)
+RRESAPI void rresResetLoadStats(void);                                              // Reset load statistics
+RRESAPI int rresExportLoadStats(const char *fileName);                              // Export load statistics entries as JSON (.json) or CSV (.csv), returns rresErrorType
+RRESAPI double rresGetLoadStatsTime(void);                                          // Get monotonic time in seconds, used to measure load stages
 
 RRESAPI unsigned int rresGetDataType(const unsigned char *fourCC);                  // Get rresResourceDataType from FourCC code
-RRESAPI unsigned int rresGetResourceId(rresCentralDir dir, const char *fileName);            // Get resource id for a provided filename
+RRESAPI unsigned int rresGetResourceId(rresCentralDir dir, const char *fileName);            // Get resource id for a provided filename (exact match)
                                                                                     // NOTE: It requires CDIR available in the file (it's optinal by design)
 RRESAPI unsigned int rresComputeCRC32(const unsigned char *data, int len);          // Compute CRC32 for provided data
+RRESAPI unsigned int rresUpdateCRC32(unsigned int crc, const unsigned char *data, int len); // Update CRC32 with next data block (crc: previous result, 0 for first block)
 
 // Manage password for data encryption/decryption
 // NOTE: The cipher password is kept as an internal pointer to provided string, it's up to the user to manage that sensible data properly
@@ -516,6 +705,8 @@ RRESAPI unsigned int rresComputeCRC32(const unsigned char *data, int len);
 // TODO: Move this functionality to engine-library, after all rres.h does not manage data decryption
 RRESAPI void rresSetCipherPassword(const char *pass);                 // Set password to be used on data decryption
 RRESAPI const char *rresGetCipherPassword(void);                      // Get password to be used on data decryption
+RRESAPI void rresSetCipherPasswordCallback(rresCipherPasswordCallback callback); // Set callback to be notified on password change
+RRESAPI rresCipherPasswordCallback rresGetCipherPasswordCallback(void); // Get callback notified on password change
 
 #ifdef __cplusplus
 }
@@ -539,30 +730,242 @@ RRESAPI const char *rresGetCipherPassword(void);                      // Get pas
     #define RL_BOOL_TYPE
 #endif
 
-#include <stdlib.h>                 // Required for: malloc(), calloc(), free()
-#include <stdio.h>                  // Required for: FILE, fopen(), fseek(), fread(), fclose()
+#include <stdlib.h>                 // Required for: malloc(), calloc(), free(), qsort()
+#include <stdio.h>                  // Required for: FILE, fopen(), fseek(), fread(), fwrite(), fclose()
 #include <string.h>                 // Required for: memcpy(), memcmp()
 
+#if !defined(RRES_SUPPORT_MMAP) && (defined(__linux__) || defined(__APPLE__) || defined(__unix__))
+    #define RRES_SUPPORT_MMAP
+#endif
+#if defined(RRES_SUPPORT_MMAP)
+    #include <sys/mman.h>           // Required for: mmap(), munmap()
+    #include <sys/stat.h>           // Required for: fstat()
+#endif
+
+#if defined(_WIN32)
+    #include <process.h>            // Required for: _beginthreadex()
+
+    // NOTE: Win32 threading functions are declared here, windows.h is not included to avoid conflicts with raylib.h,
+    // declarations use the exact windows.h types (HANDLE: void *, DWORD/ULONG: unsigned long, BOOL: int, WORD: unsigned short,
+    // SRWLOCK, CONDITION_VARIABLE and LARGE_INTEGER by tag) so windows.h can also be included before or after this file
+    #if !defined(_WINDOWS_)
+        struct _RTL_SRWLOCK;
+        struct _RTL_CONDITION_VARIABLE;
+        union _LARGE_INTEGER;
+
+        __declspec(dllimport) void __stdcall InitializeSRWLock(struct _RTL_SRWLOCK *SRWLock);
+        __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(struct _RTL_SRWLOCK *SRWLock);
+        __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(struct _RTL_SRWLOCK *SRWLock);
+        __declspec(dllimport) int __stdcall SleepConditionVariableSRW(struct _RTL_CONDITION_VARIABLE *ConditionVariable, struct _RTL_SRWLOCK *SRWLock, unsigned long dwMilliseconds, unsigned long Flags);
+        __declspec(dllimport) void __stdcall WakeConditionVariable(struct _RTL_CONDITION_VARIABLE *ConditionVariable);
+        __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *hHandle, unsigned long dwMilliseconds);
+        __declspec(dllimport) int __stdcall CloseHandle(void *hObject);
+        __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short GroupNumber);
+        __declspec(dllimport) int __stdcall QueryPerformanceCounter(union _LARGE_INTEGER *lpPerformanceCount);
+        __declspec(dllimport) int __stdcall QueryPerformanceFrequency(union _LARGE_INTEGER *lpFrequency);
+    #endif
+#else
+    #include <pthread.h>            // Required for: pthread_create(), pthread_join(), pthread_mutex_lock()
+    #include <unistd.h>             // Required for: pread(), sysconf()
+    #include <time.h>               // Required for: clock_gettime()
+#endif
+
+#if !defined(RRES_SUPPORT_CRC32_HW) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86) || \
+    (defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))))
+    #define RRES_SUPPORT_CRC32_HW
+#endif
+#if defined(RRES_SUPPORT_CRC32_HW)
+    #if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        #define RRES_CRC32_CLMUL
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+        #include <smmintrin.h>      // Required for: _mm_extract_epi32()
+        #include <wmmintrin.h>      // Required for: _mm_clmulepi64_si128()
+        #if defined(_MSC_VER)
+            #include <intrin.h>     // Required for: __cpuid()
+        #else
+            #include <cpuid.h>      // Required for: __get_cpuid()
+        #endif
+    #elif defined(__aarch64__)
+        #define RRES_CRC32_ARMV8
+        #include <arm_acle.h>       // Required for: __crc32b(), __crc32d()
+        #include <stdint.h>         // Required for: uint64_t
+        #if defined(__linux__)
+            #include <sys/auxv.h>   // Required for: getauxval()
+        #endif
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-//...
+#define RRES_MAX_JOB_THREADS          64      // Maximum number of threads running jobs
+#define RRES_MAX_LOAD_REQUESTS     65535      // Maximum async load requests in flight (ticket: generation[16] + slot[16])
+
+#ifndef RRES_PACK_FLUSH_SIZE
+    #define RRES_PACK_FLUSH_SIZE   (64*1024*1024)  // Pending chunks data size to pack and write (bytes)
+#endif
+#ifndef RRES_MAX_LOAD_STATS
+    #define RRES_MAX_LOAD_STATS        64      // Maximum load statistics entries (data type, compression type)
+#endif
+#define RRES_CHUNK_PACKED           0x40      // Pending chunk data already packed, kept in rresResourceChunkInfo.reserved
+#define RRES_CHUNK_PACK_FAILED      0x80      // Pending chunk data could not be packed, kept in rresResourceChunkInfo.reserved
+
+// CRC32 computation engines, selected at runtime
+#define RRES_CRC32_ENGINE_TABLE         0      // Slicing-by-8 tables
+#define RRES_CRC32_ENGINE_CLMUL         1      // x86 carry-less multiplication folding (PCLMULQDQ)
+#define RRES_CRC32_ENGINE_ARMV8         2      // ARMv8 CRC32 instructions
+
+#if defined(RRES_CRC32_CLMUL) && !defined(_MSC_VER)
+    #define RRES_CRC32_TARGET __attribute__((target("sse4.1,pclmul")))
+#elif defined(RRES_CRC32_ARMV8) && defined(__clang__)
+    #define RRES_CRC32_TARGET __attribute__((target("crc")))
+#elif defined(RRES_CRC32_ARMV8)
+    #define RRES_CRC32_TARGET __attribute__((target("+crc")))
+#else
+    #define RRES_CRC32_TARGET
+#endif
+
+#if defined(_WIN32)
+    #define RRES_THREAD_PROC(name)    static unsigned int __stdcall name(void *arg)
+    #define RRES_MUTEX_INITIALIZER    { 0 }
+    #define RRES_CONDITION_INITIALIZER { 0 }
+#else
+    #define RRES_THREAD_PROC(name)    static void *name(void *arg)
+    #define RRES_MUTEX_INITIALIZER    PTHREAD_MUTEX_INITIALIZER
+    #define RRES_CONDITION_INITIALIZER PTHREAD_COND_INITIALIZER
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(_WIN32)
+typedef struct rresMutex { void *lock; } rresMutex;     // Win32 SRWLOCK
+typedef struct rresCondition { void *cond; } rresCondition;  // Win32 CONDITION_VARIABLE
+typedef void *rresThread;                               // Win32 thread HANDLE
+typedef unsigned int (__stdcall *rresThreadProc)(void *arg);
+#else
+typedef pthread_mutex_t rresMutex;
+typedef pthread_cond_t rresCondition;
+typedef pthread_t rresThread;
+typedef void *(*rresThreadProc)(void *arg);
+#endif
+
+// Jobs queue, shared by all threads running jobs
+typedef struct rresJobQueue {
+    rresJobCallback job;            // Job callback
+    void *userData;                 // Job callback user data
+    unsigned int count;             // Jobs count
+    unsigned int next;              // Next job index to run
+    rresMutex lock;                 // Queue lock
+} rresJobQueue;
+
+// Async load request state
+typedef enum rresLoadState {
+    RRES_LOAD_FREE = 0,             // Request slot is free
+    RRES_LOAD_PENDING,              // Request waiting to be loaded
+    RRES_LOAD_LOADING,              // Request being loaded by loading thread
+    RRES_LOAD_READY,                // Request loaded, waiting to be taken
+    RRES_LOAD_CANCELED              // Request canceled while loading, released once loaded
+} rresLoadState;
+
+// Async load request
+typedef struct rresLoadRequest {
+    rresArchive archive;            // Archive to load resource from
+    unsigned int rresId;            // Resource id to load
+    int priority;                   // Request priority, higher priority requests are loaded first
+    unsigned int serial;            // Request order, requests with same priority are loaded in order
+    unsigned short generation;      // Slot generation, invalidates tickets of released requests
+    unsigned char state;            // Request state (rresLoadState)
+    rresResourceMulti result;       // Loaded resource
+} rresLoadRequest;
+
+// Async load queue, shared by user threads and loading thread
+typedef struct rresLoadQueue {
+    rresLoadRequest *requests;      // Requests slots
+    unsigned int capacity;          // Requests slots capacity
+    unsigned int serial;            // Next request serial
+    rresLoadProcessor processor;    // Loaded resources processor, run on loading thread
+    rresThread thread;              // Loading thread
+    bool running;                   // Loading thread is running
+    bool stop;                      // Loading thread stop requested
+} rresLoadQueue;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
 static const char *password = NULL;     // Password pointer, managed by user libraries
+static rresCipherPasswordCallback passwordCallback = NULL;  // Password change callback, set by user libraries
+
+#if defined(_WIN32)
+static rresMutex archiveReadLock = RRES_MUTEX_INITIALIZER;  // Archive file reads lock, file position is shared between threads
+#endif
+
+static rresLoadQueue loadQueue = { 0 };     // Async load queue
+
+static unsigned int archiveCounter = 0;                     // Archives opened counter, used as archive identifier
+static rresMutex archiveLock = RRES_MUTEX_INITIALIZER;      // Archives opened counter lock
+
+static unsigned int crc32Tables[8][256] = { 0 };            // CRC32 slicing-by-8 tables, generated on first use
+static volatile int crc32Engine = -1;                       // CRC32 engine in use (-1 if not initialized yet)
+static rresMutex crc32Lock = RRES_MUTEX_INITIALIZER;        // CRC32 initialization lock
+static rresMutex loadLock = RRES_MUTEX_INITIALIZER;         // Async load queue lock
+static rresCondition loadSignal = RRES_CONDITION_INITIALIZER; // Async load queue signal, new requests or stop
+
+static rresLoadStats loadStats[RRES_MAX_LOAD_STATS] = { 0 };  // Load statistics entries, by (data type, compression type)
+static unsigned int loadStatsCount = 0;                     // Load statistics entries count
+static volatile int loadStatsEnabled = 0;                   // Load statistics recording enabled
+static rresMutex loadStatsLock = RRES_MUTEX_INITIALIZER;    // Load statistics lock
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 // Load resource chunk packed data into our data struct
-static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *packedData);
+// NOTE: Chunk data load statistics are recorded (read, CRC32, allocations and copies)
+static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *packedData, bool verify);
+static void rresAddFileStats(unsigned int fileOpens, unsigned int fileSeeks, unsigned int bytesRead); // Add file level load statistics (RRES_DATA_NULL)
+
+// CRC32 computation, crc is the CRC32 register (not inverted)
+static void rresInitCRC32(void);                            // Init CRC32 tables and select engine supported by CPU
+static unsigned int rresComputeCRC32Table(unsigned int crc, const unsigned char *data, unsigned int len); // Compute CRC32 using slicing-by-8 tables
+#if defined(RRES_CRC32_CLMUL)
+static unsigned int rresComputeCRC32Clmul(unsigned int crc, const unsigned char *data, unsigned int len); // Compute CRC32 using PCLMULQDQ folding (len >= 64, multiple of 16)
+#endif
+#if defined(RRES_CRC32_ARMV8)
+static unsigned int rresComputeCRC32Armv8(unsigned int crc, const unsigned char *data, unsigned int len); // Compute CRC32 using ARMv8 CRC32 instructions
+#endif
+
+// Central directory lookup hash table
+static void rresIndexCentralDirectory(rresCentralDir *dir);   // Generate central directory lookup hash table (by fileName CRC32)
+static int rresCompareFileNames(const void *a, const void *b);  // Compare fileNames for sorting, qsort() callback
+
+// Archive index management
+static void rresIndexArchiveResource(rresArchive *archive, unsigned int rresId, unsigned int offset);  // Add resource first chunk offset to archive index
+static unsigned int rresFindArchiveResource(rresArchive archive, unsigned int rresId);      // Get resource first chunk offset from archive index (0 if not found)
+static rresResourceChunk rresLoadArchiveChunk(rresArchive archive, unsigned int offset);    // Load resource chunk at provided global offset
+static rresResourceChunkInfo rresLoadArchiveChunkInfo(rresArchive archive, unsigned int offset); // Load resource chunk info at provided global offset
+static bool rresReadArchive(rresArchive archive, unsigned int offset, void *data, unsigned int size); // Read archive data at provided global offset (thread-safe)
+
+// Threading support
+static void rresInitMutex(rresMutex *mutex);                // Init mutex
+static void rresDestroyMutex(rresMutex *mutex);             // Destroy mutex
+static void rresLockMutex(rresMutex *mutex);                // Lock mutex
+static void rresUnlockMutex(rresMutex *mutex);              // Unlock mutex
+static bool rresCreateThread(rresThread *thread, rresThreadProc proc, void *arg); // Create thread running proc(arg)
+static void rresJoinThread(rresThread thread);              // Wait for thread to finish
+static unsigned int rresGetProcessorCount(void);            // Get logical processors count
+static void rresWaitCondition(rresCondition *cond, rresMutex *mutex); // Wait for condition signal (mutex locked)
+static void rresSignalCondition(rresCondition *cond);       // Signal condition, wakes one waiting thread
+RRES_THREAD_PROC(rresJobWorker);                            // Job worker thread: runs jobs from queue until empty
+
+// Async loading
+static rresLoadRequest *rresGetLoadRequest(unsigned int ticket);    // Get load request for ticket (NULL if ticket not valid), queue must be locked
+static void rresReleaseLoadRequest(rresLoadRequest *request);       // Release load request slot, invalidates its ticket
+RRES_THREAD_PROC(rresLoadWorker);                                   // Loading thread: loads pending requests by priority
+
+// Packing
+static void rresGetFourCC(unsigned int type, unsigned char *fourCC);            // Get FourCC code from rresResourceDataType
+static void rresPackJob(void *userData, unsigned int index);                    // Pack one pending chunk and compute its CRC32
+static int rresWritePackerChunks(rresPacker *packer, bool all);                 // Pack pending chunks in parallel and write them (last one kept if not all)
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -583,6 +986,7 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 
         // Read rres file header
         fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        rresAddFileStats(1, 0, sizeof(rresFileHeader));
 
         // Verify file signature: "rres" and file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
@@ -596,6 +1000,7 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 
                 // Read resource info header
                 fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                info.reserved = 0;      // Field used at runtime for chunk data ownership flags
 
                 // Check if resource id is the requested one
                 if (info.id == rresId)
@@ -632,7 +1037,7 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
                     fread(data, info.packedSize, 1, rresFile);    // Read data: propsCount + props[] + data (+additional_data)
 
                     // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                    chunk.data = rresLoadResourceChunkData(info, data);
+                    chunk.data = rresLoadResourceChunkData(info, data, true);
                     chunk.info = info;
 
                     RRES_FREE(data);
@@ -657,10 +1062,19 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, unsigned int rresI
 }
 
 // Unload resource chunk from memory
+// NOTE: Chunks loaded from mapped archives or unpacked into user buffers reference memory they do not own
 void rresUnloadResourceChunk(rresResourceChunk chunk)
 {
-    RRES_FREE(chunk.data.props);  // Resource chunk properties
-    RRES_FREE(chunk.data.raw);    // Resource chunk raw data
+    if (chunk.info.reserved & RRES_CHUNK_DATA_BLOCK)
+    {
+        // Resource chunk data block, starts with propCount, before props[] and raw data
+        RRES_FREE((unsigned char *)chunk.data.raw - sizeof(int) - chunk.data.propCount*sizeof(int));
+    }
+    else
+    {
+        if ((chunk.info.reserved & RRES_CHUNK_PROPS_BORROWED) == 0) RRES_FREE(chunk.data.props);  // Resource chunk properties
+        if ((chunk.info.reserved & RRES_CHUNK_RAW_BORROWED) == 0) RRES_FREE(chunk.data.raw);      // Resource chunk raw data
+    }
 }
 
 // Load resource from file by id
@@ -678,6 +1092,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
 
         // Read rres file header
         fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        rresAddFileStats(1, 0, sizeof(rresFileHeader));
 
         // Verify file signature: "rres" and file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
@@ -691,6 +1106,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
 
                 // Read resource info header
                 fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                info.reserved = 0;      // Field used at runtime for chunk data ownership flags
 
                 // Check if resource id is the requested one
                 if (info.id == rresId)
@@ -723,7 +1139,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                     fread(data, info.packedSize, 1, rresFile);              // Read data: propsCount + props[] + data (+additional_data)
 
                     // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                    rres.chunks[0].data = rresLoadResourceChunkData(info, data);
+                    rres.chunks[0].data = rresLoadResourceChunkData(info, data, true);
                     rres.chunks[0].info = info;
 
                     RRES_FREE(data);
@@ -735,6 +1151,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                     {
                         fseek(rresFile, info.nextOffset, SEEK_SET);         // Jump to next resource chunk
                         fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read next resource info header
+                        info.reserved = 0;      // Field used at runtime for chunk data ownership flags
 
                         RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
 
@@ -742,7 +1159,7 @@ rresResourceMulti rresLoadResourceMulti(const char *fileName, unsigned int rresI
                         fread(data, info.packedSize, 1, rresFile);          // Read data: propsCount + props[] + data (+additional_data)
 
                         // Get chunk.data properly organized (only if uncompressed/unencrypted)
-                        rres.chunks[i].data = rresLoadResourceChunkData(info, data);
+                        rres.chunks[i].data = rresLoadResourceChunkData(info, data, true);
                         rres.chunks[i].info = info;
 
                         RRES_FREE(data);
@@ -798,6 +1215,7 @@ RRESAPI rresResourceChunkInfo rresLoadResourceChunkInfo(const char *fileName, un
             {
                 // Read resource chunk info
                 fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+                info.reserved = 0;      // Field used at runtime for chunk data ownership flags
 
                 if (info.id == rresId)
                 {
@@ -841,6 +1259,7 @@ RRESAPI rresResourceChunkInfo *rresLoadResourceChunkInfoAll(const char *fileName
             for (unsigned int i = 0; i < count; i++)
             {
                 fread(&infos[i], sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource chunk info
+                infos[i].reserved = 0;      // Field used at runtime for chunk data ownership flags
 
                 if (infos[i].nextOffset > 0) fseek(rresFile, infos[i].nextOffset, SEEK_SET); // Jump to next resource
                 else fseek(rresFile, infos[i].packedSize, SEEK_CUR); // Jump to next resource
@@ -867,6 +1286,7 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
         rresFileHeader header = { 0 };
 
         fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        rresAddFileStats(1, 0, sizeof(rresFileHeader));
 
         // Verify file signature: "rres", file version: 100
         if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
@@ -889,7 +1309,9 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
                     fread(data, info.packedSize, 1, rresFile);
 
                     // Load resource chunk data (central directory), data is uncompressed/unencrypted by default
-                    rresResourceChunkData chunkData = rresLoadResourceChunkData(info, data);
+                    // NOTE: Central directory data load is accounted as RRES_DATA_DIRECTORY chunk
+                    rresAddFileStats(0, 1, sizeof(rresResourceChunkInfo));
+                    rresResourceChunkData chunkData = rresLoadResourceChunkData(info, data, true);
                     RRES_FREE(data);
 
                     dir.count = chunkData.props[0];     // File entries count
@@ -915,6 +1337,110 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
 
                     RRES_FREE(chunkData.props);
                     RRES_FREE(chunkData.raw);
+
+                    rresIndexCentralDirectory(&dir);
+                }
+            }
+        }
+        else RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+
+        fclose(rresFile);
+    }
+
+    return dir;
+}
+
+// Load central directory resource chunk from file (compact mode)
+// NOTE: Central directory data is parsed in a single pass, fileNames are copied to one arena
+// and entries are sorted by fileName, no fixed-size fileName is allocated per entry
+rresCentralDir rresLoadCentralDirectoryCompact(const char *fileName)
+{
+    rresCentralDir dir = { 0 };
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile != NULL)
+    {
+        rresFileHeader header = { 0 };
+
+        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+        rresAddFileStats(1, 0, sizeof(rresFileHeader));
+
+        // Verify file signature: "rres", file version: 100
+        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        {
+            // Check if there is a Central Directory available
+            if (header.cdOffset == 0) RRES_LOG("RRES: WARNING: CDIR: No central directory found\n");
+            else
+            {
+                rresResourceChunkInfo info = { 0 };
+
+                fseek(rresFile, header.cdOffset, SEEK_CUR); // Move to central directory position
+                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile); // Read resource info
+
+                // Verify resource type is CDIR
+                if ((info.type[0] == 'C') && (info.type[1] == 'D') && (info.type[2] == 'I') && (info.type[3] == 'R') && (info.packedSize >= 8))
+                {
+                    RRES_LOG("RRES: CDIR: Central Directory found at offset: 0x%08x\n", header.cdOffset);
+
+                    // NOTE: Data is NULL terminated, so last fileName is always terminated
+                    unsigned char *data = (unsigned char *)RRES_CALLOC(info.packedSize + 1, 1);
+                    fread(data, info.packedSize, 1, rresFile);
+
+                    rresAddFileStats(0, 1, sizeof(rresResourceChunkInfo) + info.packedSize);
+
+                    if (rresComputeCRC32(data, info.packedSize) != info.crc32) RRES_LOG("RRES: WARNING: CDIR: CRC32 does not match, Central Directory can not be used\n");
+                    else
+                    {
+                        // CDIR data: propCount + props[0]:entryCount + rresDirEntry[0..entryCount]
+                        unsigned int propCount = ((unsigned int *)data)[0];
+                        unsigned int entryCount = ((unsigned int *)data)[1];
+                        unsigned int position = sizeof(int) + propCount*sizeof(int);
+
+                        // Get entries fileNames (referencing data) and required arena size
+                        const char **names = (const char **)RRES_MALLOC(((entryCount > 0)? entryCount : 1)*sizeof(const char *));
+                        unsigned int namesSize = 0;
+
+                        while ((dir.count < entryCount) && ((unsigned long long)position + 16 <= info.packedSize))
+                        {
+                            unsigned int fileNameSize = ((unsigned int *)(data + position))[3];
+
+                            if (((unsigned long long)position + 16 + fileNameSize) > info.packedSize) break;
+
+                            names[dir.count] = (const char *)(data + position + 16);
+                            namesSize += (unsigned int)strlen(names[dir.count]) + 1;
+                            dir.count++;
+
+                            position += (16 + fileNameSize);
+                        }
+
+                        qsort(names, dir.count, sizeof(const char *), rresCompareFileNames);
+
+                        // Fill compact entries and fileNames arena in fileName order
+                        // NOTE: Entry data (id, offset, reserved, fileNameSize) is placed just before fileName
+                        dir.compactEntries = (rresDirEntryCompact *)RRES_CALLOC((dir.count > 0)? dir.count : 1, sizeof(rresDirEntryCompact));
+                        dir.names = (char *)RRES_MALLOC((namesSize > 0)? namesSize : 1);
+
+                        for (unsigned int i = 0, nameOffset = 0; i < dir.count; i++)
+                        {
+                            const unsigned char *entry = (const unsigned char *)names[i] - 16;
+                            unsigned int length = (unsigned int)strlen(names[i]);
+
+                            memcpy(&dir.compactEntries[i].id, entry, sizeof(int));
+                            memcpy(&dir.compactEntries[i].offset, entry + 4, sizeof(int));
+                            dir.compactEntries[i].nameOffset = nameOffset;
+                            dir.compactEntries[i].nameLength = length;
+
+                            memcpy(dir.names + nameOffset, names[i], length + 1);
+                            nameOffset += (length + 1);
+                        }
+
+                        RRES_FREE(names);
+
+                        RRES_LOG("RRES: CDIR: Central Directory file entries count: %i (compact: %i bytes)\n", dir.count, dir.count*(int)sizeof(rresDirEntryCompact) + namesSize);
+                    }
+
+                    RRES_FREE(data);
                 }
             }
         }
@@ -930,6 +1456,38 @@ rresCentralDir rresLoadCentralDirectory(const char *fileName)
 void rresUnloadCentralDirectory(rresCentralDir dir)
 {
     RRES_FREE(dir.entries);
+    RRES_FREE(dir.table);
+    RRES_FREE(dir.compactEntries);
+    RRES_FREE(dir.names);
+}
+
+// Get central directory entry resource id
+unsigned int rresGetDirEntryId(rresCentralDir dir, unsigned int index)
+{
+    unsigned int id = 0;
+
+    if (index < dir.count)
+    {
+        if (dir.compactEntries != NULL) id = dir.compactEntries[index].id;
+        else if (dir.entries != NULL) id = dir.entries[index].id;
+    }
+
+    return id;
+}
+
+// Get central directory entry fileName
+// NOTE: Returned string references central directory data, it's valid until directory is unloaded
+const char *rresGetDirEntryFileName(rresCentralDir dir, unsigned int index)
+{
+    const char *fileName = NULL;
+
+    if (index < dir.count)
+    {
+        if (dir.compactEntries != NULL) fileName = dir.names + dir.compactEntries[index].nameOffset;
+        else if (dir.entries != NULL) fileName = dir.entries[index].fileName;
+    }
+
+    return fileName;
 }
 
 // Get rresResourceDataType from FourCC code
@@ -968,20 +1526,61 @@ unsigned int rresGetDataType(const unsigned char *fourCC)
 }
 
 // Get resource identifier from filename
+// NOTE: FileName must match exactly, lookup uses central directory hash table (if available)
 // WARNING: It requires the central directory previously loaded
 unsigned int rresGetResourceId(rresCentralDir dir, const char *fileName)
 {
     unsigned int id = 0;
 
-    for (unsigned int i = 0, len = 0; i < dir.count; i++)
+    if ((fileName != NULL) && (dir.compactEntries != NULL))
     {
-        len = (unsigned int)strlen(fileName);
+        // Binary search on entries sorted by fileName
+        unsigned int low = 0;
+        unsigned int high = dir.count;
 
-        // NOTE: entries[i].fileName is NULL terminated and padded to 4-bytes
-        if (strncmp((const char *)dir.entries[i].fileName, fileName, len) == 0)
+        while (low < high)
         {
-            id = dir.entries[i].id;
-            break;
+            unsigned int middle = low + (high - low)/2;
+            int result = strcmp(dir.names + dir.compactEntries[middle].nameOffset, fileName);
+
+            if (result == 0)
+            {
+                id = dir.compactEntries[middle].id;
+                break;
+            }
+            else if (result < 0) low = middle + 1;
+            else high = middle;
+        }
+    }
+    else if ((fileName != NULL) && (dir.entries != NULL))
+    {
+        if (dir.capacity > 0)
+        {
+            unsigned int mask = dir.capacity - 1;
+            unsigned int slot = rresComputeCRC32((const unsigned char *)fileName, (int)strlen(fileName)) & mask;
+
+            while (dir.table[slot] != 0)
+            {
+                // NOTE: entries[i].fileName is NULL terminated and padded to 4-bytes
+                if (strcmp(dir.entries[dir.table[slot] - 1].fileName, fileName) == 0)
+                {
+                    id = dir.entries[dir.table[slot] - 1].id;
+                    break;
+                }
+
+                slot = (slot + 1) & mask;
+            }
+        }
+        else
+        {
+            for (unsigned int i = 0; i < dir.count; i++)
+            {
+                if (strcmp(dir.entries[i].fileName, fileName) == 0)
+                {
+                    id = dir.entries[i].id;
+                    break;
+                }
+            }
         }
     }
 
@@ -989,47 +1588,42 @@ unsigned int rresGetResourceId(rresCentralDir dir, const char *fileName)
 }
 
 // Compute CRC32 hash
-// NOTE: CRC32 is used as rres id, generated from original filename
+// NOTE 1: CRC32 is used as rres id, generated from original filename
+// NOTE 2: Computation engine is selected on first use, hardware accelerated if supported by the CPU
 unsigned int rresComputeCRC32(const unsigned char *data, int len)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
-        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
-        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
-        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
-        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
-        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
-        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
-        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
-        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
-        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
-        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
-        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
-        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
-        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
-        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
-        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
-        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
-        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
-        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
-        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
-        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
-        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
-        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
-        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
-        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
-        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
-        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
-        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
-        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
-    };
+    return rresUpdateCRC32(0, data, len);
+}
 
-    unsigned int crc = ~0u;
+// Update CRC32 hash with next data block
+// NOTE: Data can be processed by blocks as read, result is the same as rresComputeCRC32() on whole data
+unsigned int rresUpdateCRC32(unsigned int crc, const unsigned char *data, int len)
+{
+    unsigned int size = (len > 0)? (unsigned int)len : 0;
+
+    crc = ~crc;
+
+    if (crc32Engine < 0) rresInitCRC32();
+
+#if defined(RRES_CRC32_CLMUL)
+    if ((crc32Engine == RRES_CRC32_ENGINE_CLMUL) && (size >= 64))
+    {
+        // Fold 16-byte blocks, remaining bytes are processed with tables
+        unsigned int blocksSize = size & ~15u;
+        crc = rresComputeCRC32Clmul(crc, data, blocksSize);
+        data += blocksSize;
+        size -= blocksSize;
+    }
+#endif
+#if defined(RRES_CRC32_ARMV8)
+    if (crc32Engine == RRES_CRC32_ENGINE_ARMV8)
+    {
+        crc = rresComputeCRC32Armv8(crc, data, size);
+        size = 0;
+    }
+#endif
 
-    for (int i = 0; i < len; i++) crc = (crc >> 8)^crcTable[data[i]^(crc&0xff)];
+    if (size > 0) crc = rresComputeCRC32Table(crc, data, size);
 
     return ~crc;
 }
@@ -1038,6 +1632,8 @@ unsigned int rresComputeCRC32(const unsigned char *data, int len)
 void rresSetCipherPassword(const char *pass)
 {
     password = pass;
+
+    if (passwordCallback != NULL) passwordCallback(pass);
 }
 
 // Get password to be used on data decryption
@@ -1048,50 +1644,1795 @@ const char *rresGetCipherPassword(void)
     return password;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-// Load user resource chunk from resource packed data (as contained in .rres file)
-// WARNING: Data can be compressed and/or encrypted, in those cases is up to the user to process it,
-// and chunk.data.propCount = 0, chunk.data.props = NULL and chunk.data.raw contains all resource packed data
-static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *data)
+// Set callback to be notified on password change
+void rresSetCipherPasswordCallback(rresCipherPasswordCallback callback)
 {
-    rresResourceChunkData chunkData = { 0 };
+    passwordCallback = callback;
+}
 
-    // CRC32 data validation, verify packed data is not corrupted
-    unsigned int crc32 = rresComputeCRC32((const unsigned char *)data, info.packedSize);
+// Get callback notified on password change
+rresCipherPasswordCallback rresGetCipherPasswordCallback(void)
+{
+    return passwordCallback;
+}
 
-    if ((rresGetDataType(info.type) != RRES_DATA_NULL) && (crc32 == info.crc32))   // Make sure chunk contains data and data is not corrupted
+// Enable/disable load statistics recording
+void rresEnableLoadStats(int enable)
+{
+    loadStatsEnabled = enable;
+}
+
+// Check if load statistics recording is enabled
+int rresIsLoadStatsEnabled(void)
+{
+    return loadStatsEnabled;
+}
+
+// Add load statistics to (stats.dataType, stats.compType) entry
+// NOTE: Statistics are only added if recording is enabled, it's thread-safe
+void rresAddLoadStats(rresLoadStats stats)
+{
+    if (!loadStatsEnabled) return;
+
+    rresLockMutex(&loadStatsLock);
+
+    rresLoadStats *entry = NULL;
+
+    for (unsigned int i = 0; i < loadStatsCount; i++)
     {
-        // Check if data chunk is compressed/encrypted to retrieve properties + data
-        if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE))
+        if ((loadStats[i].dataType == stats.dataType) && (loadStats[i].compType == stats.compType))
         {
-            // Data is not compressed/encrypted (info.packedSize = info.baseSize)
-            chunkData.propCount = ((unsigned int *)data)[0];
+            entry = &loadStats[i];
+            break;
+        }
+    }
 
-            if (chunkData.propCount > 0)
-            {
-                chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
-                for (unsigned int i = 0; i < chunkData.propCount; i++) chunkData.props[i] = ((unsigned int *)data)[i + 1];
-            }
+    if ((entry == NULL) && (loadStatsCount < RRES_MAX_LOAD_STATS))
+    {
+        entry = &loadStats[loadStatsCount++];
+        memset(entry, 0, sizeof(rresLoadStats));
+        entry->dataType = stats.dataType;
+        entry->compType = stats.compType;
+    }
 
-            int rawSize = info.baseSize - sizeof(int) - (chunkData.propCount*sizeof(int));
-            chunkData.raw = RRES_CALLOC(rawSize, 1);
-            if (chunkData.raw != NULL) memcpy(chunkData.raw, ((unsigned char *)data) + sizeof(int) + (chunkData.propCount*sizeof(int)), rawSize);
-        }
-        else
+    if (entry != NULL)
+    {
+        entry->chunkCount += stats.chunkCount;
+        entry->fileOpens += stats.fileOpens;
+        entry->fileSeeks += stats.fileSeeks;
+        entry->bytesRead += stats.bytesRead;
+        entry->bytesAllocated += stats.bytesAllocated;
+        entry->bytesCopied += stats.bytesCopied;
+        entry->crcTime += stats.crcTime;
+        entry->kdfTime += stats.kdfTime;
+        entry->decryptTime += stats.decryptTime;
+        entry->decompressTime += stats.decompressTime;
+    }
+
+    rresUnlockMutex(&loadStatsLock);
+}
+
+// Get load statistics for data type and compression type
+// NOTE: Use -1 for any data type and/or any compression type, matching entries are accumulated
+rresLoadStats rresGetLoadStats(int dataType, int compType)
+{
+    rresLoadStats stats = { 0 };
+
+    stats.dataType = (unsigned int)dataType;
+    stats.compType = (unsigned int)compType;
+
+    rresLockMutex(&loadStatsLock);
+
+    for (unsigned int i = 0; i < loadStatsCount; i++)
+    {
+        if (((dataType < 0) || (loadStats[i].dataType == (unsigned int)dataType)) &&
+            ((compType < 0) || (loadStats[i].compType == (unsigned int)compType)))
         {
-            // Data is compressed/encrypted
-            // Just return the loaded resource packed data from .rres file,
-            // it's up to the user to manage decompression/decryption on user library
-            chunkData.raw = RRES_CALLOC(info.packedSize, 1);
-            if (chunkData.raw != NULL) memcpy(chunkData.raw, (unsigned char *)data, info.packedSize);
+            stats.chunkCount += loadStats[i].chunkCount;
+            stats.fileOpens += loadStats[i].fileOpens;
+            stats.fileSeeks += loadStats[i].fileSeeks;
+            stats.bytesRead += loadStats[i].bytesRead;
+            stats.bytesAllocated += loadStats[i].bytesAllocated;
+            stats.bytesCopied += loadStats[i].bytesCopied;
+            stats.crcTime += loadStats[i].crcTime;
+            stats.kdfTime += loadStats[i].kdfTime;
+            stats.decryptTime += loadStats[i].decryptTime;
+            stats.decompressTime += loadStats[i].decompressTime;
         }
     }
 
-    if (crc32 != info.crc32) RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+    rresUnlockMutex(&loadStatsLock);
 
-    return chunkData;
+    return stats;
+}
+
+// Reset load statistics
+void rresResetLoadStats(void)
+{
+    rresLockMutex(&loadStatsLock);
+    memset(loadStats, 0, sizeof(loadStats));
+    loadStatsCount = 0;
+    rresUnlockMutex(&loadStatsLock);
+}
+
+// Export load statistics entries, one entry by (data type, compression type)
+// NOTE: Format is selected by file extension: JSON (.json), CSV otherwise, times are exported in seconds
+int rresExportLoadStats(const char *fileName)
+{
+    int result = RRES_SUCCESS;
+    const char *extension = (fileName != NULL)? strrchr(fileName, '.') : NULL;
+    bool json = (extension != NULL) && ((strcmp(extension, ".json") == 0) || (strcmp(extension, ".JSON") == 0));
+
+    FILE *statsFile = (fileName != NULL)? fopen(fileName, "wt") : NULL;
+
+    if (statsFile == NULL) result = RRES_ERROR_FILE_NOT_FOUND;
+    else
+    {
+        rresLockMutex(&loadStatsLock);
+
+        if (json) fprintf(statsFile, "{\n    \"loadStats\": [\n");
+        else fprintf(statsFile, "dataType,compType,chunkCount,fileOpens,fileSeeks,bytesRead,bytesAllocated,bytesCopied,crcTime,kdfTime,decryptTime,decompressTime\n");
+
+        for (unsigned int i = 0; i < loadStatsCount; i++)
+        {
+            unsigned char fourCC[5] = { 0 };
+            rresLoadStats *entry = &loadStats[i];
+
+            rresGetFourCC(entry->dataType, fourCC);
+
+            if (json)
+            {
+                fprintf(statsFile, "        { \"dataType\": \"%s\", \"compType\": %u, \"chunkCount\": %u, \"fileOpens\": %u, \"fileSeeks\": %u, ",
+                    (char *)fourCC, entry->compType, entry->chunkCount, entry->fileOpens, entry->fileSeeks);
+                fprintf(statsFile, "\"bytesRead\": %llu, \"bytesAllocated\": %llu, \"bytesCopied\": %llu, ", entry->bytesRead, entry->bytesAllocated, entry->bytesCopied);
+                fprintf(statsFile, "\"crcTime\": %.6f, \"kdfTime\": %.6f, \"decryptTime\": %.6f, \"decompressTime\": %.6f }%s\n",
+                    entry->crcTime, entry->kdfTime, entry->decryptTime, entry->decompressTime, (i < (loadStatsCount - 1))? "," : "");
+            }
+            else
+            {
+                fprintf(statsFile, "%s,%u,%u,%u,%u,%llu,%llu,%llu,%.6f,%.6f,%.6f,%.6f\n", (char *)fourCC, entry->compType, entry->chunkCount, entry->fileOpens, entry->fileSeeks,
+                    entry->bytesRead, entry->bytesAllocated, entry->bytesCopied, entry->crcTime, entry->kdfTime, entry->decryptTime, entry->decompressTime);
+            }
+        }
+
+        if (json) fprintf(statsFile, "    ]\n}\n");
+
+        rresUnlockMutex(&loadStatsLock);
+
+        if (fclose(statsFile) != 0) result = RRES_ERROR_FILE_WRITE;
+    }
+
+    return result;
+}
+
+// Get monotonic time in seconds
+double rresGetLoadStatsTime(void)
+{
+    double time = 0.0;
+
+#if defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+
+    // NOTE: LARGE_INTEGER is a union of a 64 bit integer
+    QueryPerformanceFrequency((union _LARGE_INTEGER *)&frequency);
+    QueryPerformanceCounter((union _LARGE_INTEGER *)&counter);
+    time = (double)counter/(double)frequency;
+#else
+    struct timespec ts = { 0 };
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    time = (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+
+    return time;
+}
+
+// Open rres file and index its resources
+// NOTE: File is kept open until rresCloseArchive() is called
+rresArchive rresOpenArchive(const char *fileName)
+{
+    rresArchive archive = { 0 };
+
+    FILE *rresFile = fopen(fileName, "rb");
+
+    if (rresFile == NULL) RRES_LOG("RRES: WARNING: [%s] rres file could not be opened\n", fileName);
+    else
+    {
+        rresFileHeader header = { 0 };
+        rresLoadStats stats = { 0 };    // File level statistics (RRES_DATA_NULL)
+
+        stats.fileOpens = 1;
+        stats.bytesRead = sizeof(rresFileHeader);
+
+        fread(&header, sizeof(rresFileHeader), 1, rresFile);
+
+        // Verify file signature: "rres", file version: 100
+        if (((header.id[0] == 'r') && (header.id[1] == 'r') && (header.id[2] == 'e') && (header.id[3] == 's')) && (header.version == 100))
+        {
+            archive.file = rresFile;
+            archive.header = header;
+
+            // NOTE: File handle could be reused by a later opened archive, id is not
+            rresLockMutex(&archiveLock);
+            archiveCounter++;
+            if (archiveCounter == 0) archiveCounter = 1;    // Counter wrapped, 0 means no archive
+            archive.id = archiveCounter;
+            rresUnlockMutex(&archiveLock);
+
+            // Index hash table capacity: power of two, at least twice the chunks count
+            archive.capacity = 16;
+            while (archive.capacity < 2u*header.chunkCount) archive.capacity *= 2;
+            archive.ids = (unsigned int *)RRES_CALLOC(archive.capacity, sizeof(unsigned int));
+            archive.offsets = (unsigned int *)RRES_CALLOC(archive.capacity, sizeof(unsigned int));
+
+            bool indexed = false;
+
+            // Index resources from Central Directory (if available)
+            // NOTE: Central Directory offset is relative to the end of the file header
+            if (header.cdOffset != 0)
+            {
+                rresResourceChunkInfo info = { 0 };
+
+                fseek(rresFile, sizeof(rresFileHeader) + header.cdOffset, SEEK_SET);
+                fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile);
+
+                stats.fileSeeks++;
+                stats.bytesRead += sizeof(rresResourceChunkInfo);
+
+                if ((info.type[0] == 'C') && (info.type[1] == 'D') && (info.type[2] == 'I') && (info.type[3] == 'R'))
+                {
+                    unsigned char *data = (unsigned char *)RRES_CALLOC(info.packedSize, 1);
+                    fread(data, info.packedSize, 1, rresFile);
+
+                    double time = loadStatsEnabled? rresGetLoadStatsTime() : 0.0;
+                    unsigned int crc32 = rresComputeCRC32(data, info.packedSize);
+
+                    if (loadStatsEnabled) stats.crcTime += rresGetLoadStatsTime() - time;
+                    stats.bytesRead += info.packedSize;
+                    stats.bytesAllocated += info.packedSize;
+
+                    if (crc32 == info.crc32)
+                    {
+                        // CDIR data: propCount + props[0]:entryCount + rresDirEntry[0..entryCount]
+                        unsigned int propCount = ((unsigned int *)data)[0];
+                        unsigned int entryCount = ((unsigned int *)data)[1];
+                        unsigned int position = sizeof(int) + propCount*sizeof(int);
+
+                        for (unsigned int i = 0; (i < entryCount) && ((position + 16) <= info.packedSize); i++)
+                        {
+                            unsigned int *entry = (unsigned int *)(data + position);
+
+                            rresIndexArchiveResource(&archive, entry[0], entry[1]);  // Entry id and global offset
+                            position += (16 + entry[3]);                            // Skip entry fileName (fileNameSize)
+                        }
+
+                        indexed = true;
+                        RRES_LOG("RRES: CDIR: Archive indexed from Central Directory: %i resources\n", archive.count);
+                    }
+                    else RRES_LOG("RRES: WARNING: CDIR: CRC32 does not match, Central Directory can not be used\n");
+
+                    RRES_FREE(data);
+                }
+            }
+
+            // Index resources scanning resource chunks (one single pass)
+            // NOTE: Only first chunk found for every id is indexed, linked chunks are reached with nextOffset
+            if (!indexed)
+            {
+                unsigned int offset = sizeof(rresFileHeader);
+
+                fseek(rresFile, offset, SEEK_SET);
+                stats.fileSeeks++;
+
+                for (int i = 0; i < header.chunkCount; i++)
+                {
+                    rresResourceChunkInfo info = { 0 };
+
+                    if (fread(&info, sizeof(rresResourceChunkInfo), 1, rresFile) != 1) break;
+                    if (rresFindArchiveResource(archive, info.id) == 0) rresIndexArchiveResource(&archive, info.id, offset);
+
+                    offset += (sizeof(rresResourceChunkInfo) + info.packedSize);
+                    fseek(rresFile, info.packedSize, SEEK_CUR);
+
+                    stats.fileSeeks++;
+                    stats.bytesRead += sizeof(rresResourceChunkInfo);
+                }
+
+                RRES_LOG("RRES: INFO: Archive indexed from resource chunks: %i resources\n", archive.count);
+            }
+        }
+        else
+        {
+            RRES_LOG("RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
+            fclose(rresFile);
+        }
+
+        rresAddLoadStats(stats);
+    }
+
+    return archive;
+}
+
+// Open rres file mapped in memory
+// NOTE: Chunks loaded from a mapped archive reference the mapped data when uncompressed/unencrypted,
+// they are valid until rresCloseArchive() is called; if mapping is not supported, a regular archive is opened
+rresArchive rresOpenArchiveMapped(const char *fileName)
+{
+    rresArchive archive = rresOpenArchive(fileName);
+
+#if defined(RRES_SUPPORT_MMAP)
+    if (archive.file != NULL)
+    {
+        struct stat fileStat = { 0 };
+        int fd = fileno((FILE *)archive.file);
+
+        if ((fstat(fd, &fileStat) == 0) && (fileStat.st_size > 0) && ((unsigned long long)fileStat.st_size <= 0xffffffffull))
+        {
+            void *mapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                archive.mapping = (unsigned char *)mapping;
+                archive.mappingSize = (unsigned int)fileStat.st_size;
+                RRES_LOG("RRES: INFO: [%s] Archive mapped in memory (%u bytes)\n", fileName, archive.mappingSize);
+            }
+        }
+
+        if (archive.mapping == NULL) RRES_LOG("RRES: WARNING: [%s] Archive could not be mapped, using file reads\n", fileName);
+    }
+#else
+    RRES_LOG("RRES: WARNING: Memory mapped archives not supported on this platform, using file reads\n");
+#endif
+
+    return archive;
+}
+
+// Close rres file and unload resources index
+// WARNING: Chunks loaded from a mapped archive are not valid after closing it
+void rresCloseArchive(rresArchive archive)
+{
+#if defined(RRES_SUPPORT_MMAP)
+    if (archive.mapping != NULL) munmap(archive.mapping, archive.mappingSize);
+#endif
+    if (archive.file != NULL) fclose((FILE *)archive.file);
+
+    RRES_FREE(archive.ids);
+    RRES_FREE(archive.offsets);
+}
+
+// Load one resource chunk for provided id from archive
+rresResourceChunk rresLoadResourceChunkFromArchive(rresArchive archive, unsigned int rresId)
+{
+    rresResourceChunk chunk = { 0 };
+    unsigned int offset = rresFindArchiveResource(archive, rresId);
+
+    if (offset == 0) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+    else
+    {
+        chunk = rresLoadArchiveChunk(archive, offset);
+
+        // NOTE: Only loading first resource chunk but showing a message if additional chunks are linked
+        if (chunk.info.nextOffset != 0) RRES_LOG("RRES: WARNING: Multiple linked resource chunks available for the provided id\n");
+    }
+
+    return chunk;
+}
+
+// Load resource for provided id from archive
+// NOTE: All resources conected to base id are loaded
+rresResourceMulti rresLoadResourceMultiFromArchive(rresArchive archive, unsigned int rresId)
+{
+    rresResourceMulti rres = { 0 };
+    unsigned int offset = rresFindArchiveResource(archive, rresId);
+
+    if (offset == 0) RRES_LOG("RRES: WARNING: Requested resource not found: 0x%08x\n", rresId);
+    else
+    {
+        // Count all linked resource chunks checking temp.nextOffset
+        rresResourceChunkInfo temp = rresLoadArchiveChunkInfo(archive, offset);
+        rres.count = 1;
+
+        while (temp.nextOffset != 0)
+        {
+            temp = rresLoadArchiveChunkInfo(archive, temp.nextOffset);
+            rres.count++;
+        }
+
+        rres.chunks = (rresResourceChunk *)RRES_CALLOC(rres.count, sizeof(rresResourceChunk));
+
+        // Load all linked resource chunks
+        for (unsigned int i = 0; i < rres.count; i++)
+        {
+            rres.chunks[i] = rresLoadArchiveChunk(archive, offset);
+            offset = rres.chunks[i].info.nextOffset;
+        }
+    }
+
+    return rres;
+}
+
+// Load resource chunk info for provided id from archive
+rresResourceChunkInfo rresLoadResourceChunkInfoFromArchive(rresArchive archive, unsigned int rresId)
+{
+    rresResourceChunkInfo info = { 0 };
+    unsigned int offset = rresFindArchiveResource(archive, rresId);
+
+    if (offset != 0) info = rresLoadArchiveChunkInfo(archive, offset);
+
+    return info;
+}
+
+// Set archive chunks data CRC32 verification on load
+void rresSetArchiveVerifyMode(rresArchive *archive, int mode)
+{
+    if (archive != NULL) archive->verifyMode = (unsigned int)mode;
+}
+
+// Verify all archive chunks data CRC32
+// NOTE: Useful to verify an archive once (i.e. on installation or on a background thread) and
+// load resources later with RRES_VERIFY_NEVER mode, returns corrupted chunks count (0 if all valid)
+int rresVerifyArchive(rresArchive archive)
+{
+    int corruptedCount = 0;
+
+    if (archive.file != NULL)
+    {
+        unsigned int offset = sizeof(rresFileHeader);
+        unsigned char *data = NULL;
+        unsigned int dataCapacity = 0;
+
+        // NOTE: Central Directory chunk is not considered on header.chunkCount
+        unsigned int chunkCount = archive.header.chunkCount + ((archive.header.cdOffset != 0)? 1 : 0);
+
+        for (unsigned int i = 0; i < chunkCount; i++)
+        {
+            rresResourceChunkInfo info = rresLoadArchiveChunkInfo(archive, offset);
+            const unsigned char *chunkData = NULL;
+
+            if (archive.mapping != NULL)
+            {
+                if (((unsigned long long)offset + sizeof(rresResourceChunkInfo) + info.packedSize) <= archive.mappingSize) chunkData = archive.mapping + offset + sizeof(rresResourceChunkInfo);
+            }
+            else
+            {
+                if (info.packedSize > dataCapacity)
+                {
+                    RRES_FREE(data);
+                    data = (unsigned char *)RRES_MALLOC(info.packedSize);
+                    dataCapacity = (data != NULL)? info.packedSize : 0;
+                }
+
+                if ((data != NULL) && rresReadArchive(archive, offset + sizeof(rresResourceChunkInfo), data, info.packedSize)) chunkData = data;
+            }
+
+            if ((chunkData == NULL) || (rresComputeCRC32(chunkData, info.packedSize) != info.crc32))
+            {
+                RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+                corruptedCount++;
+            }
+
+            if (chunkData == NULL) break;   // Chunk could not be read, following chunks can not be located
+
+            offset += (sizeof(rresResourceChunkInfo) + info.packedSize);
+        }
+
+        RRES_FREE(data);
+
+        if (corruptedCount == 0) RRES_LOG("RRES: INFO: Archive verified: %i resource chunks\n", chunkCount);
+    }
+
+    return corruptedCount;
+}
+
+// Get resource first chunk global offset in archive
+// NOTE: Chunk info is placed at offset, chunk data follows it; useful to read chunk data ranges
+unsigned int rresGetResourceOffset(rresArchive archive, unsigned int rresId)
+{
+    return rresFindArchiveResource(archive, rresId);
+}
+
+// Read archive data at global offset
+// NOTE: Data is read as stored in file, it is not verified (CRC32 considers whole chunk data)
+int rresReadArchiveData(rresArchive archive, unsigned int offset, void *data, unsigned int size)
+{
+    rresAddFileStats(0, (archive.mapping != NULL)? 0 : 1, size);
+
+    return rresReadArchive(archive, offset, data, size)? 1 : 0;
+}
+
+// Run jobs concurrently on worker threads
+// NOTE: Calling thread also runs jobs, jobs are taken in order but they can finish in any order
+void rresRunJobs(rresJobCallback job, void *userData, unsigned int jobCount, unsigned int threadCount)
+{
+    if ((job != NULL) && (jobCount > 0))
+    {
+        rresJobQueue queue = { 0 };
+        queue.job = job;
+        queue.userData = userData;
+        queue.count = jobCount;
+        rresInitMutex(&queue.lock);
+
+        if (threadCount == 0) threadCount = rresGetProcessorCount();
+        if (threadCount > jobCount) threadCount = jobCount;
+        if (threadCount > RRES_MAX_JOB_THREADS) threadCount = RRES_MAX_JOB_THREADS;
+
+        rresThread threads[RRES_MAX_JOB_THREADS] = { 0 };
+        unsigned int threadsCreated = 0;
+
+        // NOTE: If some thread can not be created, remaining jobs are run by available threads
+        for (unsigned int i = 1; i < threadCount; i++)
+        {
+            if (rresCreateThread(&threads[threadsCreated], rresJobWorker, &queue)) threadsCreated++;
+        }
+
+        rresJobWorker(&queue);
+
+        for (unsigned int i = 0; i < threadsCreated; i++) rresJoinThread(threads[i]);
+
+        rresDestroyMutex(&queue.lock);
+    }
+}
+
+// Request resource load (multiple resource chunks) on loading thread
+// NOTE: Loading thread is started on first request
+unsigned int rresRequestLoad(rresArchive archive, unsigned int rresId, int priority)
+{
+    unsigned int ticket = 0;
+
+    if (archive.file == NULL) RRES_LOG("RRES: WARNING: Load requested from an archive not opened\n");
+    else
+    {
+        rresLockMutex(&loadLock);
+
+        // Get a free request slot, slots are grown if required
+        unsigned int index = 0;
+        while ((index < loadQueue.capacity) && (loadQueue.requests[index].state != RRES_LOAD_FREE)) index++;
+
+        if ((index == loadQueue.capacity) && (loadQueue.capacity < RRES_MAX_LOAD_REQUESTS))
+        {
+            unsigned int capacity = (loadQueue.capacity == 0)? 16 : loadQueue.capacity*2;
+            if (capacity > RRES_MAX_LOAD_REQUESTS) capacity = RRES_MAX_LOAD_REQUESTS;
+
+            rresLoadRequest *requests = (rresLoadRequest *)RRES_REALLOC(loadQueue.requests, capacity*sizeof(rresLoadRequest));
+
+            if (requests != NULL)
+            {
+                memset(requests + loadQueue.capacity, 0, (capacity - loadQueue.capacity)*sizeof(rresLoadRequest));
+                loadQueue.requests = requests;
+                loadQueue.capacity = capacity;
+            }
+        }
+
+        if (index < loadQueue.capacity)
+        {
+            if (!loadQueue.running)
+            {
+                loadQueue.stop = false;
+                loadQueue.running = rresCreateThread(&loadQueue.thread, rresLoadWorker, NULL);
+            }
+
+            if (loadQueue.running)
+            {
+                rresLoadRequest *request = &loadQueue.requests[index];
+                request->archive = archive;
+                request->rresId = rresId;
+                request->priority = priority;
+                request->serial = loadQueue.serial++;
+                request->state = RRES_LOAD_PENDING;
+
+                ticket = ((unsigned int)request->generation << 16) | (index + 1);
+
+                rresSignalCondition(&loadSignal);
+            }
+            else RRES_LOG("RRES: WARNING: Loading thread could not be created\n");
+        }
+        else RRES_LOG("RRES: WARNING: Maximum load requests reached, resource load not requested: 0x%08x\n", rresId);
+
+        rresUnlockMutex(&loadLock);
+    }
+
+    return ticket;
+}
+
+// Check if requested resource has been loaded
+int rresIsLoadReady(unsigned int ticket)
+{
+    rresLockMutex(&loadLock);
+    rresLoadRequest *request = rresGetLoadRequest(ticket);
+    int ready = ((request != NULL) && (request->state == RRES_LOAD_READY))? 1 : 0;
+    rresUnlockMutex(&loadLock);
+
+    return ready;
+}
+
+// Take loaded resource and release ticket
+// NOTE: If resource is not loaded yet, an empty resource is returned and ticket is kept
+rresResourceMulti rresTakeResult(unsigned int ticket)
+{
+    rresResourceMulti rres = { 0 };
+
+    rresLockMutex(&loadLock);
+    rresLoadRequest *request = rresGetLoadRequest(ticket);
+
+    if ((request != NULL) && (request->state == RRES_LOAD_READY))
+    {
+        rres = request->result;
+        rresReleaseLoadRequest(request);
+    }
+
+    rresUnlockMutex(&loadLock);
+
+    return rres;
+}
+
+// Cancel load request and release ticket
+// NOTE: Resources being loaded are unloaded by loading thread once loaded
+int rresCancelLoad(unsigned int ticket)
+{
+    int result = 0;
+
+    rresLockMutex(&loadLock);
+    rresLoadRequest *request = rresGetLoadRequest(ticket);
+
+    if (request != NULL)
+    {
+        if (request->state == RRES_LOAD_LOADING) request->state = RRES_LOAD_CANCELED;
+        else
+        {
+            if (request->state == RRES_LOAD_READY) rresUnloadResourceMulti(request->result);
+            rresReleaseLoadRequest(request);
+        }
+
+        result = 1;
+    }
+
+    rresUnlockMutex(&loadLock);
+
+    return result;
+}
+
+// Set callback to process loaded resources on loading thread
+void rresSetLoadProcessor(rresLoadProcessor processor)
+{
+    rresLockMutex(&loadLock);
+    loadQueue.processor = processor;
+    rresUnlockMutex(&loadLock);
+}
+
+// Stop loading thread
+// NOTE: Pending requests are canceled, resources not taken are unloaded and all tickets are released
+void rresStopLoads(void)
+{
+    rresLockMutex(&loadLock);
+    bool running = loadQueue.running;
+    loadQueue.stop = true;
+    rresSignalCondition(&loadSignal);
+    rresUnlockMutex(&loadLock);
+
+    if (running) rresJoinThread(loadQueue.thread);
+
+    rresLockMutex(&loadLock);
+
+    for (unsigned int i = 0; i < loadQueue.capacity; i++)
+    {
+        if (loadQueue.requests[i].state == RRES_LOAD_READY) rresUnloadResourceMulti(loadQueue.requests[i].result);
+    }
+
+    RRES_FREE(loadQueue.requests);
+
+    rresLoadProcessor processor = loadQueue.processor;
+    memset(&loadQueue, 0, sizeof(rresLoadQueue));
+    loadQueue.processor = processor;
+
+    rresUnlockMutex(&loadLock);
+}
+
+// Create rres file to pack resources
+// NOTE: File header is written on close, once chunks count and central directory offset are known
+rresPacker rresOpenPacker(const char *fileName)
+{
+    rresPacker packer = { 0 };
+
+    FILE *rresFile = fopen(fileName, "wb");
+
+    if (rresFile == NULL)
+    {
+        packer.result = RRES_ERROR_FILE_NOT_FOUND;
+        RRES_LOG("RRES: WARNING: [%s] rres file could not be created\n", fileName);
+    }
+    else
+    {
+        rresFileHeader header = { 0 };
+
+        packer.file = rresFile;
+        packer.offset = sizeof(rresFileHeader);
+
+        // Reserve file header space
+        if (fwrite(&header, sizeof(rresFileHeader), 1, rresFile) != 1) packer.result = RRES_ERROR_FILE_WRITE;
+    }
+
+    return packer;
+}
+
+// Add resource chunk to packer
+// NOTE 1: Chunk properties and data are copied, resource id is generated from fileName (CRC32)
+// NOTE 2: Consecutive chunks with the same fileName are linked as one resource (multiple chunks)
+unsigned int rresAddPackerChunk(rresPacker *packer, const char *fileName, int type, const unsigned int *props, unsigned int propCount, const void *data, unsigned int size, int compType, int cipherType)
+{
+    unsigned int id = 0;
+
+    if ((packer == NULL) || (packer->file == NULL) || (packer->result != RRES_SUCCESS) || (fileName == NULL)) return id;
+
+    unsigned int fileNameLength = (unsigned int)strlen(fileName);
+    unsigned int blockSize = sizeof(int) + propCount*sizeof(int) + size;
+
+    // Grow pending chunks and central directory if required
+    if (packer->pendingCount == packer->pendingCapacity)
+    {
+        unsigned int capacity = (packer->pendingCapacity > 0)? packer->pendingCapacity*2 : 64;
+        rresResourceChunk *pending = (rresResourceChunk *)RRES_REALLOC(packer->pending, capacity*sizeof(rresResourceChunk));
+
+        if (pending != NULL)
+        {
+            packer->pending = pending;
+            packer->pendingCapacity = capacity;
+        }
+    }
+
+    if (packer->dir.count == packer->dirCapacity)
+    {
+        unsigned int capacity = (packer->dirCapacity > 0)? packer->dirCapacity*2 : 64;
+        rresDirEntryCompact *entries = (rresDirEntryCompact *)RRES_REALLOC(packer->dir.compactEntries, capacity*sizeof(rresDirEntryCompact));
+
+        if (entries != NULL)
+        {
+            packer->dir.compactEntries = entries;
+            packer->dirCapacity = capacity;
+        }
+    }
+
+    if ((packer->namesSize + fileNameLength + 1) > packer->namesCapacity)
+    {
+        unsigned int capacity = (packer->namesCapacity > 0)? packer->namesCapacity*2 : 4096;
+        while (capacity < (packer->namesSize + fileNameLength + 1)) capacity *= 2;
+
+        char *names = (char *)RRES_REALLOC(packer->dir.names, capacity);
+
+        if (names != NULL)
+        {
+            packer->dir.names = names;
+            packer->namesCapacity = capacity;
+        }
+    }
+
+    unsigned int *block = (unsigned int *)RRES_MALLOC(blockSize);
+
+    if ((block == NULL) || (packer->pendingCount == packer->pendingCapacity) || (packer->dir.count == packer->dirCapacity) ||
+        ((packer->namesSize + fileNameLength + 1) > packer->namesCapacity))
+    {
+        RRES_FREE(block);
+        packer->result = RRES_ERROR_MEMORY_ALLOC;
+        RRES_LOG("RRES: WARNING: [%s] Resource chunk could not be added to packer, memory allocation failed\n", fileName);
+        return id;
+    }
+
+    id = rresComputeCRC32((const unsigned char *)fileName, (int)fileNameLength);
+
+    // Chunk data block: propCount + props[] + raw
+    block[0] = propCount;
+    if (propCount > 0) memcpy(block + 1, props, propCount*sizeof(int));
+    if (size > 0) memcpy(block + 1 + propCount, data, size);
+
+    rresResourceChunk *chunk = &packer->pending[packer->pendingCount];
+    memset(chunk, 0, sizeof(rresResourceChunk));
+
+    rresGetFourCC(type, chunk->info.type);
+    chunk->info.id = id;
+    chunk->info.compType = (unsigned char)compType;
+    chunk->info.cipherType = (unsigned char)cipherType;
+    chunk->info.packedSize = blockSize;
+    chunk->info.baseSize = blockSize;
+    chunk->info.reserved = RRES_CHUNK_DATA_BLOCK;
+    chunk->data.propCount = propCount;
+    chunk->data.props = (propCount > 0)? (block + 1) : NULL;
+    chunk->data.raw = block + 1 + propCount;
+
+    // Register central directory entry for resource first chunk
+    if (((packer->chunkCount + packer->pendingCount) == 0) || (id != packer->addedId))
+    {
+        rresDirEntryCompact *entry = &packer->dir.compactEntries[packer->dir.count];
+
+        entry->id = id;
+        entry->offset = 0;      // Assigned on writing
+        entry->nameOffset = packer->namesSize;
+        entry->nameLength = fileNameLength;
+
+        memcpy(packer->dir.names + packer->namesSize, fileName, fileNameLength + 1);
+        packer->namesSize += (fileNameLength + 1);
+        packer->dir.count++;
+    }
+
+    packer->addedId = id;
+    packer->pendingCount++;
+    packer->pendingSize += blockSize;
+
+    if (packer->pendingSize >= RRES_PACK_FLUSH_SIZE) rresFlushPacker(packer);
+
+    return id;
+}
+
+// Pack pending chunks and write them to file
+// NOTE: Last added chunk is kept pending, it is written once next chunk is added or packer is closed
+int rresFlushPacker(rresPacker *packer)
+{
+    int result = RRES_ERROR_FILE_NOT_FOUND;
+
+    if ((packer != NULL) && (packer->file != NULL)) result = rresWritePackerChunks(packer, false);
+
+    return result;
+}
+
+// Write pending chunks, central directory and file header, close file
+// NOTE: Central directory is written as last chunk (not compressed/encrypted), it is not considered in chunks count
+int rresClosePacker(rresPacker *packer)
+{
+    if ((packer == NULL) || (packer->file == NULL)) return RRES_ERROR_FILE_NOT_FOUND;
+
+    rresWritePackerChunks(packer, true);
+
+    // Pending chunks are discarded on error
+    for (unsigned int i = 0; i < packer->pendingCount; i++) rresUnloadResourceChunk(packer->pending[i]);
+
+    if (packer->result == RRES_SUCCESS)
+    {
+        rresFileHeader header = { 0 };
+        header.id[0] = 'r';
+        header.id[1] = 'r';
+        header.id[2] = 'e';
+        header.id[3] = 's';
+        header.version = 100;
+        header.chunkCount = (packer->chunkCount > 65535)? 65535 : (unsigned short)packer->chunkCount;
+
+        if (packer->chunkCount > 65535) RRES_LOG("RRES: WARNING: rres file chunks count limit reached (65535), central directory is required to access resources\n");
+
+        // Central directory data: propCount + props[0]:entryCount + rresDirEntry[0..entryCount]
+        // NOTE: Entries fileName is NULL terminated and padded to 4-byte alignment
+        unsigned int cdirSize = 2*sizeof(int);
+        for (unsigned int i = 0; i < packer->dirWritten; i++) cdirSize += (16 + ((packer->dir.compactEntries[i].nameLength + 1 + 3) & ~3u));
+
+        unsigned char *cdir = (unsigned char *)RRES_CALLOC(cdirSize, 1);
+
+        if ((cdir != NULL) && (packer->dirWritten > 0))
+        {
+            unsigned int position = 2*sizeof(int);
+            ((unsigned int *)cdir)[0] = 1;
+            ((unsigned int *)cdir)[1] = packer->dirWritten;
+
+            for (unsigned int i = 0; i < packer->dirWritten; i++)
+            {
+                rresDirEntryCompact entry = packer->dir.compactEntries[i];
+                unsigned int entryData[4] = { entry.id, entry.offset, 0, (entry.nameLength + 1 + 3) & ~3u };
+
+                memcpy(cdir + position, entryData, 16);
+                memcpy(cdir + position + 16, packer->dir.names + entry.nameOffset, entry.nameLength);
+                position += (16 + entryData[3]);
+            }
+
+            rresResourceChunkInfo info = { 0 };
+            rresGetFourCC(RRES_DATA_DIRECTORY, info.type);
+            info.packedSize = cdirSize;
+            info.baseSize = cdirSize;
+            info.crc32 = rresComputeCRC32(cdir, (int)cdirSize);
+
+            if (((unsigned long long)packer->offset + sizeof(rresResourceChunkInfo) + cdirSize) > 0xffffffff) packer->result = RRES_ERROR_FILE_WRITE;
+            else if ((fwrite(&info, sizeof(rresResourceChunkInfo), 1, (FILE *)packer->file) == 1) && (fwrite(cdir, cdirSize, 1, (FILE *)packer->file) == 1))
+            {
+                header.cdOffset = packer->offset - sizeof(rresFileHeader);     // Offset relative to header end
+                packer->offset += (sizeof(rresResourceChunkInfo) + cdirSize);
+            }
+            else packer->result = RRES_ERROR_FILE_WRITE;
+        }
+        else if (cdir == NULL) packer->result = RRES_ERROR_MEMORY_ALLOC;
+
+        RRES_FREE(cdir);
+
+        // Write file header, space was reserved at file start
+        if ((packer->result == RRES_SUCCESS) && ((fseek((FILE *)packer->file, 0, SEEK_SET) != 0) ||
+            (fwrite(&header, sizeof(rresFileHeader), 1, (FILE *)packer->file) != 1))) packer->result = RRES_ERROR_FILE_WRITE;
+
+        if (packer->result == RRES_SUCCESS) RRES_LOG("RRES: INFO: rres file packed successfully: %i chunks, %i resources, %u bytes\n", packer->chunkCount, packer->dirWritten, packer->offset);
+    }
+
+    if (fclose((FILE *)packer->file) != 0) packer->result = RRES_ERROR_FILE_WRITE;
+
+    RRES_FREE(packer->pending);
+    RRES_FREE(packer->dir.compactEntries);
+    RRES_FREE(packer->dir.names);
+
+    int result = packer->result;
+    memset(packer, 0, sizeof(rresPacker));
+
+    return result;
+}
+
+// Set callback to pack chunks data and threads used
+void rresSetPackProcessor(rresPacker *packer, rresPackProcessor processor, unsigned int threadCount)
+{
+    if (packer != NULL)
+    {
+        packer->processor = processor;
+        packer->threadCount = threadCount;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Generate central directory lookup hash table
+// NOTE: Entries are hashed by fileName CRC32, it is usually the resource id but ids can be custom,
+// if multiple entries share the same fileName, first one is found on lookup
+static void rresIndexCentralDirectory(rresCentralDir *dir)
+{
+    dir->capacity = 16;
+    while (dir->capacity < 2*dir->count) dir->capacity *= 2;
+    dir->table = (unsigned int *)RRES_CALLOC(dir->capacity, sizeof(unsigned int));
+
+    if (dir->table == NULL) dir->capacity = 0;
+    else
+    {
+        unsigned int mask = dir->capacity - 1;
+
+        for (unsigned int i = 0; i < dir->count; i++)
+        {
+            // NOTE: Make sure fileName is NULL terminated before hashing it
+            dir->entries[i].fileName[RRES_MAX_FILENAME_SIZE - 1] = '\0';
+
+            unsigned int slot = rresComputeCRC32((const unsigned char *)dir->entries[i].fileName, (int)strlen(dir->entries[i].fileName)) & mask;
+            while (dir->table[slot] != 0) slot = (slot + 1) & mask;
+
+            dir->table[slot] = i + 1;
+        }
+    }
+}
+
+// Compare fileNames for sorting, qsort() callback
+static int rresCompareFileNames(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+// Add resource first chunk offset to archive index
+// NOTE: Index capacity is always kept at least twice the resources count
+static void rresIndexArchiveResource(rresArchive *archive, unsigned int rresId, unsigned int offset)
+{
+    if ((archive->count + 1)*2 > archive->capacity)
+    {
+        // Grow index hash table and reinsert current resources
+        rresArchive grown = *archive;
+        grown.count = 0;
+        grown.capacity = archive->capacity*2;
+        grown.ids = (unsigned int *)RRES_CALLOC(grown.capacity, sizeof(unsigned int));
+        grown.offsets = (unsigned int *)RRES_CALLOC(grown.capacity, sizeof(unsigned int));
+
+        for (unsigned int i = 0; i < archive->capacity; i++)
+        {
+            if (archive->offsets[i] != 0) rresIndexArchiveResource(&grown, archive->ids[i], archive->offsets[i]);
+        }
+
+        RRES_FREE(archive->ids);
+        RRES_FREE(archive->offsets);
+        *archive = grown;
+    }
+
+    // Linear probing from id hash (ids are usually CRC32 values, mixed anyway for custom ids)
+    unsigned int mask = archive->capacity - 1;
+    unsigned int slot = (rresId*2654435761u) & mask;
+
+    while ((archive->offsets[slot] != 0) && (archive->ids[slot] != rresId)) slot = (slot + 1) & mask;
+
+    if (archive->offsets[slot] == 0) archive->count++;
+    archive->ids[slot] = rresId;
+    archive->offsets[slot] = offset;
+}
+
+// Get resource first chunk offset from archive index (0 if not found)
+static unsigned int rresFindArchiveResource(rresArchive archive, unsigned int rresId)
+{
+    unsigned int offset = 0;
+
+    if ((archive.file != NULL) && (archive.capacity > 0))
+    {
+        unsigned int mask = archive.capacity - 1;
+        unsigned int slot = (rresId*2654435761u) & mask;
+
+        while (archive.offsets[slot] != 0)
+        {
+            if (archive.ids[slot] == rresId)
+            {
+                offset = archive.offsets[slot];
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    return offset;
+}
+
+// Load resource chunk at provided global offset
+// NOTE: On mapped archives chunk.data.raw references archive data, only props are copied
+static rresResourceChunk rresLoadArchiveChunk(rresArchive archive, unsigned int offset)
+{
+    rresResourceChunk chunk = { 0 };
+    rresResourceChunkInfo info = rresLoadArchiveChunkInfo(archive, offset);
+
+    RRES_LOG("RRES: %c%c%c%c: Id: 0x%08x | Base size: %i | Packed size: %i\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id, info.baseSize, info.packedSize);
+
+    info.reserved = 0;      // Field used at runtime for chunk data ownership flags
+
+    if (archive.mapping != NULL)
+    {
+        rresAddFileStats(0, 0, sizeof(rresResourceChunkInfo));
+
+        if (((unsigned long long)offset + sizeof(rresResourceChunkInfo) + info.packedSize) <= archive.mappingSize)
+        {
+            unsigned char *data = archive.mapping + offset + sizeof(rresResourceChunkInfo);
+            rresLoadStats stats = { 0 };
+            stats.dataType = rresGetDataType(info.type);
+            stats.compType = info.compType;
+            stats.chunkCount = 1;
+            stats.bytesRead = info.packedSize;
+
+            double time = loadStatsEnabled? rresGetLoadStatsTime() : 0.0;
+            bool valid = (archive.verifyMode == RRES_VERIFY_NEVER) || (rresComputeCRC32(data, info.packedSize) == info.crc32);
+
+            if (loadStatsEnabled && (archive.verifyMode != RRES_VERIFY_NEVER)) stats.crcTime = rresGetLoadStatsTime() - time;
+
+            // CRC32 data validation, verify packed data is not corrupted (skipped for trusted archives)
+            if (!valid) RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+            else if (rresGetDataType(info.type) != RRES_DATA_NULL)
+            {
+                if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE))
+                {
+                    // Data is not compressed/encrypted, properties are copied, raw data is referenced
+                    // NOTE: Properties are copied because chunks are not required to be 4-byte aligned in file
+                    memcpy(&chunk.data.propCount, data, sizeof(int));
+                    if ((sizeof(int) + chunk.data.propCount*sizeof(int)) > info.packedSize) chunk.data.propCount = 0;
+
+                    if (chunk.data.propCount > 0)
+                    {
+                        chunk.data.props = (unsigned int *)RRES_CALLOC(chunk.data.propCount, sizeof(unsigned int));
+                        memcpy(chunk.data.props, data + sizeof(int), chunk.data.propCount*sizeof(int));
+
+                        stats.bytesAllocated = chunk.data.propCount*sizeof(int);
+                        stats.bytesCopied = stats.bytesAllocated;
+                    }
+
+                    chunk.data.raw = data + sizeof(int) + (chunk.data.propCount*sizeof(int));
+                }
+                else chunk.data.raw = data;     // Data is compressed/encrypted, it's up to the user to process it
+
+                info.reserved |= RRES_CHUNK_RAW_BORROWED;
+            }
+
+            rresAddLoadStats(stats);
+        }
+        else RRES_LOG("RRES: WARNING: [ID %i] Resource chunk out of archive bounds\n", info.id);
+    }
+    else
+    {
+        // Read resource chunk from file data
+        // NOTE: Read data can be compressed/encrypted, it's up to the user library to manage decompression/decryption
+        void *data = RRES_CALLOC(info.packedSize, 1);
+
+        rresAddFileStats(0, 2, sizeof(rresResourceChunkInfo));  // Chunk info and chunk data positioned reads
+
+        // Get chunk.data properly organized (only if uncompressed/unencrypted)
+        if (rresReadArchive(archive, offset + sizeof(rresResourceChunkInfo), data, info.packedSize)) chunk.data = rresLoadResourceChunkData(info, data, (archive.verifyMode != RRES_VERIFY_NEVER));
+        else RRES_LOG("RRES: WARNING: [ID %i] Resource chunk data could not be read\n", info.id);
+
+        RRES_FREE(data);
+    }
+
+    chunk.info = info;
+
+    return chunk;
+}
+
+// Load resource chunk info at provided global offset
+static rresResourceChunkInfo rresLoadArchiveChunkInfo(rresArchive archive, unsigned int offset)
+{
+    rresResourceChunkInfo info = { 0 };
+
+    if (!rresReadArchive(archive, offset, &info, sizeof(rresResourceChunkInfo))) memset(&info, 0, sizeof(rresResourceChunkInfo));
+
+    return info;
+}
+
+// Read archive data at provided global offset
+// NOTE: Reads do not depend on the shared file position, so archive can be read from multiple threads
+static bool rresReadArchive(rresArchive archive, unsigned int offset, void *data, unsigned int size)
+{
+    bool result = false;
+
+    if (archive.mapping != NULL)
+    {
+        if (((unsigned long long)offset + size) <= archive.mappingSize)
+        {
+            memcpy(data, archive.mapping + offset, size);
+            result = true;
+        }
+    }
+    else if (archive.file != NULL)
+    {
+#if defined(_WIN32)
+        // NOTE: No positional reads available on C runtime, file access is serialized
+        rresLockMutex(&archiveReadLock);
+        fseek((FILE *)archive.file, offset, SEEK_SET);
+        result = (fread(data, 1, size, (FILE *)archive.file) == size);
+        rresUnlockMutex(&archiveReadLock);
+#else
+        unsigned char *bytes = (unsigned char *)data;
+        unsigned int bytesRead = 0;
+
+        while (bytesRead < size)
+        {
+            ssize_t count = pread(fileno((FILE *)archive.file), bytes + bytesRead, size - bytesRead, (off_t)offset + bytesRead);
+            if (count <= 0) break;
+            bytesRead += (unsigned int)count;
+        }
+
+        result = (bytesRead == size);
+#endif
+    }
+
+    return result;
+}
+
+// Init mutex
+static void rresInitMutex(rresMutex *mutex)
+{
+#if defined(_WIN32)
+    InitializeSRWLock((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+// Destroy mutex
+static void rresDestroyMutex(rresMutex *mutex)
+{
+#if defined(_WIN32)
+    (void)mutex;    // NOTE: SRWLOCK does not need to be destroyed
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+// Lock mutex
+static void rresLockMutex(rresMutex *mutex)
+{
+#if defined(_WIN32)
+    AcquireSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+// Unlock mutex
+static void rresUnlockMutex(rresMutex *mutex)
+{
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive((struct _RTL_SRWLOCK *)mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+// Create thread running proc(arg)
+static bool rresCreateThread(rresThread *thread, rresThreadProc proc, void *arg)
+{
+#if defined(_WIN32)
+    *thread = (rresThread)_beginthreadex(NULL, 0, proc, arg, 0, NULL);
+    return (*thread != NULL);
+#else
+    return (pthread_create(thread, NULL, proc, arg) == 0);
+#endif
+}
+
+// Wait for thread to finish
+static void rresJoinThread(rresThread thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, 0xffffffff);    // INFINITE
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+// Get logical processors count
+static unsigned int rresGetProcessorCount(void)
+{
+    unsigned int count = 1;
+
+#if defined(_WIN32)
+    count = (unsigned int)GetActiveProcessorCount(0xffff);     // ALL_PROCESSOR_GROUPS
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    if (processors > 0) count = (unsigned int)processors;
+#endif
+
+    return (count > 0)? count : 1;
+}
+
+// Wait for condition signal
+// NOTE: Mutex must be locked, it's unlocked while waiting
+static void rresWaitCondition(rresCondition *cond, rresMutex *mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableSRW((struct _RTL_CONDITION_VARIABLE *)cond, (struct _RTL_SRWLOCK *)mutex, 0xffffffff, 0);    // INFINITE
+#else
+    pthread_cond_wait(cond, mutex);
+#endif
+}
+
+// Signal condition, wakes one waiting thread
+static void rresSignalCondition(rresCondition *cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable((struct _RTL_CONDITION_VARIABLE *)cond);
+#else
+    pthread_cond_signal(cond);
+#endif
+}
+
+// Job worker thread: runs jobs from queue until empty
+RRES_THREAD_PROC(rresJobWorker)
+{
+    rresJobQueue *queue = (rresJobQueue *)arg;
+
+    while (true)
+    {
+        rresLockMutex(&queue->lock);
+        unsigned int index = queue->next;
+        if (index < queue->count) queue->next++;
+        rresUnlockMutex(&queue->lock);
+
+        if (index >= queue->count) break;
+
+        queue->job(queue->userData, index);
+    }
+
+    return 0;
+}
+
+// Init CRC32 tables and select engine supported by CPU
+// NOTE: Slicing-by-8 tables are always generated, they process data not multiple of block size
+static void rresInitCRC32(void)
+{
+    static const unsigned int crcTable[256] = {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+    };
+
+    rresLockMutex(&crc32Lock);
+
+    if (crc32Engine < 0)
+    {
+        // Table[k][i]: CRC32 of byte i followed by k zero bytes
+        for (int i = 0; i < 256; i++) crc32Tables[0][i] = crcTable[i];
+        for (int k = 1; k < 8; k++)
+        {
+            for (int i = 0; i < 256; i++) crc32Tables[k][i] = (crc32Tables[k - 1][i] >> 8)^crcTable[crc32Tables[k - 1][i] & 0xff];
+        }
+
+        int engine = RRES_CRC32_ENGINE_TABLE;
+
+#if defined(RRES_CRC32_CLMUL)
+        // Check CPU support: SSE4.1 (ECX bit 19) and PCLMULQDQ (ECX bit 1)
+        unsigned int ecx = 0;
+    #if defined(_MSC_VER)
+        int info[4] = { 0 };
+        __cpuid(info, 1);
+        ecx = (unsigned int)info[2];
+    #else
+        unsigned int eax = 0, ebx = 0, edx = 0;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) ecx = 0;
+    #endif
+        if ((ecx & (1u << 19)) && (ecx & (1u << 1))) engine = RRES_CRC32_ENGINE_CLMUL;
+#endif
+#if defined(RRES_CRC32_ARMV8)
+    #if defined(__ARM_FEATURE_CRC32) || defined(__APPLE__)
+        engine = RRES_CRC32_ENGINE_ARMV8;
+    #elif defined(__linux__)
+        if (getauxval(AT_HWCAP) & (1 << 7)) engine = RRES_CRC32_ENGINE_ARMV8;   // HWCAP_CRC32
+    #endif
+#endif
+
+        crc32Engine = engine;
+    }
+
+    rresUnlockMutex(&crc32Lock);
+}
+
+// Compute CRC32 using slicing-by-8 tables
+// NOTE: Data is read byte by byte, so result does not depend on platform endianness
+static unsigned int rresComputeCRC32Table(unsigned int crc, const unsigned char *data, unsigned int len)
+{
+    while (len >= 8)
+    {
+        unsigned int low = crc^((unsigned int)data[0] | ((unsigned int)data[1] << 8) | ((unsigned int)data[2] << 16) | ((unsigned int)data[3] << 24));
+        unsigned int high = (unsigned int)data[4] | ((unsigned int)data[5] << 8) | ((unsigned int)data[6] << 16) | ((unsigned int)data[7] << 24);
+
+        crc = crc32Tables[7][low & 0xff]^crc32Tables[6][(low >> 8) & 0xff]^crc32Tables[5][(low >> 16) & 0xff]^crc32Tables[4][low >> 24]^
+              crc32Tables[3][high & 0xff]^crc32Tables[2][(high >> 8) & 0xff]^crc32Tables[1][(high >> 16) & 0xff]^crc32Tables[0][high >> 24];
+
+        data += 8;
+        len -= 8;
+    }
+
+    while (len > 0)
+    {
+        crc = (crc >> 8)^crc32Tables[0][(*data)^(crc & 0xff)];
+        data++;
+        len--;
+    }
+
+    return crc;
+}
+
+#if defined(RRES_CRC32_CLMUL)
+// Compute CRC32 using PCLMULQDQ folding
+// NOTE: Folding 4x128 bits in parallel, constants from "Fast CRC Computation for Generic Polynomials
+// Using PCLMULQDQ Instruction" (Intel), in bit-reflected domain for CRC32 polynomial (0x04c11db7)
+RRES_CRC32_TARGET static unsigned int rresComputeCRC32Clmul(unsigned int crc, const unsigned char *data, unsigned int len)
+{
+    static const unsigned long long k1k2[2] = { 0x0154442bd4ull, 0x01c6e41596ull };
+    static const unsigned long long k3k4[2] = { 0x01751997d0ull, 0x00ccaa009eull };
+    static const unsigned long long k5k0[2] = { 0x0163cd6124ull, 0x0000000000ull };
+    static const unsigned long long poly[2] = { 0x01db710641ull, 0x01f7011641ull };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    // Load first 64 bytes block, CRC register is xored with first 4 bytes
+    x1 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_loadu_si128((const __m128i *)k1k2);
+
+    data += 64;
+    len -= 64;
+
+    // Parallel fold blocks of 64 bytes
+    while (len >= 64)
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        data += 64;
+        len -= 64;
+    }
+
+    // Fold into 128 bits
+    x0 = _mm_loadu_si128((const __m128i *)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Single fold blocks of 16 bytes
+    while (len >= 16)
+    {
+        x2 = _mm_loadu_si128((const __m128i *)data);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        data += 16;
+        len -= 16;
+    }
+
+    // Fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_loadu_si128((const __m128i *)poly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (unsigned int)_mm_extract_epi32(x1, 1);
+}
+#endif
+
+#if defined(RRES_CRC32_ARMV8)
+// Compute CRC32 using ARMv8 CRC32 instructions
+RRES_CRC32_TARGET static unsigned int rresComputeCRC32Armv8(unsigned int crc, const unsigned char *data, unsigned int len)
+{
+    // Align data to 8 bytes
+    while ((len > 0) && (((size_t)data & 7) != 0))
+    {
+        crc = __crc32b(crc, *data);
+        data++;
+        len--;
+    }
+
+    while (len >= 8)
+    {
+        uint64_t value = 0;
+        memcpy(&value, data, 8);
+        crc = __crc32d(crc, value);
+        data += 8;
+        len -= 8;
+    }
+
+    while (len > 0)
+    {
+        crc = __crc32b(crc, *data);
+        data++;
+        len--;
+    }
+
+    return crc;
+}
+#endif
+
+// Load user resource chunk from resource packed data (as contained in .rres file)
+// WARNING: Data can be compressed and/or encrypted, in those cases is up to the user to process it,
+// and chunk.data.propCount = 0, chunk.data.props = NULL and chunk.data.raw contains all resource packed data
+static rresResourceChunkData rresLoadResourceChunkData(rresResourceChunkInfo info, void *data, bool verify)
+{
+    rresResourceChunkData chunkData = { 0 };
+    rresLoadStats stats = { 0 };
+    stats.dataType = rresGetDataType(info.type);
+    stats.compType = info.compType;
+    stats.chunkCount = 1;
+    stats.bytesRead = info.packedSize;
+
+    double time = loadStatsEnabled? rresGetLoadStatsTime() : 0.0;
+
+    // CRC32 data validation, verify packed data is not corrupted
+    // NOTE: Verification can be skipped for trusted archives
+    unsigned int crc32 = verify? rresComputeCRC32((const unsigned char *)data, info.packedSize) : info.crc32;
+
+    if (loadStatsEnabled && verify) stats.crcTime = rresGetLoadStatsTime() - time;
+
+    if ((rresGetDataType(info.type) != RRES_DATA_NULL) && (crc32 == info.crc32))   // Make sure chunk contains data and data is not corrupted
+    {
+        // Check if data chunk is compressed/encrypted to retrieve properties + data
+        if ((info.compType == RRES_COMP_NONE) && (info.cipherType == RRES_CIPHER_NONE))
+        {
+            // Data is not compressed/encrypted (info.packedSize = info.baseSize)
+            chunkData.propCount = ((unsigned int *)data)[0];
+
+            if (chunkData.propCount > 0)
+            {
+                chunkData.props = (unsigned int *)RRES_CALLOC(chunkData.propCount, sizeof(unsigned int));
+                for (unsigned int i = 0; i < chunkData.propCount; i++) chunkData.props[i] = ((unsigned int *)data)[i + 1];
+            }
+
+            int rawSize = info.baseSize - sizeof(int) - (chunkData.propCount*sizeof(int));
+            chunkData.raw = RRES_CALLOC(rawSize, 1);
+            if (chunkData.raw != NULL) memcpy(chunkData.raw, ((unsigned char *)data) + sizeof(int) + (chunkData.propCount*sizeof(int)), rawSize);
+
+            stats.bytesAllocated = chunkData.propCount*sizeof(int) + rawSize;
+            stats.bytesCopied = stats.bytesAllocated;
+        }
+        else
+        {
+            // Data is compressed/encrypted
+            // Just return the loaded resource packed data from .rres file,
+            // it's up to the user to manage decompression/decryption on user library
+            chunkData.raw = RRES_CALLOC(info.packedSize, 1);
+            if (chunkData.raw != NULL) memcpy(chunkData.raw, (unsigned char *)data, info.packedSize);
+
+            stats.bytesAllocated = info.packedSize;
+            stats.bytesCopied = info.packedSize;
+        }
+    }
+
+    if (crc32 != info.crc32) RRES_LOG("RRES: WARNING: [ID %i] CRC32 does not match, data can be corrupted\n", info.id);
+
+    // NOTE: Packed data is considered allocated by the caller to read it
+    stats.bytesAllocated += info.packedSize;
+    rresAddLoadStats(stats);
+
+    return chunkData;
+}
+
+// Get load request for ticket (NULL if ticket not valid)
+// NOTE: Ticket contains request slot generation (16 bit) and slot index + 1 (16 bit)
+static rresLoadRequest *rresGetLoadRequest(unsigned int ticket)
+{
+    rresLoadRequest *request = NULL;
+    unsigned int index = (ticket & 0xffff);
+
+    if ((index > 0) && (index <= loadQueue.capacity))
+    {
+        rresLoadRequest *slot = &loadQueue.requests[index - 1];
+
+        if ((slot->state != RRES_LOAD_FREE) && (slot->state != RRES_LOAD_CANCELED) && (slot->generation == (ticket >> 16))) request = slot;
+    }
+
+    return request;
+}
+
+// Release load request slot, invalidates its ticket
+static void rresReleaseLoadRequest(rresLoadRequest *request)
+{
+    unsigned short generation = request->generation + 1;
+
+    memset(request, 0, sizeof(rresLoadRequest));
+    request->generation = generation;
+}
+
+// Loading thread: loads pending requests by priority
+// NOTE: Queue is unlocked while loading, so requests can be added, taken or canceled meanwhile
+RRES_THREAD_PROC(rresLoadWorker)
+{
+    (void)arg;
+
+    rresLockMutex(&loadLock);
+
+    while (!loadQueue.stop)
+    {
+        // Get highest priority pending request, oldest request first for same priority
+        int index = -1;
+
+        for (unsigned int i = 0; i < loadQueue.capacity; i++)
+        {
+            rresLoadRequest *request = &loadQueue.requests[i];
+
+            if ((request->state == RRES_LOAD_PENDING) && ((index < 0) ||
+                (request->priority > loadQueue.requests[index].priority) ||
+                ((request->priority == loadQueue.requests[index].priority) && ((int)(request->serial - loadQueue.requests[index].serial) < 0)))) index = i;
+        }
+
+        if (index < 0) rresWaitCondition(&loadSignal, &loadLock);
+        else
+        {
+            rresLoadRequest *request = &loadQueue.requests[index];
+            request->state = RRES_LOAD_LOADING;
+
+            rresArchive archive = request->archive;
+            unsigned int rresId = request->rresId;
+            rresLoadProcessor processor = loadQueue.processor;
+
+            rresUnlockMutex(&loadLock);
+
+            rresResourceMulti multi = rresLoadResourceMultiFromArchive(archive, rresId);
+
+            if ((processor != NULL) && (multi.count > 0))
+            {
+                if (processor(&multi) != 0) RRES_LOG("RRES: WARNING: Loaded resource could not be processed: 0x%08x\n", rresId);
+            }
+
+            rresLockMutex(&loadLock);
+
+            // NOTE: Requests could be reallocated while loading, request is accessed by index
+            request = &loadQueue.requests[index];
+
+            if (request->state == RRES_LOAD_CANCELED)
+            {
+                rresUnloadResourceMulti(multi);
+                rresReleaseLoadRequest(request);
+            }
+            else
+            {
+                request->result = multi;
+                request->state = RRES_LOAD_READY;
+            }
+        }
+    }
+
+    rresUnlockMutex(&loadLock);
+
+    return 0;
+}
+
+// Add file level load statistics (RRES_DATA_NULL)
+static void rresAddFileStats(unsigned int fileOpens, unsigned int fileSeeks, unsigned int bytesRead)
+{
+    if (loadStatsEnabled)
+    {
+        rresLoadStats stats = { 0 };    // RRES_DATA_NULL, RRES_COMP_NONE
+
+        stats.fileOpens = fileOpens;
+        stats.fileSeeks = fileSeeks;
+        stats.bytesRead = bytesRead;
+
+        rresAddLoadStats(stats);
+    }
+}
+
+// Get FourCC code from rresResourceDataType
+static void rresGetFourCC(unsigned int type, unsigned char *fourCC)
+{
+    const char *code = "NULL";
+
+    switch (type)
+    {
+        case RRES_DATA_RAW: code = "RAWD"; break;
+        case RRES_DATA_TEXT: code = "TEXT"; break;
+        case RRES_DATA_IMAGE: code = "IMGE"; break;
+        case RRES_DATA_WAVE: code = "WAVE"; break;
+        case RRES_DATA_VERTEX: code = "VRTX"; break;
+        case RRES_DATA_FONT_GLYPHS: code = "FNTG"; break;
+        case RRES_DATA_LINK: code = "LINK"; break;
+        case RRES_DATA_DIRECTORY: code = "CDIR"; break;
+        default: break;
+    }
+
+    memcpy(fourCC, code, 4);
+}
+
+// Pack one pending chunk and compute its CRC32
+// NOTE: Runs on packer worker threads, every job only accesses its own chunk
+static void rresPackJob(void *userData, unsigned int index)
+{
+    rresPacker *packer = (rresPacker *)userData;
+    rresResourceChunk *chunk = &packer->pending[index];
+
+    if (chunk->info.reserved & RRES_CHUNK_PACKED) return;     // Chunk kept pending from previous flush
+
+    if ((chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE))
+    {
+        if ((packer->processor == NULL) || (packer->processor(chunk) != 0)) chunk->info.reserved |= RRES_CHUNK_PACK_FAILED;
+    }
+
+    if ((chunk->info.reserved & RRES_CHUNK_PACK_FAILED) == 0)
+    {
+        const unsigned char *data = (const unsigned char *)chunk->data.raw;
+        if (chunk->info.reserved & RRES_CHUNK_DATA_BLOCK) data -= (sizeof(int) + chunk->data.propCount*sizeof(int));
+
+        chunk->info.crc32 = rresComputeCRC32(data, (int)chunk->info.packedSize);
+    }
+
+    chunk->info.reserved |= RRES_CHUNK_PACKED;
+}
+
+// Pack pending chunks in parallel and write them to file
+// NOTE 1: Chunks are packed (and CRC32 computed) on worker threads, then written in adding order,
+// chunk nextOffset is assigned on writing if next pending chunk belongs to the same resource
+// NOTE 2: If not all chunks are written, last one is kept pending because next added chunk could be linked to it
+static int rresWritePackerChunks(rresPacker *packer, bool all)
+{
+    unsigned int writeCount = (all || (packer->pendingCount == 0))? packer->pendingCount : packer->pendingCount - 1;
+
+    if ((packer->result == RRES_SUCCESS) && (writeCount > 0))
+    {
+        rresRunJobs(rresPackJob, packer, packer->pendingCount, packer->threadCount);
+
+        for (unsigned int i = 0; (i < writeCount) && (packer->result == RRES_SUCCESS); i++)
+        {
+            rresResourceChunk *chunk = &packer->pending[i];
+            rresResourceChunkInfo info = chunk->info;
+            const void *data = chunk->data.raw;
+
+            // Chunk data not packed is written from its block start: propCount + props[] + raw
+            if (info.reserved & RRES_CHUNK_DATA_BLOCK) data = (const unsigned char *)chunk->data.raw - sizeof(int) - chunk->data.propCount*sizeof(int);
+
+            if (info.reserved & RRES_CHUNK_PACK_FAILED)
+            {
+                packer->result = RRES_ERROR_PACK_DATA;
+                RRES_LOG("RRES: WARNING: %c%c%c%c: Resource chunk data could not be packed: 0x%08x\n", info.type[0], info.type[1], info.type[2], info.type[3], info.id);
+            }
+            else if (((unsigned long long)packer->offset + sizeof(rresResourceChunkInfo) + info.packedSize) > 0xffffffff)
+            {
+                packer->result = RRES_ERROR_FILE_WRITE;
+                RRES_LOG("RRES: WARNING: rres file size limit reached (4 GB), resource chunk not written: 0x%08x\n", info.id);
+            }
+            else
+            {
+                // Assign central directory entry offset to resource first chunk
+                if (((packer->chunkCount == 0) || (info.id != packer->writtenId)) && (packer->dirWritten < packer->dir.count))
+                {
+                    packer->dir.compactEntries[packer->dirWritten++].offset = packer->offset;
+                }
+
+                // Link next chunk if it belongs to the same resource
+                info.nextOffset = 0;
+                if (((i + 1) < packer->pendingCount) && (packer->pending[i + 1].info.id == info.id)) info.nextOffset = packer->offset + sizeof(rresResourceChunkInfo) + info.packedSize;
+                info.reserved = 0;
+
+                if ((fwrite(&info, sizeof(rresResourceChunkInfo), 1, (FILE *)packer->file) == 1) &&
+                    ((info.packedSize == 0) || (fwrite(data, info.packedSize, 1, (FILE *)packer->file) == 1)))
+                {
+                    packer->writtenId = info.id;
+                    packer->offset += (sizeof(rresResourceChunkInfo) + info.packedSize);
+                    packer->chunkCount++;
+                }
+                else packer->result = RRES_ERROR_FILE_WRITE;
+            }
+        }
+
+        // Written chunks are unloaded, last one is kept pending if required
+        for (unsigned int i = 0; i < writeCount; i++)
+        {
+            packer->pendingSize -= packer->pending[i].info.baseSize;
+            rresUnloadResourceChunk(packer->pending[i]);
+        }
+
+        if (writeCount < packer->pendingCount) packer->pending[0] = packer->pending[writeCount];
+        packer->pendingCount -= writeCount;
+    }
+
+    return packer->result;
 }
 
-#endif // RRES_IMPLEMENTATION
\ No newline at end of file
+#endif // RRES_IMPLEMENTATION
@@ -0,0 +1,168 @@
+/**********************************************************************************************
+*
+*   rres_bench_crc32 - rres CRC32 engines benchmark
+*
+*   DESCRIPTION:
+*       Standalone program measuring rresComputeCRC32() throughput with every CRC32 engine
+*       supported by the CPU: slicing-by-8 tables (scalar), x86 PCLMULQDQ folding and ARMv8
+*       CRC32 instructions. Hardware engines results are checked against the scalar engine
+*       for every size from 0 to 4096 bytes and every alignment, scalar engine is checked
+*       against the standard CRC32 check value
+*
+*   BUILD:
+*       gcc -O2 rres_bench_crc32.c -o bench_crc32 -lpthread
+*
+*       Only engines supported by the CPU running the benchmark are measured, ARMv8 engine
+*       requires building for an ARMv8 target (i.e. aarch64-linux-gnu-gcc)
+*
+*   LICENSE: zlib/libpng
+*
+**********************************************************************************************/
+
+#define RRES_IMPLEMENTATION
+#include "rres.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: malloc(), free(), rand(), srand()
+#include <time.h>           // Required for: timespec_get()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_DATA_SIZE     (64*1024*1024)  // Data size for largest measured buffer
+#define BENCH_CHECK_SIZE      4096          // Sizes checked against scalar engine: 0..BENCH_CHECK_SIZE
+#define BENCH_CHECK_ALIGN       16          // Alignments checked against scalar engine: 0..BENCH_CHECK_ALIGN-1
+#define BENCH_TOTAL_BYTES   (256*1024*1024) // Bytes processed per run, buffer is processed several times if required
+#define BENCH_RUNS               5          // Runs per size and engine, best run is reported
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *engineNames[3] = { "tables", "PCLMULQDQ", "ARMv8" };
+static const int benchSizes[] = { 64, 256, 4096, 65536, 1024*1024, BENCH_DATA_SIZE };
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTime(void);                                            // Get current time (seconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    const int sizeCount = (int)(sizeof(benchSizes)/sizeof(benchSizes[0]));
+
+    // Random data, same for every build
+    srand(1);
+    unsigned char *data = (unsigned char *)malloc(BENCH_DATA_SIZE + BENCH_CHECK_ALIGN);
+    for (int i = 0; i < BENCH_DATA_SIZE + BENCH_CHECK_ALIGN; i++) data[i] = (unsigned char)rand();
+
+    // First computation generates tables and selects the best engine supported by the CPU
+    rresComputeCRC32(data, 0);
+    int detected = crc32Engine;
+
+    // Engines available on this CPU, scalar engine is always available
+    int engines[3] = { RRES_CRC32_ENGINE_TABLE, 0, 0 };
+    int engineCount = 1;
+    if (detected != RRES_CRC32_ENGINE_TABLE) engines[engineCount++] = detected;
+
+    printf("rres CRC32 benchmark: engine selected: %s, best of %i runs\n\n", engineNames[detected], BENCH_RUNS);
+
+    // Scalar engine check, standard CRC32 check value
+    //--------------------------------------------------------------------------------------
+    int mismatches = 0;
+
+    crc32Engine = RRES_CRC32_ENGINE_TABLE;
+    if (rresComputeCRC32((const unsigned char *)"123456789", 9) != 0xcbf43926)
+    {
+        printf("    tables: check value MISMATCH\n");
+        mismatches++;
+    }
+
+    // Hardware engines check against scalar engine, every size and alignment
+    //--------------------------------------------------------------------------------------
+    unsigned int *expected = (unsigned int *)malloc(sizeof(unsigned int)*(BENCH_CHECK_SIZE + 1)*BENCH_CHECK_ALIGN);
+
+    for (int align = 0; align < BENCH_CHECK_ALIGN; align++)
+    {
+        for (int size = 0; size <= BENCH_CHECK_SIZE; size++) expected[align*(BENCH_CHECK_SIZE + 1) + size] = rresComputeCRC32(data + align, size);
+    }
+
+    for (int e = 1; e < engineCount; e++)
+    {
+        int engineMismatches = 0;
+        crc32Engine = engines[e];
+
+        for (int align = 0; align < BENCH_CHECK_ALIGN; align++)
+        {
+            for (int size = 0; size <= BENCH_CHECK_SIZE; size++)
+            {
+                if (rresComputeCRC32(data + align, size) != expected[align*(BENCH_CHECK_SIZE + 1) + size]) engineMismatches++;
+            }
+        }
+
+        // Largest buffer also checked, folding runs for a long time on it
+        crc32Engine = RRES_CRC32_ENGINE_TABLE;
+        unsigned int expectedLarge = rresComputeCRC32(data + 3, BENCH_DATA_SIZE - 5);
+        crc32Engine = engines[e];
+        if (rresComputeCRC32(data + 3, BENCH_DATA_SIZE - 5) != expectedLarge) engineMismatches++;
+
+        printf("    %-10s %i sizes checked against tables: %s\n", engineNames[engines[e]], (BENCH_CHECK_SIZE + 1)*BENCH_CHECK_ALIGN + 1, (engineMismatches == 0)? "OK" : "MISMATCH");
+        mismatches += engineMismatches;
+    }
+
+    free(expected);
+
+    // Throughput, every engine and size
+    //--------------------------------------------------------------------------------------
+    printf("\n    %-10s", "size");
+    for (int e = 0; e < engineCount; e++) printf(" %10s GB/s", engineNames[engines[e]]);
+    printf("\n");
+
+    for (int s = 0; s < sizeCount; s++)
+    {
+        int size = benchSizes[s];
+        int calls = BENCH_TOTAL_BYTES/size;
+
+        if (size >= 1024*1024) printf("    %7i MB", size/(1024*1024));
+        else printf("    %7i B ", size);
+
+        for (int e = 0; e < engineCount; e++)
+        {
+            volatile unsigned int crc = 0;
+            double best = 1e9;
+            crc32Engine = engines[e];
+
+            for (int run = 0; run < BENCH_RUNS; run++)
+            {
+                double time = GetTime();
+                for (int i = 0; i < calls; i++) crc = rresComputeCRC32(data + (size_t)(i%16)*((size < BENCH_DATA_SIZE)? size : 0), size);
+                time = GetTime() - time;
+                if (time < best) best = time;
+            }
+
+            (void)crc;
+            printf(" %15.2f", (double)size*calls/best/1e9);
+        }
+
+        printf("\n");
+    }
+
+    crc32Engine = detected;
+    free(data);
+
+    return (mismatches == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get current time (seconds)
+static double GetTime(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
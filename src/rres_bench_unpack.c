@@ -0,0 +1,310 @@
+/**********************************************************************************************
+*
+*   rres_bench_unpack - rres-raylib resource chunks unpacking benchmark
+*
+*   DESCRIPTION:
+*       Standalone program measuring allocations, bytes allocated, bytes copied and time per
+*       chunk to load and unpack RAWD chunks from an archive (file reads), not compressed and
+*       LZ4 compressed, with every unpacking method:
+*
+*           legacy - Unpacking before single pass unpack: decompressed data allocated, then
+*                    properties and raw data allocated and copied from it (replicated here)
+*           unpack - rresLoadResourceChunkFromArchive() + UnpackResourceChunk()
+*           stream - LoadResourceChunkToBuffer(), unpacked memory allocated
+*           buffer - LoadResourceChunkToBuffer(), unpacked into a buffer reused between chunks
+*
+*       Bytes copied are recorded by rres load statistics, allocations are counted with custom
+*       RRES_MALLOC()/RRES_CALLOC()/RRES_REALLOC() allocators. Unpacked data of every method
+*       is checked against the packed input data
+*
+*   BUILD:
+*       gcc -O2 rres_bench_unpack.c -o bench_unpack -lraylib -lm -lpthread
+*
+*       A temporary archive (bench_unpack.rres) is created in the working directory
+*
+*   LICENSE: zlib/libpng
+*
+**********************************************************************************************/
+
+#include <stdio.h>          // Required for: printf(), remove()
+#include <stdlib.h>         // Required for: malloc(), calloc(), realloc(), free(), rand(), srand()
+#include <string.h>         // Required for: memcpy(), memcmp()
+#include <time.h>           // Required for: timespec_get()
+
+// Counting allocators, used by rres.h and rres-raylib.h
+static void *BenchMalloc(size_t size);                                  // Allocate memory, counted
+static void *BenchCalloc(size_t count, size_t size);                    // Allocate zeroed memory, counted
+static void *BenchRealloc(void *ptr, size_t size);                      // Reallocate memory, counted
+
+#define RRES_MALLOC(sz)         BenchMalloc(sz)
+#define RRES_CALLOC(n,sz)       BenchCalloc(n,sz)
+#define RRES_REALLOC(ptr,sz)    BenchRealloc(ptr,sz)
+#define RRES_FREE(ptr)          free(ptr)
+#define RRES_LOG(...)           ((void)0)   // Library log disabled, it would be measured
+
+#include "raylib.h"
+
+#define RRES_IMPLEMENTATION
+#include "rres.h"
+
+#define RRES_RAYLIB_IMPLEMENTATION
+#define RRES_SUPPORT_COMPRESSION_LZ4
+#include "rres-raylib.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_FILE          "bench_unpack.rres"     // Temporary archive
+#define BENCH_MAX_SIZE      (16*1024*1024)          // Largest chunk data size
+#define BENCH_RUNS          10                      // Runs per chunk and method, best run is reported
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Unpacking method benchmarked
+typedef enum {
+    BENCH_LEGACY = 0,       // Legacy unpacking (allocated and copied)
+    BENCH_UNPACK,           // rresLoadResourceChunkFromArchive() + UnpackResourceChunk()
+    BENCH_STREAM,           // LoadResourceChunkToBuffer(), memory allocated
+    BENCH_BUFFER,           // LoadResourceChunkToBuffer(), reused buffer
+} BenchMethod;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *methodNames[4] = { "legacy", "unpack", "stream", "buffer" };
+static const int benchSizes[] = { 4096, 65536, 1024*1024, BENCH_MAX_SIZE };
+
+static unsigned int allocCount = 0;         // Allocations counted
+static unsigned long long allocBytes = 0;   // Bytes allocated counted
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static double GetTimeSeconds(void);                                     // Get current time (seconds)
+static int UnpackResourceChunkLegacy(rresResourceChunk *chunk);         // Unpack LZ4 chunk data as before single pass unpack
+static int LoadChunk(rresArchive archive, unsigned int id, BenchMethod method, rresResourceChunk *chunk, void *buffer); // Load and unpack chunk with method
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(void)
+{
+    const int sizeCount = (int)(sizeof(benchSizes)/sizeof(benchSizes[0]));
+    const int compTypes[2] = { RRES_COMP_NONE, RRES_COMP_LZ4 };
+    unsigned int ids[2*(sizeof(benchSizes)/sizeof(benchSizes[0]))] = { 0 };
+
+    // Compressible data, same for every build: random literal runs mixed with runs repeated from previous data
+    srand(1);
+    unsigned char *data = (unsigned char *)malloc(BENCH_MAX_SIZE);
+
+    for (int i = 0; i < BENCH_MAX_SIZE; )
+    {
+        int length = 4 + rand()%28;
+        int distance = 1 + rand()%4096;
+        bool literal = (i < distance) || ((rand()%3) == 0);
+
+        for (int k = 0; (k < length) && (i < BENCH_MAX_SIZE); k++, i++) data[i] = literal? (unsigned char)rand() : data[i - distance];
+    }
+
+    // Archive packing, every size not compressed and LZ4 compressed
+    //--------------------------------------------------------------------------------------
+    rresPacker packer = rresOpenPacker(BENCH_FILE);
+    rresSetPackProcessor(&packer, PackResourceChunk, 0);
+
+    for (int s = 0; s < sizeCount; s++)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            char fileName[64] = { 0 };
+            unsigned int props[4] = { (unsigned int)benchSizes[s], 0x6e69622e, 0, 0 };  // Size, extension: ".bin"
+
+            sprintf(fileName, "chunk_%i_%i.bin", benchSizes[s], compTypes[c]);
+            ids[s*2 + c] = rresAddPackerChunk(&packer, fileName, RRES_DATA_RAW, props, 4, data, benchSizes[s], compTypes[c], RRES_CIPHER_NONE);
+        }
+    }
+
+    if (rresClosePacker(&packer) != 0)
+    {
+        printf("rres unpack benchmark: archive could not be packed\n");
+        free(data);
+        return 1;
+    }
+
+    // Unpacking, every chunk and method
+    //--------------------------------------------------------------------------------------
+    rresArchive archive = rresOpenArchive(BENCH_FILE);
+    unsigned char *buffer = (unsigned char *)malloc(BENCH_MAX_SIZE + 5*sizeof(int));
+    int mismatches = 0;
+
+    printf("rres unpack benchmark: file reads archive, best of %i runs\n\n", BENCH_RUNS);
+    printf("    %-12s %-8s %8s %14s %14s %10s\n", "chunk", "method", "allocs", "allocated KB", "copied KB", "ms");
+
+    for (int s = 0; s < sizeCount; s++)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            char chunkName[32] = { 0 };
+            rresResourceChunkInfo info = rresLoadResourceChunkInfoFromArchive(archive, ids[s*2 + c]);
+
+            if (benchSizes[s] >= 1024*1024) sprintf(chunkName, "%i MB %s", benchSizes[s]/(1024*1024), (c == 0)? "NONE" : "LZ4");
+            else sprintf(chunkName, "%i KB %s", benchSizes[s]/1024, (c == 0)? "NONE" : "LZ4");
+
+            for (int m = 0; m < 4; m++)
+            {
+                // Counted run, unpacked data checked
+                rresResourceChunk chunk = { 0 };
+
+                rresResetLoadStats();
+                rresEnableLoadStats(1);
+                allocCount = 0;
+                allocBytes = 0;
+
+                int result = LoadChunk(archive, ids[s*2 + c], (BenchMethod)m, &chunk, buffer);
+
+                unsigned int chunkAllocs = allocCount;
+                unsigned long long chunkAllocBytes = allocBytes;
+                rresLoadStats stats = rresGetLoadStats(-1, -1);
+                rresEnableLoadStats(0);
+
+                bool match = (result == 0) && (chunk.data.raw != NULL) && (chunk.data.propCount == 4) &&
+                    (chunk.data.props[0] == (unsigned int)benchSizes[s]) && (memcmp(chunk.data.raw, data, benchSizes[s]) == 0);
+                if (!match) mismatches++;
+
+                rresUnloadResourceChunk(chunk);
+
+                // Timed runs
+                double best = 1e9;
+
+                for (int run = 0; run < BENCH_RUNS; run++)
+                {
+                    double time = GetTimeSeconds();
+                    LoadChunk(archive, ids[s*2 + c], (BenchMethod)m, &chunk, buffer);
+                    rresUnloadResourceChunk(chunk);
+                    time = GetTimeSeconds() - time;
+                    if (time < best) best = time;
+                }
+
+                printf("    %-12s %-8s %8u %14.1f %14.1f %10.3f%s\n", (m == 0)? chunkName : "", methodNames[m], chunkAllocs,
+                    chunkAllocBytes/1024.0, stats.bytesCopied/1024.0, best*1e3, match? "" : "   DATA MISMATCH");
+            }
+
+            if (c == 1) printf("    %-12s (packed size: %.1f KB)\n", "", info.packedSize/1024.0);
+        }
+    }
+
+    rresCloseArchive(archive);
+    remove(BENCH_FILE);
+
+    free(buffer);
+    free(data);
+
+    return (mismatches == 0)? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get current time (seconds)
+static double GetTimeSeconds(void)
+{
+    struct timespec ts = { 0 };
+    timespec_get(&ts, TIME_UTC);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Allocate memory, counted
+static void *BenchMalloc(size_t size)
+{
+    allocCount++;
+    allocBytes += size;
+
+    return malloc(size);
+}
+
+// Allocate zeroed memory, counted
+static void *BenchCalloc(size_t count, size_t size)
+{
+    allocCount++;
+    allocBytes += count*size;
+
+    return calloc(count, size);
+}
+
+// Reallocate memory, counted
+static void *BenchRealloc(void *ptr, size_t size)
+{
+    allocCount++;
+    allocBytes += size;
+
+    return realloc(ptr, size);
+}
+
+// Unpack LZ4 chunk data as before single pass unpack
+// NOTE: Data is decompressed into allocated memory, then properties and raw data are allocated
+// and copied from it, packed and decompressed data are freed
+static int UnpackResourceChunkLegacy(rresResourceChunk *chunk)
+{
+    if (chunk->info.compType != RRES_COMP_LZ4) return 0;
+
+    unsigned char *uncompData = (unsigned char *)RRES_CALLOC(chunk->info.baseSize, 1);
+    int uncompDataSize = LZ4_decompress_safe((const char *)chunk->data.raw, (char *)uncompData, chunk->info.packedSize, chunk->info.baseSize);
+
+    if (uncompDataSize <= 0)
+    {
+        RRES_FREE(uncompData);
+        return 4;
+    }
+
+    unsigned int propCount = ((unsigned int *)uncompData)[0];
+    unsigned int rawSize = chunk->info.baseSize - sizeof(int) - propCount*sizeof(int);
+
+    RRES_FREE(chunk->data.raw);
+
+    chunk->data.propCount = propCount;
+    chunk->data.props = (unsigned int *)RRES_CALLOC(propCount, sizeof(unsigned int));
+    memcpy(chunk->data.props, uncompData + sizeof(int), propCount*sizeof(int));
+    chunk->data.raw = RRES_CALLOC(rawSize, 1);
+    memcpy(chunk->data.raw, uncompData + sizeof(int) + propCount*sizeof(int), rawSize);
+
+    RRES_FREE(uncompData);
+
+    chunk->info.compType = RRES_COMP_NONE;
+    chunk->info.packedSize = chunk->info.baseSize;
+
+    // Copies are recorded as done by the library
+    rresLoadStats stats = { 0 };
+    stats.dataType = rresGetDataType(chunk->info.type);
+    stats.compType = RRES_COMP_LZ4;
+    stats.bytesAllocated = chunk->info.baseSize + propCount*sizeof(int) + rawSize;
+    stats.bytesCopied = propCount*sizeof(int) + rawSize;
+    rresAddLoadStats(stats);
+
+    return 0;
+}
+
+// Load and unpack chunk with method
+static int LoadChunk(rresArchive archive, unsigned int id, BenchMethod method, rresResourceChunk *chunk, void *buffer)
+{
+    int result = 0;
+
+    switch (method)
+    {
+        case BENCH_LEGACY:
+        {
+            *chunk = rresLoadResourceChunkFromArchive(archive, id);
+            result = UnpackResourceChunkLegacy(chunk);
+        } break;
+        case BENCH_UNPACK:
+        {
+            *chunk = rresLoadResourceChunkFromArchive(archive, id);
+            result = UnpackResourceChunk(chunk);
+        } break;
+        case BENCH_STREAM: result = LoadResourceChunkToBuffer(archive, id, chunk, NULL, 0); break;
+        case BENCH_BUFFER: result = LoadResourceChunkToBuffer(archive, id, chunk, buffer, BENCH_MAX_SIZE + 5*sizeof(int)); break;
+        default: break;
+    }
+
+    return result;
+}